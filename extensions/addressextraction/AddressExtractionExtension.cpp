@@ -29,7 +29,9 @@ namespace catapult { namespace addressextraction {
 
 	namespace {
 		void RegisterExtension(extensions::ProcessBootstrapper& bootstrapper) {
-			auto pAddressExtractor = std::make_shared<AddressExtractor>(bootstrapper.pluginManager().createNotificationPublisher());
+			auto pAddressExtractor = std::make_shared<AddressExtractor>(
+					bootstrapper.pluginManager().createNotificationPublisher(),
+					bootstrapper.pool().pushIsolatedPool("addressExtractor"));
 
 			// add a dummy service for extending service lifetimes
 			bootstrapper.extensionManager().addServiceRegistrar(extensions::CreateRootedServiceRegistrar(
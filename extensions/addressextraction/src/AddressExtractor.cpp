@@ -21,11 +21,24 @@
 #include "AddressExtractor.h"
 #include "catapult/model/Elements.h"
 #include "catapult/model/TransactionUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace addressextraction {
 
+	namespace {
+		constexpr size_t Min_Transaction_Infos_Per_Partition = 32;
+	}
+
 	AddressExtractor::AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher)
+			: AddressExtractor(std::move(pPublisher), nullptr)
+	{}
+
+	AddressExtractor::AddressExtractor(
+			std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+			const std::shared_ptr<thread::IoThreadPool>& pPool)
 			: m_pPublisher(std::move(pPublisher))
+			, m_pPool(pPool)
 	{}
 
 	void AddressExtractor::extract(model::TransactionInfo& transactionInfo) const {
@@ -37,8 +50,28 @@ namespace catapult { namespace addressextraction {
 	}
 
 	void AddressExtractor::extract(model::TransactionInfosSet& transactionInfos) const {
-		for (auto& transactionInfo : transactionInfos)
-			extract(const_cast<model::TransactionInfo&>(transactionInfo));
+		// only infos without addresses need to be processed (addresses might have already been extracted by the ut updater)
+		std::vector<model::TransactionInfo*> pendingTransactionInfos;
+		for (auto& transactionInfo : transactionInfos) {
+			if (!transactionInfo.OptionalExtractedAddresses)
+				pendingTransactionInfos.push_back(&const_cast<model::TransactionInfo&>(transactionInfo));
+		}
+
+		auto numPartitions = m_pPool
+				? std::min<size_t>(m_pPool->numWorkerThreads(), pendingTransactionInfos.size() / Min_Transaction_Infos_Per_Partition)
+				: 0;
+		if (numPartitions <= 1) {
+			for (auto* pTransactionInfo : pendingTransactionInfos)
+				extract(*pTransactionInfo);
+
+			return;
+		}
+
+		// notice that OptionalExtractedAddresses does not contribute to the hash of a set element, so it can be modified in place
+		thread::ParallelFor(m_pPool->ioContext(), pendingTransactionInfos, numPartitions, [this](auto* pTransactionInfo, auto) {
+			this->extract(*pTransactionInfo);
+			return true;
+		}).get();
 	}
 
 	void AddressExtractor::extract(model::TransactionElement& transactionElement) const {
@@ -27,6 +27,7 @@ namespace catapult {
 		struct BlockElement;
 		struct TransactionElement;
 	}
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace addressextraction {
@@ -37,6 +38,11 @@ namespace catapult { namespace addressextraction {
 		/// Creates an extractor around \a pPublisher.
 		explicit AddressExtractor(std::unique_ptr<const model::NotificationPublisher>&& pPublisher);
 
+		/// Creates an extractor around \a pPublisher that uses \a pPool to extract addresses from large sets of transactions.
+		AddressExtractor(
+				std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+				const std::shared_ptr<thread::IoThreadPool>& pPool);
+
 	public:
 		/// Extracts transaction addresses into \a transactionInfo.
 		void extract(model::TransactionInfo& transactionInfo) const;
@@ -52,5 +58,6 @@ namespace catapult { namespace addressextraction {
 
 	private:
 		std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+		std::shared_ptr<thread::IoThreadPool> m_pPool;
 	};
 }}
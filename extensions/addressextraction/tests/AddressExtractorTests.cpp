@@ -20,8 +20,10 @@
 
 #include "addressextraction/src/AddressExtractor.h"
 #include "catapult/model/Elements.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationPublisher.h"
 #include "tests/TestHarness.h"
 
@@ -34,10 +36,13 @@ namespace catapult { namespace addressextraction {
 
 		class TestContext {
 		public:
-			TestContext()
+			TestContext() : TestContext(nullptr)
+			{}
+
+			explicit TestContext(const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_pNotificationPublisher(std::make_unique<mocks::MockNotificationPublisher>())
 					, m_notificationPublisher(*m_pNotificationPublisher)
-					, m_extractor(std::move(m_pNotificationPublisher))
+					, m_extractor(std::move(m_pNotificationPublisher), pPool)
 			{}
 
 		public:
@@ -124,6 +129,63 @@ namespace catapult { namespace addressextraction {
 		EXPECT_EQ(pAddresses3, transactionInfoSet.find(transactionInfos[3])->OptionalExtractedAddresses);
 	}
 
+	namespace {
+		void AssertCanExtractLargeTransactionInfosSet(const std::shared_ptr<thread::IoThreadPool>& pPool) {
+			// Arrange:
+			TestContext context(pPool);
+			auto pAddresses = std::make_shared<model::UnresolvedAddressSet>();
+
+			// - create 500 infos with every fifth one having addresses
+			auto transactionInfos = test::CreateTransactionInfos(500);
+			for (auto i = 0u; i < transactionInfos.size(); ++i)
+				transactionInfos[i].OptionalExtractedAddresses = 0 == i % 5 ? pAddresses : nullptr;
+
+			auto transactionInfoSet = test::CopyTransactionInfosToSet(transactionInfos);
+
+			// Act:
+			context.extractor().extract(transactionInfoSet);
+
+			// Assert:
+			EXPECT_EQ(400u, context.publisher().numPublishCalls());
+
+			for (auto i = 0u; i < transactionInfos.size(); ++i) {
+				const auto& pExtractedAddresses = transactionInfoSet.find(transactionInfos[i])->OptionalExtractedAddresses;
+				if (0 == i % 5)
+					EXPECT_EQ(pAddresses, pExtractedAddresses) << "info at " << i;
+				else
+					EXPECT_TRUE(pExtractedAddresses && pAddresses != pExtractedAddresses) << "info at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanExtractLargeTransactionInfosSetWithoutPool) {
+		AssertCanExtractLargeTransactionInfosSet(nullptr);
+	}
+
+	TEST(TEST_CLASS, CanExtractLargeTransactionInfosSetWithPool) {
+		AssertCanExtractLargeTransactionInfosSet(test::CreateStartedIoThreadPool(4));
+	}
+
+	TEST(TEST_CLASS, CanExtractSmallTransactionInfosSetWithPool) {
+		// Arrange: set is too small to be partitioned
+		TestContext context(test::CreateStartedIoThreadPool(4));
+
+		auto transactionInfos = test::CreateTransactionInfos(10);
+		for (auto& transactionInfo : transactionInfos)
+			transactionInfo.OptionalExtractedAddresses = nullptr;
+
+		auto transactionInfoSet = test::CopyTransactionInfosToSet(transactionInfos);
+
+		// Act:
+		context.extractor().extract(transactionInfoSet);
+
+		// Assert:
+		EXPECT_EQ(10u, context.publisher().numPublishCalls());
+
+		for (auto& transactionInfo : transactionInfoSet)
+			EXPECT_TRUE(!!transactionInfo.OptionalExtractedAddresses);
+	}
+
 	// endregion
 
 	// region extract (TransactionElement)
@@ -24,6 +24,8 @@
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/crypto/KeyPair.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace harvesting {
@@ -77,12 +79,14 @@ namespace catapult { namespace harvesting {
 			const model::BlockChainConfiguration& config,
 			const Address& beneficiary,
 			const UnlockedAccounts& unlockedAccounts,
-			const BlockGenerator& blockGenerator)
+			const BlockGenerator& blockGenerator,
+			const std::shared_ptr<thread::IoThreadPool>& pPool)
 			: m_cache(cache)
 			, m_config(config)
 			, m_beneficiary(beneficiary)
 			, m_unlockedAccounts(unlockedAccounts)
 			, m_blockGenerator(blockGenerator)
+			, m_pPool(pPool)
 	{}
 
 	std::unique_ptr<model::Block> Harvester::harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp) {
@@ -92,30 +96,19 @@ namespace catapult { namespace harvesting {
 			return nullptr;
 		}
 
-		chain::BlockHitContext hitContext;
-		hitContext.ElapsedTime = context.BlockTime;
-		hitContext.Difficulty = context.Difficulty;
-		hitContext.Height = context.Height;
-
-		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
-		chain::BlockHitPredicate hitPredicate(m_config, [&accountStateCache](const auto& key, auto height) {
-			auto lockedCacheView = accountStateCache.createView();
-			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
-			cache::ImportanceView view(readOnlyCache);
-			return view.getAccountImportanceOrDefault(key, height);
-		});
-
+		// VRF proofs, hits and importances only change with the parent block, so only the target needs to be calculated per attempt
 		auto unlockedAccountsView = m_unlockedAccounts.view();
+		updateAccountHits(unlockedAccountsView, context.ParentContext.GenerationHash, context.Height);
+
 		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
 		crypto::VrfProof vrfProof;
 
-		unlockedAccountsView.forEach([&context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
-			hitContext.Signer = descriptor.signingKeyPair().publicKey();
-
-			vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
-			hitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
-			if (hitPredicate(hitContext)) {
+		unlockedAccountsView.forEach([this, &context, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
+			const auto& accountHit = m_accountHits.find(descriptor.signingKeyPair().publicKey())->second;
+			auto target = chain::CalculateTarget(context.BlockTime, context.Difficulty, accountHit.Importance, m_config);
+			if (accountHit.Hit < target) {
 				pHarvesterKeyPair = &descriptor.signingKeyPair();
+				vrfProof = accountHit.VrfProof;
 				return false;
 			}
 
@@ -135,4 +128,50 @@ namespace catapult { namespace harvesting {
 
 		return pBlock;
 	}
+
+	void Harvester::updateAccountHits(
+			const UnlockedAccountsView& unlockedAccountsView,
+			const GenerationHash& parentGenerationHash,
+			Height height) {
+		if (m_accountHitsGenerationHash != parentGenerationHash || m_accountHitsHeight != height) {
+			m_accountHitsGenerationHash = parentGenerationHash;
+			m_accountHitsHeight = height;
+			m_accountHits.clear();
+		}
+
+		// find all unlocked accounts (e.g. newly unlocked ones) without a hit for the current parent block
+		std::vector<const BlockGeneratorAccountDescriptor*> descriptors;
+		unlockedAccountsView.forEach([&accountHits = m_accountHits, &descriptors](const auto& descriptor) {
+			auto iter = accountHits.find(descriptor.signingKeyPair().publicKey());
+			if (accountHits.cend() == iter || descriptor.vrfKeyPair().publicKey() != iter->second.VrfPublicKey)
+				descriptors.push_back(&descriptor);
+
+			return true;
+		});
+
+		if (descriptors.empty())
+			return;
+
+		utils::StackLogger stackLogger("calculating account hits", utils::LogLevel::Trace);
+		auto importanceLookup = [&accountStateCache = m_cache.sub<cache::AccountStateCache>(), height](const auto& key) {
+			auto lockedCacheView = accountStateCache.createView();
+			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
+			cache::ImportanceView view(readOnlyCache);
+			return view.getAccountImportanceOrDefault(key, height);
+		};
+
+		std::vector<AccountHit> accountHits(descriptors.size());
+		auto calculateAccountHit = [&parentGenerationHash, &importanceLookup, &accountHits](const auto* pDescriptor, auto index) {
+			auto& accountHit = accountHits[index];
+			accountHit.VrfPublicKey = pDescriptor->vrfKeyPair().publicKey();
+			accountHit.VrfProof = crypto::GenerateVrfProof(parentGenerationHash, pDescriptor->vrfKeyPair());
+			accountHit.Hit = chain::CalculateHit(model::CalculateGenerationHash(accountHit.VrfProof.Gamma));
+			accountHit.Importance = importanceLookup(pDescriptor->signingKeyPair().publicKey());
+			return true;
+		};
+		thread::ParallelFor(m_pPool->ioContext(), descriptors, m_pPool->numWorkerThreads(), calculateAccountHit).get();
+
+		for (auto i = 0u; i < descriptors.size(); ++i)
+			m_accountHits[descriptors[i]->signingKeyPair().publicKey()] = accountHits[i];
+	}
 }}
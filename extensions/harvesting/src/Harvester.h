@@ -22,11 +22,17 @@
 #include "HarvesterBlockGenerator.h"
 #include "UnlockedAccounts.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/crypto/Vrf.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/Elements.h"
 #include "catapult/model/EntityInfo.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
 
-namespace catapult { namespace harvesting { struct BlockExecutionHashes; } }
+namespace catapult {
+	namespace harvesting { struct BlockExecutionHashes; }
+	namespace thread { class IoThreadPool; }
+}
 
 namespace catapult { namespace harvesting {
 
@@ -35,23 +41,46 @@ namespace catapult { namespace harvesting {
 	public:
 		/// Creates a harvester around catapult \a cache, block chain \a config, \a beneficiary,
 		/// unlocked accounts set (\a unlockedAccounts) and \a blockGenerator used to customize block generation.
+		/// Account hits are calculated once per parent block using \a pPool.
 		Harvester(
 				const cache::CatapultCache& cache,
 				const model::BlockChainConfiguration& config,
 				const Address& beneficiary,
 				const UnlockedAccounts& unlockedAccounts,
-				const BlockGenerator& blockGenerator);
+				const BlockGenerator& blockGenerator,
+				const std::shared_ptr<thread::IoThreadPool>& pPool);
 
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
 		/// Created block will have \a lastBlockElement as parent and \a timestamp as timestamp.
 		std::unique_ptr<model::Block> harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp);
 
+	private:
+		struct AccountHit {
+			Key VrfPublicKey;
+			crypto::VrfProof VrfProof;
+			uint64_t Hit;
+			catapult::Importance Importance;
+		};
+
+		using AccountHits = std::unordered_map<Key, AccountHit, utils::ArrayHasher<Key>>;
+
+		void updateAccountHits(
+				const UnlockedAccountsView& unlockedAccountsView,
+				const catapult::GenerationHash& parentGenerationHash,
+				Height height);
+
 	private:
 		const cache::CatapultCache& m_cache;
 		const model::BlockChainConfiguration m_config;
 		const Address m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
 		BlockGenerator m_blockGenerator;
+		std::shared_ptr<thread::IoThreadPool> m_pPool;
+
+		// hits depend only on the parent generation hash and the harvested height, so they are reused across harvest attempts
+		catapult::GenerationHash m_accountHitsGenerationHash;
+		Height m_accountHitsHeight;
+		AccountHits m_accountHits;
 	};
 }}
@@ -35,6 +35,7 @@
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/EntityRange.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/MultiServicePool.h"
 #include "catapult/utils/HexParser.h"
 
 namespace catapult { namespace harvesting {
@@ -103,9 +104,15 @@ namespace catapult { namespace harvesting {
 			pUnlockedAccountsUpdater->load();
 
 			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, utFacadeFactory, utCache);
-			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
-					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryAddress, unlockedAccounts, blockGenerator));
+			auto pHarvesterPool = state.pool().pushIsolatedPool("harvester");
+			auto pHarvester = std::make_unique<Harvester>(
+					cache,
+					blockChainConfig,
+					beneficiaryAddress,
+					unlockedAccounts,
+					blockGenerator,
+					pHarvesterPool);
+			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(CreateHarvesterTaskOptions(state), std::move(pHarvester));
 
 			return thread::CreateNamedTask("harvesting task", [pUnlockedAccountsUpdater, pHarvesterTask]() {
 				pUnlockedAccountsUpdater->update();
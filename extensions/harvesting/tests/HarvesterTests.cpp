@@ -26,9 +26,11 @@
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/EntityHasher.h"
 #include "catapult/model/TransactionPlugin.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/TestConstants.h"
 #include "tests/test/nodeps/Waits.h"
@@ -101,7 +103,8 @@ namespace catapult { namespace harvesting {
 					, Importances(CreateImportances(Num_Accounts))
 					, pUnlockedAccounts(std::make_unique<UnlockedAccounts>(Num_Accounts, [](const auto&) { return 0; }))
 					, pLastBlock(CreateBlock())
-					, LastBlockElement(test::BlockToBlockElement(*pLastBlock)) {
+					, LastBlockElement(test::BlockToBlockElement(*pLastBlock))
+					, pPool(test::CreateStartedIoThreadPool()) {
 				auto delta = Cache.createDelta();
 				CreateAccounts(delta.sub<cache::AccountStateCache>(), SigningKeyPairs, VrfKeyPairs, Importances);
 
@@ -130,7 +133,7 @@ namespace catapult { namespace harvesting {
 			std::unique_ptr<Harvester> CreateHarvester(
 					const model::BlockChainConfiguration& config,
 					const BlockGenerator& blockGenerator) {
-				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator);
+				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator, pPool);
 			}
 
 			HarvesterDescriptor BestHarvester() const {
@@ -187,6 +190,7 @@ namespace catapult { namespace harvesting {
 			std::unique_ptr<UnlockedAccounts> pUnlockedAccounts;
 			std::shared_ptr<model::Block> pLastBlock;
 			model::BlockElement LastBlockElement;
+			std::shared_ptr<thread::IoThreadPool> pPool;
 		};
 
 		// endregion
@@ -449,6 +453,61 @@ namespace catapult { namespace harvesting {
 		});
 	}
 
+	TEST(TEST_CLASS, HarvestCanUseAccountUnlockedAfterPreviousAttemptWithSameParent) {
+		// Arrange:
+		HarvesterContext context;
+		{
+			auto modifier = context.pUnlockedAccounts->modifier();
+			for (const auto& keyPair : context.SigningKeyPairs)
+				modifier.remove(keyPair.publicKey());
+		}
+
+		auto pHarvester = context.CreateHarvester();
+		auto pBlock1 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// - unlock a single account
+		context.pUnlockedAccounts->modifier().add(BlockGeneratorAccountDescriptor(
+				test::CopyKeyPair(context.SigningKeyPairs[2]),
+				test::CopyKeyPair(context.VrfKeyPairs[2])));
+
+		// Act:
+		auto pBlock2 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock1);
+		ASSERT_TRUE(!!pBlock2);
+		EXPECT_EQ(context.SigningKeyPairs[2].publicKey(), pBlock2->SignerPublicKey);
+	}
+
+	TEST(TEST_CLASS, HarvestCalculatesNewVrfProofWhenParentGenerationHashChanges) {
+		// Arrange:
+		HarvesterContext context;
+		auto pHarvester = context.CreateHarvester();
+		auto generationHash1 = context.LastBlockElement.GenerationHash;
+		auto pBlock1 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		auto generationHash2 = test::GenerateRandomByteArray<GenerationHash>();
+		context.LastBlockElement.GenerationHash = generationHash2;
+
+		// Act:
+		auto pBlock2 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert: each proof was generated for the corresponding parent
+		ASSERT_TRUE(!!pBlock1);
+		ASSERT_TRUE(!!pBlock2);
+		EXPECT_EQ(pBlock1->SignerPublicKey, pBlock2->SignerPublicKey);
+
+		auto signerIter = std::find_if(context.SigningKeyPairs.cbegin(), context.SigningKeyPairs.cend(), [&pBlock1](const auto& keyPair) {
+			return pBlock1->SignerPublicKey == keyPair.publicKey();
+		});
+		ASSERT_NE(context.SigningKeyPairs.cend(), signerIter);
+
+		const auto& vrfPublicKey = context.VrfKeyPairs[static_cast<size_t>(signerIter - context.SigningKeyPairs.cbegin())].publicKey();
+		EXPECT_NE(Hash512(), crypto::VerifyVrfProof(UnpackVrfProof(pBlock1->GenerationHashProof), generationHash1, vrfPublicKey));
+		EXPECT_NE(Hash512(), crypto::VerifyVrfProof(UnpackVrfProof(pBlock2->GenerationHashProof), generationHash2, vrfPublicKey));
+		EXPECT_NE(pBlock1->GenerationHashProof.Gamma, pBlock2->GenerationHashProof.Gamma);
+	}
+
 	TEST(TEST_CLASS, HarvesterRespectsCustomBlockChainConfiguration) {
 		// Arrange: the custom configuration has a much higher target time and uses smoothing. After 24 hours
 		//          the harvester using the default configuration is most likely able to harvest a block
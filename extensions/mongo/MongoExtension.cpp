@@ -103,7 +103,16 @@ namespace catapult { namespace mongo {
 			auto mongoErrorPolicyMode = extensions::ProcessDisposition::Recovery == bootstrapper.disposition()
 					? MongoErrorPolicy::Mode::Idempotent
 					: MongoErrorPolicy::Mode::Strict;
-			auto pMongoContext = std::make_shared<MongoStorageContext>(dbUri, dbName, pMongoBulkWriter, mongoErrorPolicyMode);
+			auto cacheUpdateMode = dbConfig.EnableCacheDiffUpdates
+					? MongoStorageContext::CacheUpdateMode::Diff
+					: MongoStorageContext::CacheUpdateMode::Replace;
+			auto pMongoContext = std::make_shared<MongoStorageContext>(
+					dbUri,
+					dbName,
+					pMongoBulkWriter,
+					mongoErrorPolicyMode,
+					cacheUpdateMode,
+					dbConfig.MaxCacheDiffDigests);
 			auto pPluginManager = std::make_shared<MongoPluginManager>(*pMongoContext, config.BlockChain.Network.Identifier);
 			auto pTransactionRegistry = CreateTransactionRegistry(pPluginManager, config.User.PluginsDirectory, dbConfig.Plugins);
 
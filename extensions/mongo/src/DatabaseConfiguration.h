@@ -39,6 +39,13 @@ namespace catapult { namespace mongo {
 		/// Maximum number of database writer threads.
 		uint32_t MaxWriterThreads;
 
+		/// \c true if only changed fields of modified flat cache elements should be written.
+		/// \note Field digests of recently written flat cache elements are kept in memory.
+		bool EnableCacheDiffUpdates;
+
+		/// Maximum number of element digests kept per flat cache collection when cache diff updates are enabled.
+		uint32_t MaxCacheDiffDigests;
+
 		/// Named database plugins to enable.
 		std::unordered_set<std::string> Plugins;
 
@@ -62,66 +62,119 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("saveBlock failed: block header was not inserted");
 		}
 
+		using BlockElementPointers = std::vector<const model::BlockElement*>;
+
+		std::string DescribeHeights(const std::string& itemsName, const BlockElementPointers& blockElements) {
+			auto firstHeight = blockElements.front()->Block.Height;
+			auto lastHeight = blockElements.back()->Block.Height;
+			if (firstHeight == lastHeight)
+				return itemsName + " at height " + std::to_string(firstHeight.unwrap());
+
+			return itemsName + " at heights " + std::to_string(firstHeight.unwrap()) + " - " + std::to_string(lastHeight.unwrap());
+		}
+
+		void SaveBlockHeaders(MongoBulkWriter& bulkWriter, const BlockElementPointers& blockElements, const MongoErrorPolicy& errorPolicy) {
+			auto results = bulkWriter.bulkInsert("blocks", blockElements, [](const auto* pBlockElement, auto) {
+				return mappers::ToDbModel(*pBlockElement);
+			}).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
+			errorPolicy.checkInserted(blockElements.size(), aggregateResult, DescribeHeights("blocks", blockElements));
+		}
+
+		struct BlockTransaction {
+			Height BlockHeight;
+			uint32_t Index;
+			const model::TransactionElement* pTransactionElement;
+		};
+
 		void SaveTransactions(
 				MongoBulkWriter& bulkWriter,
-				Height height,
-				const std::vector<model::TransactionElement>& transactions,
+				const BlockElementPointers& blockElements,
 				const MongoTransactionRegistry& registry,
 				const MongoErrorPolicy& errorPolicy) {
+			// flatten transactions of all blocks so that they are mapped in parallel and inserted with a single bulk insert
+			std::vector<BlockTransaction> transactions;
+			for (const auto* pBlockElement : blockElements) {
+				auto index = 0u;
+				for (const auto& transactionElement : pBlockElement->Transactions)
+					transactions.push_back({ pBlockElement->Block.Height, index++, &transactionElement });
+			}
+
 			std::atomic<size_t> numTotalTransactionDocuments(0);
-			auto createDocuments = [height, &registry, &numTotalTransactionDocuments](const auto& transactionElement, auto index) {
-				auto metadata = MongoTransactionMetadata(transactionElement, height, index);
+			auto createDocuments = [&registry, &numTotalTransactionDocuments](const auto& transaction, auto) {
+				const auto& transactionElement = *transaction.pTransactionElement;
+				auto metadata = MongoTransactionMetadata(transactionElement, transaction.BlockHeight, transaction.Index);
 				auto documents = mappers::ToDbDocuments(transactionElement.Transaction, metadata, registry);
 				numTotalTransactionDocuments += documents.size();
 				return documents;
 			};
 			auto results = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
 			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
+			errorPolicy.checkInserted(numTotalTransactionDocuments, aggregateResult, DescribeHeights("transactions", blockElements));
+		}
+
+		template<typename TStatementMap>
+		using HeightStatementPairs = std::vector<std::pair<Height, const typename TStatementMap::mapped_type*>>;
 
-			auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
-			errorPolicy.checkInserted(numTotalTransactionDocuments, aggregateResult, itemsDescription);
+		template<typename TStatementMap>
+		void CollectStatements(HeightStatementPairs<TStatementMap>& statements, Height height, const TStatementMap& statementMap) {
+			for (const auto& pair : statementMap)
+				statements.emplace_back(height, &pair.second);
 		}
 
-		void SaveBlockStatement(
+		void SaveBlockStatements(
 				MongoBulkWriter& bulkWriter,
-				Height height,
-				const model::BlockStatement& blockStatement,
+				const BlockElementPointers& blockElements,
 				const MongoReceiptRegistry& registry,
 				const MongoErrorPolicy& errorPolicy) {
 			using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
 
+			HeightStatementPairs<decltype(model::BlockStatement::TransactionStatements)> transactionStatements;
+			HeightStatementPairs<decltype(model::BlockStatement::AddressResolutionStatements)> addressResolutionStatements;
+			HeightStatementPairs<decltype(model::BlockStatement::MosaicResolutionStatements)> mosaicResolutionStatements;
+			for (const auto* pBlockElement : blockElements) {
+				if (!pBlockElement->OptionalStatement)
+					continue;
+
+				auto height = pBlockElement->Block.Height;
+				const auto& blockStatement = *pBlockElement->OptionalStatement;
+				CollectStatements(transactionStatements, height, blockStatement.TransactionStatements);
+				CollectStatements(addressResolutionStatements, height, blockStatement.AddressResolutionStatements);
+				CollectStatements(mosaicResolutionStatements, height, blockStatement.MosaicResolutionStatements);
+			}
+
 			std::vector<BulkWriteResultFuture> futures;
 			std::vector<size_t> numExpectedInserts;
 
 			// transaction statements
-			numExpectedInserts.emplace_back(blockStatement.TransactionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("transactionStatements", blockStatement.TransactionStatements, [height, &registry](
+			numExpectedInserts.emplace_back(transactionStatements.size());
+			futures.emplace_back(bulkWriter.bulkInsert("transactionStatements", transactionStatements, [&registry](
 					const auto& pair,
 					auto) {
-				return mappers::ToDbModel(height, pair.second, registry);
+				return mappers::ToDbModel(pair.first, *pair.second, registry);
 			}));
 
 			// address resolution statements
-			numExpectedInserts.emplace_back(blockStatement.AddressResolutionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("addressResolutionStatements", blockStatement.AddressResolutionStatements, [height](
+			numExpectedInserts.emplace_back(addressResolutionStatements.size());
+			futures.emplace_back(bulkWriter.bulkInsert("addressResolutionStatements", addressResolutionStatements, [](
 					const auto& pair,
 					auto) {
-				return mappers::ToDbModel(height, pair.second);
+				return mappers::ToDbModel(pair.first, *pair.second);
 			}));
 
 			// mosaic resolution statements
-			numExpectedInserts.emplace_back(blockStatement.MosaicResolutionStatements.size());
-			futures.emplace_back(bulkWriter.bulkInsert("mosaicResolutionStatements", blockStatement.MosaicResolutionStatements, [height](
+			numExpectedInserts.emplace_back(mosaicResolutionStatements.size());
+			futures.emplace_back(bulkWriter.bulkInsert("mosaicResolutionStatements", mosaicResolutionStatements, [](
 					const auto& pair,
 					auto) {
-				return mappers::ToDbModel(height, pair.second);
+				return mappers::ToDbModel(pair.first, *pair.second);
 			}));
 
-			auto statementsFuture = thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](
+			auto itemsDescription = DescribeHeights("statements", blockElements);
+			auto statementsFuture = thread::when_all(std::move(futures)).then([numExpectedInserts, itemsDescription, &errorPolicy](
 					auto&& resultsFuture) {
 				auto insertResultsContainer = resultsFuture.get();
 				auto i = 0u;
-				auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
 				for (auto& insertResults : insertResultsContainer) {
 					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults.get())));
 					errorPolicy.checkInserted(numExpectedInserts[i], aggregateResult, itemsDescription);
@@ -200,13 +253,47 @@ namespace catapult { namespace mongo {
 				}
 
 				SaveBlockHeader(m_database, blockElement);
-				SaveTransactions(m_context.bulkWriter(), height, blockElement.Transactions, m_transactionRegistry, m_errorPolicy);
+
+				BlockElementPointers blockElements{ &blockElement };
+				SaveTransactions(m_context.bulkWriter(), blockElements, m_transactionRegistry, m_errorPolicy);
 				if (blockElement.OptionalStatement)
-					SaveBlockStatement(m_context.bulkWriter(), height, *blockElement.OptionalStatement, m_receiptRegistry, m_errorPolicy);
+					SaveBlockStatements(m_context.bulkWriter(), blockElements, m_receiptRegistry, m_errorPolicy);
 
 				setHeight(blockElement.Block.Height);
 			}
 
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				if (blockElements.empty())
+					return;
+
+				auto startHeight = blockElements.front().Block.Height;
+				if (MongoErrorPolicy::Mode::Idempotent == m_errorPolicy.mode())
+					dropBlocksAfter(startHeight - Height(1));
+
+				auto dbHeight = chainHeight();
+				BlockElementPointers blockElementPointers;
+				blockElementPointers.reserve(blockElements.size());
+				for (const auto& blockElement : blockElements) {
+					auto height = blockElement.Block.Height;
+					auto expectedHeight = dbHeight + Height(1 + blockElementPointers.size());
+					if (height != expectedHeight) {
+						std::ostringstream out;
+						out << "cannot save block with height " << height << " when expected height is " << expectedHeight;
+						CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+					}
+
+					blockElementPointers.push_back(&blockElement);
+				}
+
+				// map and insert all blocks in the batch together with a single bulk insert per collection
+				auto& bulkWriter = m_context.bulkWriter();
+				SaveBlockHeaders(bulkWriter, blockElementPointers, m_errorPolicy);
+				SaveTransactions(bulkWriter, blockElementPointers, m_transactionRegistry, m_errorPolicy);
+				SaveBlockStatements(bulkWriter, blockElementPointers, m_receiptRegistry, m_errorPolicy);
+
+				setHeight(blockElements.back().Block.Height);
+			}
+
 			void dropBlocksAfter(Height height) override {
 				auto dbHeight = chainHeight();
 				if (dbHeight <= height)
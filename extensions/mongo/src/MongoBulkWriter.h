@@ -64,6 +64,9 @@ namespace catapult { namespace mongo {
 		template<typename TEntity>
 		using AppendOperation = consumer<mongocxx::bulk_write&, const TEntity&, uint32_t>;
 
+		template<typename TEntity>
+		using ConditionalAppendOperation = predicate<mongocxx::bulk_write&, const TEntity&, uint32_t>;
+
 		template<typename TEntity>
 		using CreateDocument = std::function<bsoncxx::document::value (const TEntity&, uint32_t)>;
 
@@ -160,6 +163,16 @@ namespace catapult { namespace mongo {
 			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
 		}
 
+		/// Writes \a entities into the collection named \a collectionName using custom operations (\a appendOperation).
+		/// \note \a appendOperation can append any number of (mixed) operations and returns \c false if it did not append any.
+		template<typename TContainer>
+		BulkWriteResultFuture bulkApply(
+				const std::string& collectionName,
+				const TContainer& entities,
+				const ConditionalAppendOperation<typename TContainer::value_type>& appendOperation) {
+			return bulkWriteConditional<TContainer>(collectionName, entities, appendOperation);
+		}
+
 	private:
 		thread::future<BulkWriteResult> handleBulkOperation(std::shared_ptr<BulkWriteParams>&& pBulkWriteParams) {
 			// note: pBulkWriteParams depends on pThis (pBulkWriteParams.pConnection depends on pThis.m_connectionPool)
@@ -213,6 +226,18 @@ namespace catapult { namespace mongo {
 				const std::string& collectionName,
 				const TContainer& entities,
 				const AppendOperation<typename TContainer::value_type>& appendOperation) {
+			auto conditionalAppendOperation = [appendOperation](auto& bulk, const auto& entity, auto index) {
+				appendOperation(bulk, entity, index);
+				return true;
+			};
+			return bulkWriteConditional<TContainer>(collectionName, entities, conditionalAppendOperation);
+		}
+
+		template<typename TEntity, typename TContainer>
+		BulkWriteResultFuture bulkWriteConditional(
+				const std::string& collectionName,
+				const TContainer& entities,
+				const ConditionalAppendOperation<typename TContainer::value_type>& appendOperation) {
 			if (entities.empty())
 				return thread::make_ready_future(std::vector<thread::future<BulkWriteResult>>());
 
@@ -225,9 +250,16 @@ namespace catapult { namespace mongo {
 					auto batchIndex) {
 				auto pBulkWriteParams = std::make_shared<BulkWriteParams>(*pThis, collectionName);
 
+				auto hasOperations = false;
 				auto index = static_cast<uint32_t>(startIndex);
 				for (auto iter = itBegin; itEnd != iter; ++iter, ++index)
-					appendOperation(pBulkWriteParams->Bulk, *iter, index);
+					hasOperations = appendOperation(pBulkWriteParams->Bulk, *iter, index) || hasOperations;
+
+				// mongo rejects empty bulk writes
+				if (!hasOperations) {
+					pContext->setFutureAt(batchIndex, thread::make_ready_future(BulkWriteResult()));
+					return;
+				}
 
 				pContext->setFutureAt(batchIndex, pThis->handleBulkOperation(std::move(pBulkWriteParams)));
 			};
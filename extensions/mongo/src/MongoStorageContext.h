@@ -28,21 +28,36 @@ namespace catapult { namespace mongo {
 
 	/// Context for creating a mongo storage.
 	class MongoStorageContext {
+	public:
+		/// Cache update modes.
+		enum class CacheUpdateMode {
+			/// Modified cache elements are replaced with fully mapped documents.
+			Replace,
+
+			/// Only fields of modified cache elements that changed since they were last written are updated.
+			Diff
+		};
+
 	public:
 		/// Creates an empty storage context.
 		MongoStorageContext() = default;
 
 		/// Creates a storage context for a mongodb-based storage connected to \a uri storing inside database \a databaseName
-		/// with the specified bulk writer (\a pBulkWriter) and error policy mode (\a errorPolicyMode).
+		/// with the specified bulk writer (\a pBulkWriter), error policy mode (\a errorPolicyMode), cache update mode
+		/// (\a cacheUpdateMode) and maximum number of element digests kept per collection in diff mode (\a maxCacheDiffDigests).
 		MongoStorageContext(
 				const mongocxx::uri& uri,
 				const std::string& databaseName,
 				const std::shared_ptr<MongoBulkWriter>& pBulkWriter,
-				MongoErrorPolicy::Mode errorPolicyMode)
+				MongoErrorPolicy::Mode errorPolicyMode,
+				CacheUpdateMode cacheUpdateMode = CacheUpdateMode::Replace,
+				size_t maxCacheDiffDigests = 0)
 				: m_connectionPool(uri)
 				, m_databaseName(databaseName)
 				, m_pBulkWriter(pBulkWriter)
 				, m_errorPolicyMode(errorPolicyMode)
+				, m_cacheUpdateMode(cacheUpdateMode)
+				, m_maxCacheDiffDigests(maxCacheDiffDigests)
 		{}
 
 	public:
@@ -61,10 +76,22 @@ namespace catapult { namespace mongo {
 			return *m_pBulkWriter;
 		}
 
+		/// Gets the cache update mode.
+		CacheUpdateMode cacheUpdateMode() const {
+			return m_cacheUpdateMode;
+		}
+
+		/// Gets the maximum number of element digests kept per collection in diff mode.
+		size_t maxCacheDiffDigests() const {
+			return m_maxCacheDiffDigests;
+		}
+
 	private:
 		mongocxx::pool m_connectionPool;
 		std::string m_databaseName;
 		std::shared_ptr<MongoBulkWriter> m_pBulkWriter;
 		MongoErrorPolicy::Mode m_errorPolicyMode;
+		CacheUpdateMode m_cacheUpdateMode;
+		size_t m_maxCacheDiffDigests;
 	};
 }}
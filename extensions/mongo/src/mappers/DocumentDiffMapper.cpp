@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "DocumentDiffMapper.h"
+#include "MapperUtils.h"
+#include "catapult/crypto/Hashes.h"
+#include <cstring>
+
+namespace catapult { namespace mongo { namespace mappers {
+
+	namespace {
+		uint64_t ToDigest(const Hash256& hash) {
+			uint64_t digest;
+			std::memcpy(&digest, hash.data(), sizeof(uint64_t));
+			return digest;
+		}
+
+		std::string ToString(bsoncxx::stdx::string_view key) {
+			return std::string(key.data(), key.size());
+		}
+
+		template<typename TAction>
+		void ForEachElement(const bsoncxx::document::view& document, TAction action) {
+			// element bytes are delimited by the offset of the next element or by the document terminator
+			for (auto iter = document.cbegin(); document.cend() != iter;) {
+				auto element = *iter;
+				auto nextIter = ++iter;
+				auto endOffset = document.cend() == nextIter ? document.length() - 1 : (*nextIter).offset();
+				action(element, RawBuffer(element.raw() + element.offset(), endOffset - element.offset()));
+			}
+		}
+
+		template<typename TAction>
+		void ForEachField(const bsoncxx::document::view& document, TAction action) {
+			ForEachElement(document, [action](const auto& element, const auto& elementBuffer) {
+				auto subDocument = bsoncxx::type::k_document == element.type()
+						? element.get_document().value
+						: bsoncxx::document::view();
+				if (subDocument.empty()) {
+					action(ToString(element.key()), element, elementBuffer);
+					return;
+				}
+
+				auto pathPrefix = ToString(element.key()) + ".";
+				ForEachElement(subDocument, [action, &pathPrefix](const auto& subElement, const auto& subElementBuffer) {
+					action(pathPrefix + ToString(subElement.key()), subElement, subElementBuffer);
+				});
+			});
+		}
+	}
+
+	DocumentDigests CalculateDocumentDigests(const bsoncxx::document::view& document) {
+		DocumentDigests digests;
+		crypto::Sha3_256_Builder layoutHashBuilder;
+		ForEachField(document, [&digests, &layoutHashBuilder](const auto& path, const auto&, const auto& fieldBuffer) {
+			// include terminating NUL in order to separate paths
+			layoutHashBuilder.update(RawBuffer(reinterpret_cast<const uint8_t*>(path.c_str()), path.size() + 1));
+
+			Hash256 fieldHash;
+			crypto::Sha3_256(fieldBuffer, fieldHash);
+			digests.FieldDigests.push_back(ToDigest(fieldHash));
+		});
+
+		Hash256 layoutHash;
+		layoutHashBuilder.final(layoutHash);
+		digests.LayoutDigest = ToDigest(layoutHash);
+		return digests;
+	}
+
+	bsoncxx::document::value ToSetUpdateDbModel(const bsoncxx::document::view& document, const DocumentDigests& previousDigests) {
+		bson_stream::document builder;
+		auto setContext = builder << "$set" << bson_stream::open_document;
+
+		auto index = 0u;
+		ForEachField(document, [&previousDigests, &setContext, &index](const auto& path, const auto& element, const auto& fieldBuffer) {
+			Hash256 fieldHash;
+			crypto::Sha3_256(fieldBuffer, fieldHash);
+			if (index >= previousDigests.FieldDigests.size() || previousDigests.FieldDigests[index] != ToDigest(fieldHash))
+				setContext << path << element.get_value();
+
+			++index;
+		});
+
+		setContext << bson_stream::close_document;
+		return builder << bson_stream::finalize;
+	}
+}}}
@@ -0,0 +1,43 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "MapperInclude.h"
+#include <vector>
+
+namespace catapult { namespace mongo { namespace mappers {
+
+	/// Digests of the fields of a db model.
+	/// \note Fields of top level sub-documents are digested individually.
+	struct DocumentDigests {
+		/// Digest of the paths of all fields.
+		uint64_t LayoutDigest;
+
+		/// Digests of all fields.
+		std::vector<uint64_t> FieldDigests;
+	};
+
+	/// Calculates the field digests of \a document.
+	DocumentDigests CalculateDocumentDigests(const bsoncxx::document::view& document);
+
+	/// Maps all fields of \a document that differ from \a previousDigests to a \c $set update document.
+	/// \note \a document must have the same layout as the document used to calculate \a previousDigests.
+	bsoncxx::document::value ToSetUpdateDbModel(const bsoncxx::document::view& document, const DocumentDigests& previousDigests);
+}}}
@@ -21,8 +21,11 @@
 #pragma once
 #include "mongo/src/MongoBulkWriter.h"
 #include "mongo/src/MongoStorageContext.h"
+#include "mongo/src/mappers/DocumentDiffMapper.h"
 #include "mongo/src/mappers/MapperUtils.h"
 #include "catapult/thread/FutureUtils.h"
+#include <list>
+#include <map>
 #include <set>
 #include <unordered_set>
 
@@ -197,6 +200,9 @@ namespace catapult { namespace mongo { namespace storages {
 	};
 
 	/// Mongo cache storage that persists flat cache data using delete and upsert.
+	/// \note In diff mode, modified elements only have the fields that changed since they were last written updated
+	///       and all removals, updates and upserts are written together. Digests are only kept for the most recently
+	///       written elements, so other elements are fully upserted.
 	template<typename TCacheTraits>
 	class MongoFlatCacheStorage : public ExternalCacheStorageT<typename TCacheTraits::CacheType> {
 	private:
@@ -204,6 +210,20 @@ namespace catapult { namespace mongo { namespace storages {
 		using KeyType = typename TCacheTraits::KeyType;
 		using ModelType = typename TCacheTraits::ModelType;
 		using ElementContainerType = std::unordered_set<const ModelType*>;
+		using CacheUpdateMode = MongoStorageContext::CacheUpdateMode;
+
+		struct ElementWrite {
+			const ModelType* pModel;
+			bool IsRemoved;
+			const mappers::DocumentDigests* pPreviousDigests;
+		};
+
+		using KeyList = std::list<KeyType>;
+
+		struct DigestsEntry {
+			mappers::DocumentDigests Digests;
+			typename KeyList::iterator KeyIter;
+		};
 
 	public:
 		/// Creates a cache storage around \a storageContext and \a networkIdentifier.
@@ -212,6 +232,8 @@ namespace catapult { namespace mongo { namespace storages {
 				, m_errorPolicy(storageContext.createCollectionErrorPolicy(TCacheTraits::Collection_Name))
 				, m_bulkWriter(storageContext.bulkWriter())
 				, m_networkIdentifier(networkIdentifier)
+				, m_cacheUpdateMode(storageContext.cacheUpdateMode())
+				, m_maxDigests(storageContext.maxCacheDiffDigests())
 		{}
 
 	private:
@@ -223,11 +245,17 @@ namespace catapult { namespace mongo { namespace storages {
 			// 1. remove elements common to both added and removed
 			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
 
+			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
+			if (CacheUpdateMode::Diff == m_cacheUpdateMode) {
+				// 2. remove, update and upsert elements with a single bulk write
+				writeAll(modifiedElements, removedElements);
+				return;
+			}
+
 			// 2. remove all removed elements from db
 			removeAll(removedElements);
 
 			// 3. upsert new elements and modified elements into db
-			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
 			upsertAll(modifiedElements);
 		}
 
@@ -253,6 +281,125 @@ namespace catapult { namespace mongo { namespace storages {
 			m_errorPolicy.checkUpserted(elements.size(), aggregateResult, "modified and added elements");
 		}
 
+		void writeAll(const ElementContainerType& savedElements, const ElementContainerType& removedElements) {
+			if (savedElements.empty() && removedElements.empty())
+				return;
+
+			// elements that are both removed and saved are only (fully) upserted because writes can be reordered
+			auto removedIds = GetIds(removedElements);
+			auto savedIds = GetIds(savedElements);
+
+			std::vector<ElementWrite> writes;
+			writes.reserve(savedElements.size() + removedElements.size());
+			for (const auto* pModel : removedElements) {
+				if (savedIds.cend() == savedIds.find(TCacheTraits::GetId(*pModel)))
+					writes.push_back({ pModel, true, nullptr });
+			}
+
+			auto numRemoved = writes.size();
+			for (const auto* pModel : savedElements) {
+				auto key = TCacheTraits::GetId(*pModel);
+				auto iter = removedIds.cend() == removedIds.find(key) ? m_digestsMap.find(key) : m_digestsMap.end();
+				writes.push_back({ pModel, false, m_digestsMap.end() == iter ? nullptr : &iter->second.Digests });
+			}
+
+			// each write has its own digests slot, so no synchronization is needed when writes are processed in parallel
+			std::vector<mappers::DocumentDigests> allDigests(writes.size());
+			auto appendOperation = [networkIdentifier = m_networkIdentifier, &allDigests](auto& bulk, const auto& write, auto index) {
+				return AppendOperation(bulk, write, networkIdentifier, allDigests[index]);
+			};
+			auto writeResults = m_bulkWriter.bulkApply(TCacheTraits::Collection_Name, writes, appendOperation).get();
+			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(writeResults)));
+
+			auto numSaved = 0u;
+			for (auto i = numRemoved; i < writes.size(); ++i) {
+				if (!IsUnchanged(writes[i].pPreviousDigests, allDigests[i]))
+					++numSaved;
+			}
+
+			m_errorPolicy.checkDeleted(numRemoved, aggregateResult, "removed elements");
+			m_errorPolicy.checkUpserted(numSaved, aggregateResult, "modified and added elements");
+
+			// only update digests after all writes succeeded
+			for (auto i = 0u; i < writes.size(); ++i) {
+				auto key = TCacheTraits::GetId(*writes[i].pModel);
+				if (writes[i].IsRemoved)
+					removeDigests(key);
+				else
+					setDigests(key, std::move(allDigests[i]));
+			}
+		}
+
+		void removeDigests(const KeyType& key) {
+			auto iter = m_digestsMap.find(key);
+			if (m_digestsMap.end() == iter)
+				return;
+
+			m_digestKeys.erase(iter->second.KeyIter);
+			m_digestsMap.erase(iter);
+		}
+
+		void setDigests(const KeyType& key, mappers::DocumentDigests&& digests) {
+			auto iter = m_digestsMap.find(key);
+			if (m_digestsMap.end() != iter) {
+				iter->second.Digests = std::move(digests);
+				m_digestKeys.splice(m_digestKeys.begin(), m_digestKeys, iter->second.KeyIter);
+			} else {
+				m_digestKeys.push_front(key);
+				m_digestsMap.emplace(key, DigestsEntry{ std::move(digests), m_digestKeys.begin() });
+			}
+
+			// evict digests of least recently written elements
+			while (m_digestsMap.size() > m_maxDigests) {
+				m_digestsMap.erase(m_digestKeys.back());
+				m_digestKeys.pop_back();
+			}
+		}
+
+	private:
+		static bool AppendOperation(
+				mongocxx::bulk_write& bulk,
+				const ElementWrite& write,
+				model::NetworkIdentifier networkIdentifier,
+				mappers::DocumentDigests& digests) {
+			auto filter = CreateFilter(write.pModel);
+			if (write.IsRemoved) {
+				bulk.append(mongocxx::model::delete_many(filter.view()));
+				return true;
+			}
+
+			auto document = TCacheTraits::MapToMongoDocument(*write.pModel, networkIdentifier);
+			digests = mappers::CalculateDocumentDigests(document.view());
+			if (IsUnchanged(write.pPreviousDigests, digests))
+				return false;
+
+			if (write.pPreviousDigests && write.pPreviousDigests->LayoutDigest == digests.LayoutDigest) {
+				auto update = mappers::ToSetUpdateDbModel(document.view(), *write.pPreviousDigests);
+				bulk.append(mongocxx::model::update_one(filter.view(), update.view()));
+				return true;
+			}
+
+			// element was not written before or its layout changed
+			mongocxx::model::replace_one replace_op(filter.view(), document.view());
+			replace_op.upsert(true);
+			bulk.append(replace_op);
+			return true;
+		}
+
+		static std::set<KeyType> GetIds(const ElementContainerType& elements) {
+			std::set<KeyType> ids;
+			for (const auto* pModel : elements)
+				ids.insert(TCacheTraits::GetId(*pModel));
+
+			return ids;
+		}
+
+		static bool IsUnchanged(const mappers::DocumentDigests* pPreviousDigests, const mappers::DocumentDigests& digests) {
+			return pPreviousDigests
+					&& pPreviousDigests->LayoutDigest == digests.LayoutDigest
+					&& pPreviousDigests->FieldDigests == digests.FieldDigests;
+		}
+
 	private:
 		static bsoncxx::document::value CreateFilter(const ModelType* pModel) {
 			return CreateFilterByKey(TCacheTraits::GetId(*pModel));
@@ -269,5 +416,9 @@ namespace catapult { namespace mongo { namespace storages {
 		MongoErrorPolicy m_errorPolicy;
 		MongoBulkWriter& m_bulkWriter;
 		model::NetworkIdentifier m_networkIdentifier;
+		CacheUpdateMode m_cacheUpdateMode;
+		size_t m_maxDigests;
+		std::map<KeyType, DigestsEntry> m_digestsMap;
+		KeyList m_digestKeys;
 	};
 }}}
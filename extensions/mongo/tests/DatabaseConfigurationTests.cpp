@@ -37,7 +37,9 @@ namespace catapult { namespace mongo {
 						{
 							{ "databaseUri", "mongodb://hostname:port" },
 							{ "databaseName", "foo" },
-							{ "maxWriterThreads", "3" }
+							{ "maxWriterThreads", "3" },
+							{ "enableCacheDiffUpdates", "true" },
+							{ "maxCacheDiffDigests", "1234" }
 						}
 					},
 					{
@@ -60,6 +62,8 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("", config.DatabaseUri);
 				EXPECT_EQ("", config.DatabaseName);
 				EXPECT_EQ(0u, config.MaxWriterThreads);
+				EXPECT_FALSE(config.EnableCacheDiffUpdates);
+				EXPECT_EQ(0u, config.MaxCacheDiffDigests);
 				EXPECT_EQ(std::unordered_set<std::string>(), config.Plugins);
 			}
 
@@ -68,6 +72,8 @@ namespace catapult { namespace mongo {
 				EXPECT_EQ("mongodb://hostname:port", config.DatabaseUri);
 				EXPECT_EQ("foo", config.DatabaseName);
 				EXPECT_EQ(3u, config.MaxWriterThreads);
+				EXPECT_TRUE(config.EnableCacheDiffUpdates);
+				EXPECT_EQ(1234u, config.MaxCacheDiffDigests);
 				EXPECT_EQ(std::unordered_set<std::string>({ "Alpha", "gamma" }), config.Plugins);
 			}
 		};
@@ -90,6 +96,8 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ("mongodb://127.0.0.1:27017", config.DatabaseUri);
 		EXPECT_EQ("catapult", config.DatabaseName);
 		EXPECT_EQ(8u, config.MaxWriterThreads);
+		EXPECT_FALSE(config.EnableCacheDiffUpdates);
+		EXPECT_EQ(100'000u, config.MaxCacheDiffDigests);
 		EXPECT_FALSE(config.Plugins.empty());
 	}
 
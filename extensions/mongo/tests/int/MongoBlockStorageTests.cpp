@@ -659,6 +659,101 @@ namespace catapult { namespace mongo {
 
 	// endregion
 
+	// region saveBlocks
+
+	namespace {
+		auto CopyElements(const std::vector<model::BlockElement>& elements, size_t startIndex, size_t count) {
+			std::vector<model::BlockElement> batch;
+			for (auto i = startIndex; i < startIndex + count; ++i)
+				batch.push_back(elements[i]);
+
+			return batch;
+		}
+
+		void AssertAllBlocksAreSaved(TestContext& context) {
+			ASSERT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+
+			BlockElementCounts blockElementCounts;
+			for (const auto& blockElement : context.elements()) {
+				AssertEqual(blockElement);
+				blockElementCounts.AddCounts(blockElement);
+			}
+
+			AssertCollectionSizes(blockElementCounts);
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlocksHasNoEffectWhenBatchIsEmpty) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+
+		// Act:
+		context.storage().saveBlocks({});
+
+		// Assert:
+		EXPECT_EQ(Height(), context.storage().chainHeight());
+		AssertCollectionSizes(BlockElementCounts());
+	}
+
+	TEST(TEST_CLASS, CanSaveMultipleBlocksInSingleBatch) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+
+		// Act:
+		context.storage().saveBlocks(context.elements());
+
+		// Assert:
+		AssertAllBlocksAreSaved(context);
+	}
+
+	TEST(TEST_CLASS, CanSaveMultipleBlocksInMultipleBatches) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+
+		// Act:
+		context.storage().saveBlocks(CopyElements(context.elements(), 0, 3));
+		context.storage().saveBlock(context.elements()[3]);
+		context.storage().saveBlocks(CopyElements(context.elements(), 4, Multiple_Blocks_Count - 4));
+
+		// Assert:
+		AssertAllBlocksAreSaved(context);
+	}
+
+	TEST(TEST_CLASS, CannotSaveBatchWithOutOfOrderBlocks) {
+		// Arrange: skip the block at height 3
+		TestContext context(Multiple_Blocks_Count);
+		auto elements = CopyElements(context.elements(), 0, 2);
+		elements.push_back(context.elements()[3]);
+
+		// Act + Assert:
+		EXPECT_THROW(context.storage().saveBlocks(elements), catapult_invalid_argument);
+		EXPECT_EQ(Height(), context.storage().chainHeight());
+	}
+
+	TEST(TEST_CLASS, CannotSaveBatchNotStartingAtNextHeight) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		context.storage().saveBlocks(CopyElements(context.elements(), 0, 3));
+
+		// Act + Assert:
+		EXPECT_THROW(context.storage().saveBlocks(CopyElements(context.elements(), 4, 3)), catapult_invalid_argument);
+		EXPECT_EQ(Height(3), context.storage().chainHeight());
+	}
+
+	TEST(TEST_CLASS, CanSaveSameBatchTwiceWhenErrorModeIsIdempotent) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, MongoErrorPolicy::Mode::Idempotent);
+		context.storage().saveBlocks(context.elements());
+
+		// Act:
+		context.storage().saveBlocks(context.elements());
+
+		// Assert:
+		AssertAllBlocksAreSaved(context);
+	}
+
+	// endregion
+
 	// region dropBlocksAfter
 
 	TEST(TEST_CLASS, CanDropBlocks) {
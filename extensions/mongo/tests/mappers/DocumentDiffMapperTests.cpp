@@ -0,0 +1,174 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "mongo/src/mappers/DocumentDiffMapper.h"
+#include "mongo/src/mappers/MapperUtils.h"
+#include "mongo/tests/test/MapperTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace mongo { namespace mappers {
+
+#define TEST_CLASS DocumentDiffMapperTests
+
+	namespace {
+		auto CreateDbModel(int64_t balance, int64_t height, const std::string& name = "alpha") {
+			return bson_stream::document()
+					<< "account" << bson_stream::open_document
+						<< "name" << name
+						<< "balance" << balance
+						<< "details" << bson_stream::open_document
+							<< "height" << height
+						<< bson_stream::close_document
+					<< bson_stream::close_document
+					<< "version" << 1
+					<< bson_stream::finalize;
+		}
+
+		auto CreateDbModelWithoutName(int64_t balance, int64_t height) {
+			return bson_stream::document()
+					<< "account" << bson_stream::open_document
+						<< "balance" << balance
+						<< "details" << bson_stream::open_document
+							<< "height" << height
+						<< bson_stream::close_document
+					<< bson_stream::close_document
+					<< "version" << 1
+					<< bson_stream::finalize;
+		}
+	}
+
+	// region CalculateDocumentDigests
+
+	TEST(TEST_CLASS, CanCalculateDigestsOfEmptyDocument) {
+		// Arrange:
+		auto dbModel = bson_stream::document() << bson_stream::finalize;
+
+		// Act:
+		auto digests = CalculateDocumentDigests(dbModel.view());
+
+		// Assert:
+		EXPECT_TRUE(digests.FieldDigests.empty());
+	}
+
+	TEST(TEST_CLASS, CalculateDocumentDigestsDigestsAllTopLevelSubDocumentFields) {
+		// Act: account.name, account.balance, account.details, version
+		auto digests = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+
+		// Assert:
+		EXPECT_EQ(4u, digests.FieldDigests.size());
+	}
+
+	TEST(TEST_CLASS, CalculateDocumentDigestsIsDeterministic) {
+		// Act:
+		auto digests1 = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+		auto digests2 = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+
+		// Assert:
+		EXPECT_EQ(digests1.LayoutDigest, digests2.LayoutDigest);
+		EXPECT_EQ(digests1.FieldDigests, digests2.FieldDigests);
+	}
+
+	TEST(TEST_CLASS, CalculateDocumentDigestsOnlyChangesDigestsOfChangedFields) {
+		// Act:
+		auto digests1 = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+		auto digests2 = CalculateDocumentDigests(CreateDbModel(200, 10).view());
+		auto digests3 = CalculateDocumentDigests(CreateDbModel(100, 20).view());
+
+		// Assert: layouts are equal
+		EXPECT_EQ(digests1.LayoutDigest, digests2.LayoutDigest);
+		EXPECT_EQ(digests1.LayoutDigest, digests3.LayoutDigest);
+
+		// - only balance changed
+		ASSERT_EQ(4u, digests2.FieldDigests.size());
+		EXPECT_EQ(digests1.FieldDigests[0], digests2.FieldDigests[0]);
+		EXPECT_NE(digests1.FieldDigests[1], digests2.FieldDigests[1]);
+		EXPECT_EQ(digests1.FieldDigests[2], digests2.FieldDigests[2]);
+		EXPECT_EQ(digests1.FieldDigests[3], digests2.FieldDigests[3]);
+
+		// - only details changed
+		ASSERT_EQ(4u, digests3.FieldDigests.size());
+		EXPECT_EQ(digests1.FieldDigests[0], digests3.FieldDigests[0]);
+		EXPECT_EQ(digests1.FieldDigests[1], digests3.FieldDigests[1]);
+		EXPECT_NE(digests1.FieldDigests[2], digests3.FieldDigests[2]);
+		EXPECT_EQ(digests1.FieldDigests[3], digests3.FieldDigests[3]);
+	}
+
+	TEST(TEST_CLASS, CalculateDocumentDigestsChangesLayoutDigestWhenFieldsChange) {
+		// Act:
+		auto digests1 = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+		auto digests2 = CalculateDocumentDigests(CreateDbModelWithoutName(100, 10).view());
+
+		// Assert:
+		EXPECT_NE(digests1.LayoutDigest, digests2.LayoutDigest);
+		EXPECT_EQ(3u, digests2.FieldDigests.size());
+	}
+
+	// endregion
+
+	// region ToSetUpdateDbModel
+
+	TEST(TEST_CLASS, CanMapSingleChangedFieldToSetUpdate) {
+		// Arrange:
+		auto previousDigests = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+		auto dbModel = CreateDbModel(200, 10);
+
+		// Act:
+		auto update = ToSetUpdateDbModel(dbModel.view(), previousDigests);
+
+		// Assert:
+		auto updateView = update.view();
+		EXPECT_EQ(1u, test::GetFieldCount(updateView));
+
+		auto setView = updateView["$set"].get_document().view();
+		EXPECT_EQ(1u, test::GetFieldCount(setView));
+		EXPECT_EQ(200, setView["account.balance"].get_int64().value);
+	}
+
+	TEST(TEST_CLASS, CanMapMultipleChangedFieldsToSetUpdate) {
+		// Arrange:
+		auto previousDigests = CalculateDocumentDigests(CreateDbModel(100, 10, "alpha").view());
+		auto dbModel = CreateDbModel(100, 20, "beta");
+
+		// Act:
+		auto update = ToSetUpdateDbModel(dbModel.view(), previousDigests);
+
+		// Assert:
+		auto setView = update.view()["$set"].get_document().view();
+		EXPECT_EQ(2u, test::GetFieldCount(setView));
+		auto nameView = setView["account.name"].get_utf8().value;
+		EXPECT_EQ("beta", std::string(nameView.data(), nameView.size()));
+		EXPECT_EQ(20, setView["account.details"].get_document().view()["height"].get_int64().value);
+	}
+
+	TEST(TEST_CLASS, UnchangedDocumentMapsToEmptySetUpdate) {
+		// Arrange:
+		auto previousDigests = CalculateDocumentDigests(CreateDbModel(100, 10).view());
+		auto dbModel = CreateDbModel(100, 10);
+
+		// Act:
+		auto update = ToSetUpdateDbModel(dbModel.view(), previousDigests);
+
+		// Assert:
+		auto setView = update.view()["$set"].get_document().view();
+		EXPECT_EQ(0u, test::GetFieldCount(setView));
+	}
+
+	// endregion
+}}}
@@ -34,8 +34,10 @@ namespace catapult { namespace test {
 	protected:
 		class CacheStorageWrapper : public PrepareDatabaseMixin {
 		public:
-			CacheStorageWrapper()
-					: m_pMongoContext(CreateDefaultMongoStorageContext(DatabaseName()))
+			explicit CacheStorageWrapper(
+					mongo::MongoStorageContext::CacheUpdateMode cacheUpdateMode = mongo::MongoStorageContext::CacheUpdateMode::Replace,
+					size_t maxCacheDiffDigests = 1000)
+					: m_pMongoContext(CreateDefaultMongoStorageContext(DatabaseName(), cacheUpdateMode, maxCacheDiffDigests))
 					, m_pCacheStorage(TTraits::CreateCacheStorage(*m_pMongoContext, TTraits::Network_Id))
 			{}
 
@@ -24,8 +24,10 @@
 
 namespace catapult { namespace test {
 
-	/// Mongo flat cache storage test suite.
-	template<typename TTraits>
+	/// Mongo flat cache storage test suite using \a CacheUpdateMode.
+	template<
+		typename TTraits,
+		mongo::MongoStorageContext::CacheUpdateMode CacheUpdateMode = mongo::MongoStorageContext::CacheUpdateMode::Replace>
 	class MongoFlatCacheStorageTests : private MongoCacheStorageTestUtils<TTraits> {
 	private:
 		using CacheType = typename TTraits::CacheType;
@@ -40,7 +42,7 @@ namespace catapult { namespace test {
 	public:
 		static void AssertSaveHasNoEffectWhenThereAreNoPendingChanges() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			auto delta = cache.createDelta();
 			cache.commit(Height());
@@ -54,7 +56,7 @@ namespace catapult { namespace test {
 
 		static void AssertAddedElementIsSavedToStorage() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			auto delta = cache.createDelta();
 
@@ -83,7 +85,7 @@ namespace catapult { namespace test {
 
 		static void AssertModifiedElementIsSavedToStorage() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			auto delta = cache.createDelta();
 
@@ -111,7 +113,7 @@ namespace catapult { namespace test {
 
 		static void AssertDeletedElementIsRemovedFromStorage() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			auto delta = cache.createDelta();
 
@@ -141,7 +143,7 @@ namespace catapult { namespace test {
 
 		static void AssertCanSaveMultipleElements() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			auto delta = cache.createDelta();
 
@@ -162,7 +164,7 @@ namespace catapult { namespace test {
 
 		static void AssertCanAddAndModifyAndDeleteMultipleElements() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			auto delta = cache.createDelta();
 
@@ -213,7 +215,7 @@ namespace catapult { namespace test {
 
 		static void AssertElementsBothAddedAndRemovedAreIgnored() {
 			// Arrange:
-			CacheStorageWrapper storage;
+			CacheStorageWrapper storage(CacheUpdateMode);
 			auto cache = TTraits::CreateCache();
 			std::vector<ElementType> elements;
 
@@ -244,6 +246,69 @@ namespace catapult { namespace test {
 			AssertDbContents(elements);
 		}
 
+		static void AssertElementModifiedMultipleTimesIsSavedToStorage() {
+			// Arrange:
+			CacheStorageWrapper storage(CacheUpdateMode);
+			auto cache = TTraits::CreateCache();
+
+			// - prepare the cache with a single element
+			auto element = TTraits::GenerateRandomElement(11);
+			{
+				auto delta = cache.createDelta();
+				TTraits::Add(delta, element);
+				storage.get().saveDelta(cache::CacheChanges(delta));
+				cache.commit(Height());
+			}
+
+			// Act: modify the element in multiple deltas
+			for (auto i = 0u; i < 3; ++i) {
+				auto delta = cache.createDelta();
+				TTraits::Mutate(delta, element);
+				storage.get().saveDelta(cache::CacheChanges(delta));
+				cache.commit(Height());
+			}
+
+			// Assert:
+			EXPECT_EQ(1u, GetCollectionSize());
+			AssertDbContents({ element });
+		}
+
+		static void AssertModifiedElementIsFullySavedToStorageWhenItsDigestsWereEvicted() {
+			// Arrange: only keep digests of a single element
+			CacheStorageWrapper storage(CacheUpdateMode, 1);
+			auto cache = TTraits::CreateCache();
+
+			// - save two elements in separate deltas so that the digests of the first element are evicted
+			auto element1 = TTraits::GenerateRandomElement(11);
+			auto element2 = TTraits::GenerateRandomElement(12);
+			for (const auto& element : { element1, element2 }) {
+				auto delta = cache.createDelta();
+				TTraits::Add(delta, element);
+				storage.get().saveDelta(cache::CacheChanges(delta));
+				cache.commit(Height());
+			}
+
+			// - delete the first element from the db so that only a full upsert can restore it
+			auto connection = CreateDbConnection();
+			auto filter = TTraits::GetFindFilter(element1);
+			connection[DatabaseName()][TTraits::Collection_Name].delete_one(filter.view());
+
+			// Sanity:
+			EXPECT_EQ(1u, GetCollectionSize());
+
+			// Act:
+			{
+				auto delta = cache.createDelta();
+				TTraits::Mutate(delta, element1);
+				storage.get().saveDelta(cache::CacheChanges(delta));
+				cache.commit(Height());
+			}
+
+			// Assert:
+			EXPECT_EQ(2u, GetCollectionSize());
+			AssertDbContents({ element1, element2 });
+		}
+
 	private:
 		static auto GetCacheContents(const cache::CatapultCache& cache) {
 			std::vector<ElementType> contents;
@@ -258,12 +323,17 @@ namespace catapult { namespace test {
 	};
 
 #define MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, TEST_NAME) \
-	TEST(TEST_CLASS, TEST_NAME##POSTFIX) { test::MongoFlatCacheStorageTests<TRAITS_NAME>::Assert##TEST_NAME(); }
+	TEST(TEST_CLASS, TEST_NAME##POSTFIX) { test::MongoFlatCacheStorageTests<TRAITS_NAME>::Assert##TEST_NAME(); } \
+	TEST(TEST_CLASS, TEST_NAME##POSTFIX##_Diff) { \
+		test::MongoFlatCacheStorageTests<TRAITS_NAME, mongo::MongoStorageContext::CacheUpdateMode::Diff>::Assert##TEST_NAME(); \
+	}
 
 #define DEFINE_FLAT_CACHE_STORAGE_TESTS(TRAITS_NAME, POSTFIX) \
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, SaveHasNoEffectWhenThereAreNoPendingChanges) \
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, AddedElementIsSavedToStorage) \
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ModifiedElementIsSavedToStorage) \
+	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ElementModifiedMultipleTimesIsSavedToStorage) \
+	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, ModifiedElementIsFullySavedToStorageWhenItsDigestsWereEvicted) \
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, DeletedElementIsRemovedFromStorage) \
 	\
 	MAKE_FLAT_CACHE_STORAGE_TEST(TRAITS_NAME, POSTFIX, CanSaveMultipleElements) \
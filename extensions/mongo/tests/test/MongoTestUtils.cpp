@@ -98,8 +98,21 @@ namespace catapult { namespace test {
 	}
 
 	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(const std::string& dbName) {
+		return CreateDefaultMongoStorageContext(dbName, mongo::MongoStorageContext::CacheUpdateMode::Replace, 0);
+	}
+
+	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(
+			const std::string& dbName,
+			mongo::MongoStorageContext::CacheUpdateMode cacheUpdateMode,
+			size_t maxCacheDiffDigests) {
 		auto pWriter = mongo::MongoBulkWriter::Create(DefaultDbUri(), dbName, CreateStartedIoThreadPool(8));
-		return std::make_unique<mongo::MongoStorageContext>(DefaultDbUri(), dbName, pWriter, mongo::MongoErrorPolicy::Mode::Strict);
+		return std::make_unique<mongo::MongoStorageContext>(
+				DefaultDbUri(),
+				dbName,
+				pWriter,
+				mongo::MongoErrorPolicy::Mode::Strict,
+				cacheUpdateMode,
+				maxCacheDiffDigests);
 	}
 
 	mongo::MongoTransactionRegistry CreateDefaultMongoTransactionRegistry() {
@@ -56,6 +56,13 @@ namespace catapult { namespace test {
 	/// Creates a default mongo storage context for database \a dbName.
 	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(const std::string& dbName);
 
+	/// Creates a default mongo storage context for database \a dbName with \a cacheUpdateMode
+	/// and \a maxCacheDiffDigests element digests per collection.
+	std::unique_ptr<mongo::MongoStorageContext> CreateDefaultMongoStorageContext(
+			const std::string& dbName,
+			mongo::MongoStorageContext::CacheUpdateMode cacheUpdateMode,
+			size_t maxCacheDiffDigests);
+
 	/// Creates a default mongo transaction registry that supports mock transactions.
 	mongo::MongoTransactionRegistry CreateDefaultMongoTransactionRegistry();
 
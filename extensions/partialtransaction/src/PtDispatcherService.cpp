@@ -25,7 +25,9 @@
 #include "partialtransaction/src/chain/PtValidator.h"
 #include "partialtransaction/src/handlers/CosignatureHandler.h"
 #include "partialtransaction/src/handlers/PtHandlers.h"
+#include "catapult/cache/CatapultCache.h"
 #include "catapult/cache_tx/MemoryPtCache.h"
+#include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/consumers/RecentHashCache.h"
 #include "catapult/consumers/ReclaimMemoryInspector.h"
 #include "catapult/consumers/TransactionConsumers.h"
@@ -34,6 +36,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
+#include "catapult/extensions/TransactionsSnapshotStorage.h"
 #include "catapult/plugins/PluginManager.h"
 #include "catapult/thread/MultiServicePool.h"
 
@@ -216,6 +219,50 @@ namespace catapult { namespace partialtransaction {
 			state.tasks().push_back(extensions::CreateBatchTransactionTask(*pBatchRangeDispatcher, "partial transaction"));
 		}
 
+		std::string GetSnapshotFilename(const config::CatapultConfiguration& config) {
+			return config::CatapultDataDirectory(config.User.DataDirectory).rootDir().file("pt.dat");
+		}
+
+		// saves all partial transactions (with stitched cosignatures) at shutdown so that they can be reloaded at startup
+		class PtCacheSnapshotService {
+		public:
+			PtCacheSnapshotService(
+					const std::string& filename,
+					const cache::MemoryPtCacheProxy& ptCache,
+					const cache::CatapultCache& catapultCache)
+					: m_filename(filename)
+					, m_ptCache(ptCache)
+					, m_catapultCache(catapultCache)
+			{}
+
+		public:
+			void shutdown() {
+				auto height = m_catapultCache.createView().height();
+
+				std::vector<std::shared_ptr<const model::Transaction>> transactions;
+				m_ptCache.view().forEach([&transactions](const auto& transactionInfo) {
+					transactions.push_back(StitchAggregate(transactionInfo));
+					return true;
+				});
+
+				SaveTransactionsSnapshot(m_filename, height, transactions);
+			}
+
+		private:
+			std::string m_filename;
+			const cache::MemoryPtCacheProxy& m_ptCache;
+			const cache::CatapultCache& m_catapultCache;
+		};
+
+		void LoadPtCacheSnapshot(const std::string& filename, const ServiceLocator& locator, const ServiceState& state) {
+			auto transactions = LoadTransactionsSnapshot(filename, state.cache().createView().height());
+			if (transactions.empty())
+				return;
+
+			// push the saved transactions through the dispatcher so that they and their cosignatures are reverified
+			GetPtServerHooks(locator).ptRangeConsumer()(std::move(transactions));
+		}
+
 		std::unique_ptr<chain::PtUpdater> CreateAndRegisterPtUpdater(cache::MemoryPtCacheProxy& ptCache, extensions::ServiceState& state) {
 			auto pUpdaterPool = state.pool().pushIsolatedPool("ptUpdater");
 
@@ -257,6 +304,13 @@ namespace catapult { namespace partialtransaction {
 				auto pDispatcher = dispatcherBuilder.build(*pPtUpdater, CreateNewTransactionSink(locator));
 				RegisterTransactionDispatcherService(pDispatcher, *pPtUpdater, locator, state);
 
+				// save the cache after the dispatcher is shutdown (services are shutdown in reverse order of registration)
+				if (state.config().Node.EnableTransactionsCacheSnapshot) {
+					auto snapshotFilename = GetSnapshotFilename(state.config());
+					pServiceGroup->registerService(std::make_shared<PtCacheSnapshotService>(snapshotFilename, ptCache, state.cache()));
+					LoadPtCacheSnapshot(snapshotFilename, locator, state);
+				}
+
 				// extend the lifetimes of pDispatcher and pPtUpdater
 				pServiceGroup->registerService(std::make_shared<DispatcherServiceRegistrar>(pDispatcher, std::move(pPtUpdater)));
 			}
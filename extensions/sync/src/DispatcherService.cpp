@@ -45,6 +45,7 @@
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/NodeInteractionUtils.h"
 #include "catapult/extensions/PluginUtils.h"
+#include "catapult/extensions/Results.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/ionet/NodeContainer.h"
@@ -146,7 +147,8 @@ namespace catapult { namespace sync {
 
 		BlockChainProcessor CreateSyncProcessor(
 				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const chain::ExecutionConfiguration& executionConfig,
+				const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockChainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockChainConfig, [view](const auto& publicKey, auto height) {
@@ -156,10 +158,14 @@ namespace catapult { namespace sync {
 			return CreateBlockChainProcessor(
 					blockHitPredicateFactory,
 					chain::CreateBatchEntityProcessor(executionConfig),
-					GetReceiptValidationMode(blockChainConfig));
+					GetReceiptValidationMode(blockChainConfig),
+					pValidatorPool);
 		}
 
-		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockChainSyncHandlers CreateBlockChainSyncHandlers(
+				extensions::ServiceState& state,
+				RollbackInfo& rollbackInfo,
+				const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 			const auto& blockChainConfig = state.config().BlockChain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -180,7 +186,10 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(
+					blockChainConfig,
+					extensions::CreateExecutionConfiguration(pluginManager),
+					pValidatorPool);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -212,10 +221,11 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(const std::shared_ptr<thread::IoThreadPool>& pValidatorPool) {
 				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						pValidatorPool));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
@@ -245,7 +255,7 @@ namespace catapult { namespace sync {
 						m_state.cache(),
 						m_state.storage(),
 						m_state.config().BlockChain.MaxRollbackBlocks,
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockChainSyncHandlers(m_state, rollbackInfo, pValidatorPool)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
 					disruptorConsumers.push_back(CreateBlockChainSyncCleanupConsumer(m_state.config().User.DataDirectory));
@@ -361,7 +371,8 @@ namespace catapult { namespace sync {
 
 			auto pBatchRangeDispatcher = std::make_shared<extensions::TransactionBatchRangeDispatcher>(
 					*pDispatcher,
-					state.config().BlockChain.Network.NodeEqualityStrategy);
+					state.config().BlockChain.Network.NodeEqualityStrategy,
+					state.config().Node.TransactionBatchSize);
 			locator.registerRootedService("dispatcher.transaction.batch", pBatchRangeDispatcher);
 
 			state.hooks().setTransactionRangeConsumerFactory([&dispatcher = *pBatchRangeDispatcher, &nodes = state.nodes()](auto source) {
@@ -376,6 +387,11 @@ namespace catapult { namespace sync {
 
 		// endregion
 
+		bool IsAddressExtractionExtensionEnabled(const config::ExtensionsConfiguration& extensionsConfiguration) {
+			const auto& names = extensionsConfiguration.Names;
+			return names.cend() != std::find(names.cbegin(), names.cend(), "extension.addressextraction");
+		}
+
 		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
@@ -387,8 +403,22 @@ namespace catapult { namespace sync {
 					CreateUtUpdaterThrottle(state.config()));
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
+			// reuse the notifications published during stateful validation to extract addresses needed by ut change subscribers
+			if (IsAddressExtractionExtensionEnabled(state.config().Extensions))
+				pUtUpdater->enableAddressExtraction();
+
 			auto& utUpdater = *pUtUpdater;
-			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
+			auto& utCache = state.utCache();
+			auto& statusSubscriber = state.transactionStatusSubscriber();
+			auto timeSupplier = state.timeSupplier();
+			state.hooks().addTransactionsChangeHandler([&utUpdater, &utCache, &statusSubscriber, timeSupplier](const auto& changeInfo) {
+				// 1. prune expired transactions so that they are not reapplied
+				auto pruneStatus = utils::to_underlying_type(extensions::Failure_Extension_Unconfirmed_Transaction_Cache_Prune);
+				auto prunedInfos = utCache.modifier().prune(timeSupplier());
+				for (const auto& prunedInfo : prunedInfos)
+					statusSubscriber.notifyStatus(*prunedInfo.pEntity, prunedInfo.EntityHash, pruneStatus);
+
+				// 2. update the ut cache
 				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
 			});
 
@@ -443,7 +473,7 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
 				transactionDispatcherBuilder.addHashConsumers();
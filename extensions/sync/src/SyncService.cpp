@@ -56,6 +56,7 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
+			chainSynchronizerConfig.MaxPendingBlockRangeRequests = config.Node.MaxPendingBlockRangeRequests;
 			return chainSynchronizerConfig;
 		}
 
@@ -80,10 +81,16 @@ namespace catapult { namespace sync {
 		}
 
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
-			auto utSynchronizer = chain::CreateUtSynchronizer(
-					state.config().Node.MinFeeMultiplier,
-					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
-					state.hooks().transactionRangeConsumerFactory()(Sync_Source));
+			const auto& nodeConfig = state.config().Node;
+			auto shortHashesSupplier = [&cache = state.utCache()]() { return cache.view().shortHashes(); };
+			auto transactionRangeConsumer = state.hooks().transactionRangeConsumerFactory()(Sync_Source);
+			auto utSynchronizer = nodeConfig.EnableTransactionsSetReconciliation
+					? chain::CreateUtSynchronizer(
+							nodeConfig.MinFeeMultiplier,
+							shortHashesSupplier,
+							[&cache = state.utCache()](auto numCells) { return cache.view().shortHashesSketch(numCells); },
+							transactionRangeConsumer)
+					: chain::CreateUtSynchronizer(nodeConfig.MinFeeMultiplier, shortHashesSupplier, transactionRangeConsumer);
 
 			thread::Task task;
 			task.Name = "pull unconfirmed transactions task";
@@ -40,6 +40,8 @@ namespace catapult { namespace syncsource {
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
 			handlers::UtRetriever UtRetriever;
+			handlers::UtSketchSupplier UtSketchSupplier;
+			handlers::UtRetriever RequestedUtRetriever;
 		};
 
 		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
@@ -50,6 +52,12 @@ namespace catapult { namespace syncsource {
 			config.UtRetriever = [&cache = state.utCache()](auto minFeeMultiplier, const auto& shortHashes) {
 				return cache.view().unknownTransactions(minFeeMultiplier, shortHashes);
 			};
+			config.UtSketchSupplier = [&cache = state.utCache()](auto numCells) {
+				return cache.view().shortHashesSketch(numCells);
+			};
+			config.RequestedUtRetriever = [&cache = state.utCache()](auto minFeeMultiplier, const auto& shortHashes) {
+				return cache.view().requestedTransactions(minFeeMultiplier, shortHashes);
+			};
 
 			SetConfig(config.BlocksHandlerConfig, state.config().Node);
 			return config;
@@ -68,6 +76,7 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterPullTransactionsSketchHandler(handlers, config.UtSketchSupplier, config.RequestedUtRetriever);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -35,7 +35,8 @@ namespace catapult { namespace zeromq {
 			auto config = MessagingConfiguration::LoadFromPath(bootstrapper.resourcesPath());
 			auto pZeroEntityPublisher = std::make_shared<ZeroMqEntityPublisher>(
 					config.SubscriberPort,
-					bootstrapper.pluginManager().createNotificationPublisher());
+					bootstrapper.pluginManager().createNotificationPublisher(),
+					config.EnableBlockTransactionsCoalescing ? BlockTransactionsMode::Coalesced : BlockTransactionsMode::Individual);
 
 			// add a dummy service for extending service lifetimes
 			bootstrapper.extensionManager().addServiceRegistrar(extensions::CreateRootedServiceRegistrar(
@@ -35,8 +35,9 @@ namespace catapult { namespace zeromq {
 		MessagingConfiguration config;
 
 		LOAD_PROPERTY(SubscriberPort);
+		LOAD_PROPERTY(EnableBlockTransactionsCoalescing);
 
-		utils::VerifyBagSizeLte(bag, 1);
+		utils::VerifyBagSizeLte(bag, 2);
 		return config;
 	}
 
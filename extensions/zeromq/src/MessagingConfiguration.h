@@ -31,6 +31,9 @@ namespace catapult { namespace zeromq {
 		/// Subscriber port.
 		unsigned short SubscriberPort;
 
+		/// \c true if all transactions of a block sharing a topic should be published in a single message.
+		bool EnableBlockTransactionsCoalescing;
+
 	private:
 		MessagingConfiguration() = default;
 
@@ -38,8 +38,7 @@ namespace catapult { namespace zeromq {
 
 				// transactions
 				auto height = blockElement.Block.Height;
-				for (const auto& transactionElement : blockElement.Transactions)
-					m_publisher.publishTransaction(TransactionMarker::Transaction_Marker, transactionElement, height);
+				m_publisher.publishTransactions(TransactionMarker::Transaction_Marker, blockElement.Transactions, height);
 			}
 
 			void notifyDropBlocksAfter(Height height) override {
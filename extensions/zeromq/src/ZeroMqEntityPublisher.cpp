@@ -28,14 +28,37 @@
 #include "catapult/thread/IoThreadPool.h"
 #include <boost/asio.hpp>
 #include <set>
+#include <unordered_map>
 
 namespace catapult { namespace zeromq {
 
-	class MessageGroup {
+	namespace {
+		void ReleaseFrameOwner(void*, void* pHint) {
+			delete static_cast<std::shared_ptr<const void>*>(pHint);
+		}
+
+		// adds a frame to \a multipart that references (instead of copies) \a size bytes at \a pData
+		// notice that the frame keeps \a pOwner alive until zeromq no longer needs the data
+		void AddSharedFrame(zmq::multipart_t& multipart, const void* pData, size_t size, const std::shared_ptr<const void>& pOwner) {
+			auto pHint = std::make_unique<std::shared_ptr<const void>>(pOwner);
+			zmq::message_t message(const_cast<void*>(pData), size, ReleaseFrameOwner, pHint.get());
+
+			// message owns hint after successful construction
+			pHint.release();
+			multipart.add(std::move(message));
+		}
+	}
+
+	class ZeroMqEntityPublisher::MessageGroup {
 	public:
 		explicit MessageGroup(const supplier<std::string>& errorMessageGenerator) : m_errorMessageGenerator(errorMessageGenerator)
 		{}
 
+	public:
+		bool empty() const {
+			return m_messages.empty();
+		}
+
 	public:
 		void add(zmq::multipart_t&& message) {
 			m_messages.push_back(std::move(message));
@@ -76,6 +99,9 @@ namespace catapult { namespace zeromq {
 
 	public:
 		void queue(std::unique_ptr<MessageGroup>&& pMessageGroup) {
+			if (pMessageGroup->empty())
+				return;
+
 			// dispatch function needs to be copyable
 			auto pMessageGroupShared = std::shared_ptr<MessageGroup>(std::move(pMessageGroup));
 			boost::asio::dispatch(m_pPool->ioContext(), [&zmqSocket = m_zmqSocket, pMessageGroup{std::move(pMessageGroupShared)}]() {
@@ -96,6 +122,7 @@ namespace catapult { namespace zeromq {
 				, EntityHash(transactionInfo.EntityHash)
 				, MerkleComponentHash(transactionInfo.MerkleComponentHash)
 				, OptionalAddresses(transactionInfo.OptionalExtractedAddresses.get())
+				, pTransactionOwner(transactionInfo.pEntity)
 		{}
 
 		explicit WeakTransactionInfo(const model::TransactionElement& element)
@@ -112,17 +139,40 @@ namespace catapult { namespace zeromq {
 				, OptionalAddresses(nullptr)
 		{}
 
+	public:
+		/// Gets a shared pointer to the transaction data that can be referenced by multiple frames.
+		/// \note Transaction data is copied once when the transaction is not already shared.
+		std::shared_ptr<const void> shareTransaction() const {
+			if (pTransactionOwner)
+				return pTransactionOwner;
+
+			const auto* pTransactionData = reinterpret_cast<const uint8_t*>(&Transaction);
+			auto pBuffer = std::make_shared<std::vector<uint8_t>>(pTransactionData, pTransactionData + Transaction.Size);
+			return std::shared_ptr<const void>(pBuffer, pBuffer->data());
+		}
+
 	public:
 		const model::Transaction& Transaction;
 		const Hash256& EntityHash;
 		const Hash256& MerkleComponentHash;
 		const model::UnresolvedAddressSet* OptionalAddresses;
+
+	private:
+		std::shared_ptr<const void> pTransactionOwner;
 	};
 
 	ZeroMqEntityPublisher::ZeroMqEntityPublisher(
 			unsigned short port,
 			std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher)
+			: ZeroMqEntityPublisher(port, std::move(pNotificationPublisher), BlockTransactionsMode::Individual)
+	{}
+
+	ZeroMqEntityPublisher::ZeroMqEntityPublisher(
+			unsigned short port,
+			std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher,
+			BlockTransactionsMode blockTransactionsMode)
 			: m_pNotificationPublisher(std::move(pNotificationPublisher))
+			, m_blockTransactionsMode(blockTransactionsMode)
 			, m_pSynchronizedPublisher(std::make_unique<SynchronizedPublisher>(port))
 	{}
 
@@ -170,6 +220,29 @@ namespace catapult { namespace zeromq {
 				return out.str();
 			};
 		}
+
+		auto CreateCountMessageGenerator(const std::string& topicName, size_t count) {
+			return [topicName, count]() {
+				std::ostringstream out;
+				out << "cannot publish " << count << " " << topicName;
+				return out.str();
+			};
+		}
+
+		auto CreateTransactionPayloadBuilder(
+				const model::Transaction& transaction,
+				const std::shared_ptr<const void>& pTransactionData,
+				const Hash256& entityHash,
+				const Hash256& merkleComponentHash,
+				Height height) {
+			// notice that the transaction data is shared by all messages and only the small parts are copied
+			return [&transaction, pTransactionData, &entityHash, &merkleComponentHash, height](auto& multipart) {
+				AddSharedFrame(multipart, pTransactionData.get(), transaction.Size, pTransactionData);
+				multipart.addmem(static_cast<const void*>(&entityHash), Hash256::Size);
+				multipart.addmem(static_cast<const void*>(&merkleComponentHash), Hash256::Size);
+				multipart.addtyp(height);
+			};
+		}
 	}
 
 	void ZeroMqEntityPublisher::publishTransaction(
@@ -186,6 +259,46 @@ namespace catapult { namespace zeromq {
 		publishTransaction(topicMarker, WeakTransactionInfo(transactionInfo), height);
 	}
 
+	void ZeroMqEntityPublisher::publishTransactions(
+			TransactionMarker topicMarker,
+			const std::vector<model::TransactionElement>& transactionElements,
+			Height height) {
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHeightMessageGenerator("transactions", height));
+		if (BlockTransactionsMode::Coalesced == m_blockTransactionsMode) {
+			addCoalescedMessages(*pMessageGroup, topicMarker, transactionElements, height);
+		} else {
+			for (const auto& transactionElement : transactionElements) {
+				WeakTransactionInfo transactionInfo(transactionElement);
+				addMessages(*pMessageGroup, topicMarker, transactionInfo, CreateTransactionPayloadBuilder(
+						transactionInfo.Transaction,
+						transactionInfo.shareTransaction(),
+						transactionInfo.EntityHash,
+						transactionInfo.MerkleComponentHash,
+						height));
+			}
+		}
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
+	void ZeroMqEntityPublisher::publishTransactions(
+			TransactionMarker topicMarker,
+			const model::TransactionInfosSet& transactionInfos,
+			Height height) {
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateCountMessageGenerator("transactions", transactionInfos.size()));
+		for (const auto& transactionInfo : transactionInfos) {
+			WeakTransactionInfo weakTransactionInfo(transactionInfo);
+			addMessages(*pMessageGroup, topicMarker, weakTransactionInfo, CreateTransactionPayloadBuilder(
+					weakTransactionInfo.Transaction,
+					weakTransactionInfo.shareTransaction(),
+					weakTransactionInfo.EntityHash,
+					weakTransactionInfo.MerkleComponentHash,
+					height));
+		}
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
 	void ZeroMqEntityPublisher::publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo) {
 		const auto& hash = transactionInfo.EntityHash;
 		publish("transaction hash", topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& multipart) {
@@ -193,17 +306,31 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
+	void ZeroMqEntityPublisher::publishTransactionHashes(
+			TransactionMarker topicMarker,
+			const model::TransactionInfosSet& transactionInfos) {
+		auto numTransactionInfos = transactionInfos.size();
+		auto pMessageGroup = std::make_unique<MessageGroup>(CreateCountMessageGenerator("transaction hashes", numTransactionInfos));
+		for (const auto& transactionInfo : transactionInfos) {
+			const auto& hash = transactionInfo.EntityHash;
+			addMessages(*pMessageGroup, topicMarker, WeakTransactionInfo(transactionInfo), [&hash](auto& multipart) {
+				multipart.addmem(static_cast<const void*>(&hash), Hash256::Size);
+			});
+		}
+
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
+
 	void ZeroMqEntityPublisher::publishTransaction(
 			TransactionMarker topicMarker,
 			const WeakTransactionInfo& transactionInfo,
 			Height height) {
-		publish("transaction", topicMarker, transactionInfo, [&transactionInfo, height](auto& multipart) {
-			const auto& transaction = transactionInfo.Transaction;
-			multipart.addmem(static_cast<const void*>(&transaction), transaction.Size);
-			multipart.addmem(static_cast<const void*>(&transactionInfo.EntityHash), Hash256::Size);
-			multipart.addmem(static_cast<const void*>(&transactionInfo.MerkleComponentHash), Hash256::Size);
-			multipart.addtyp(height);
-		});
+		publish("transaction", topicMarker, transactionInfo, CreateTransactionPayloadBuilder(
+				transactionInfo.Transaction,
+				transactionInfo.shareTransaction(),
+				transactionInfo.EntityHash,
+				transactionInfo.MerkleComponentHash,
+				height));
 	}
 
 	void ZeroMqEntityPublisher::publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) {
@@ -230,22 +357,71 @@ namespace catapult { namespace zeromq {
 			const WeakTransactionInfo& transactionInfo,
 			const MessagePayloadBuilder& payloadBuilder) {
 		auto pMessageGroup = std::make_unique<MessageGroup>(CreateHashMessageGenerator(topicName, transactionInfo.EntityHash));
+		addMessages(*pMessageGroup, topicMarker, transactionInfo, payloadBuilder);
+		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	}
 
-		const auto& addresses = transactionInfo.OptionalAddresses
-				? *transactionInfo.OptionalAddresses
-				: model::ExtractAddresses(transactionInfo.Transaction, *m_pNotificationPublisher);
-
-		if (addresses.empty())
-			CATAPULT_LOG(warning) << "no addresses are associated with transaction " << transactionInfo.EntityHash;
-
-		for (const auto& address : addresses) {
+	void ZeroMqEntityPublisher::addMessages(
+			MessageGroup& messageGroup,
+			TransactionMarker topicMarker,
+			const WeakTransactionInfo& transactionInfo,
+			const MessagePayloadBuilder& payloadBuilder) {
+		model::UnresolvedAddressSet extractedAddresses;
+		for (const auto& address : extractAddresses(transactionInfo, extractedAddresses)) {
 			zmq::multipart_t multipart;
 			auto topic = CreateTopic(topicMarker, address);
 			multipart.addmem(topic.data(), topic.size());
 			payloadBuilder(multipart);
-			pMessageGroup->add(std::move(multipart));
+			messageGroup.add(std::move(multipart));
 		}
+	}
 
-		m_pSynchronizedPublisher->queue(std::move(pMessageGroup));
+	void ZeroMqEntityPublisher::addCoalescedMessages(
+			MessageGroup& messageGroup,
+			TransactionMarker topicMarker,
+			const std::vector<model::TransactionElement>& transactionElements,
+			Height height) {
+		// build a single message for each topic that contains the transactions associated with it in block order
+		std::vector<zmq::multipart_t> messages;
+		std::unordered_map<UnresolvedAddress, size_t, utils::ArrayHasher<UnresolvedAddress>> addressToMessageIndexMap;
+		for (const auto& transactionElement : transactionElements) {
+			WeakTransactionInfo transactionInfo(transactionElement);
+			auto payloadBuilder = CreateTransactionPayloadBuilder(
+					transactionInfo.Transaction,
+					transactionInfo.shareTransaction(),
+					transactionInfo.EntityHash,
+					transactionInfo.MerkleComponentHash,
+					height);
+
+			model::UnresolvedAddressSet extractedAddresses;
+			for (const auto& address : extractAddresses(transactionInfo, extractedAddresses)) {
+				auto iter = addressToMessageIndexMap.find(address);
+				if (addressToMessageIndexMap.cend() == iter) {
+					iter = addressToMessageIndexMap.emplace(address, messages.size()).first;
+
+					auto topic = CreateTopic(topicMarker, address);
+					messages.emplace_back();
+					messages.back().addmem(topic.data(), topic.size());
+				}
+
+				payloadBuilder(messages[iter->second]);
+			}
+		}
+
+		for (auto& message : messages)
+			messageGroup.add(std::move(message));
+	}
+
+	const model::UnresolvedAddressSet& ZeroMqEntityPublisher::extractAddresses(
+			const WeakTransactionInfo& transactionInfo,
+			model::UnresolvedAddressSet& extractedAddresses) const {
+		if (!transactionInfo.OptionalAddresses)
+			extractedAddresses = model::ExtractAddresses(transactionInfo.Transaction, *m_pNotificationPublisher);
+
+		const auto& addresses = transactionInfo.OptionalAddresses ? *transactionInfo.OptionalAddresses : extractedAddresses;
+		if (addresses.empty())
+			CATAPULT_LOG(warning) << "no addresses are associated with transaction " << transactionInfo.EntityHash;
+
+		return addresses;
 	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/functions.h"
 #include <zmq_addon.hpp>
@@ -70,12 +71,29 @@ namespace catapult { namespace zeromq {
 		Cosignature_Marker = 0x63 // 'c'
 	};
 
+	/// Modes for publishing the transactions of a block.
+	enum class BlockTransactionsMode {
+		/// Each transaction is published in a separate message for each of its topics.
+		Individual,
+
+		/// All transactions of a block sharing a topic are published in a single message for that topic.
+		/// \note Each message is composed of a topic part followed by four parts for each transaction.
+		Coalesced
+	};
+
 	/// Zeromq entity publisher.
 	class ZeroMqEntityPublisher {
 	public:
 		/// Creates a zeromq entity publisher around \a port and \a pNotificationPublisher.
 		ZeroMqEntityPublisher(unsigned short port, std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher);
 
+		/// Creates a zeromq entity publisher around \a port and \a pNotificationPublisher
+		/// that publishes the transactions of a block using \a blockTransactionsMode.
+		ZeroMqEntityPublisher(
+				unsigned short port,
+				std::unique_ptr<const model::NotificationPublisher>&& pNotificationPublisher,
+				BlockTransactionsMode blockTransactionsMode);
+
 		~ZeroMqEntityPublisher();
 
 	public:
@@ -91,9 +109,22 @@ namespace catapult { namespace zeromq {
 		/// Publishes a transaction using \a topicMarker, \a transactionInfo and \a height.
 		void publishTransaction(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo, Height height);
 
+		/// Publishes all transactions in \a transactionElements of a block using \a topicMarker and \a height.
+		/// \note Transactions are published according to the configured block transactions mode.
+		void publishTransactions(
+				TransactionMarker topicMarker,
+				const std::vector<model::TransactionElement>& transactionElements,
+				Height height);
+
+		/// Publishes all transactions in \a transactionInfos using \a topicMarker and \a height.
+		void publishTransactions(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos, Height height);
+
 		/// Publishes a transaction hash using \a topicMarker and \a transactionInfo.
 		void publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo);
 
+		/// Publishes the hashes of all transactions in \a transactionInfos using \a topicMarker.
+		void publishTransactionHashes(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos);
+
 		/// Publishes a transaction status composed of \a transaction, \a hash and \a status.
 		void publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status);
 
@@ -102,6 +133,7 @@ namespace catapult { namespace zeromq {
 
 	private:
 		struct WeakTransactionInfo;
+		class MessageGroup;
 		using MessagePayloadBuilder = consumer<zmq::multipart_t&>;
 
 		void publishTransaction(TransactionMarker topicMarker, const WeakTransactionInfo& transactionInfo, Height height);
@@ -111,9 +143,24 @@ namespace catapult { namespace zeromq {
 				const WeakTransactionInfo& transactionInfo,
 				const MessagePayloadBuilder& payloadBuilder);
 
+		void addMessages(
+				MessageGroup& messageGroup,
+				TransactionMarker topicMarker,
+				const WeakTransactionInfo& transactionInfo,
+				const MessagePayloadBuilder& payloadBuilder);
+		void addCoalescedMessages(
+				MessageGroup& messageGroup,
+				TransactionMarker topicMarker,
+				const std::vector<model::TransactionElement>& transactionElements,
+				Height height);
+		const model::UnresolvedAddressSet& extractAddresses(
+				const WeakTransactionInfo& transactionInfo,
+				model::UnresolvedAddressSet& extractedAddresses) const;
+
 	private:
 		class SynchronizedPublisher;
 		std::unique_ptr<const model::NotificationPublisher> m_pNotificationPublisher;
+		BlockTransactionsMode m_blockTransactionsMode;
 		std::unique_ptr<SynchronizedPublisher> m_pSynchronizedPublisher;
 	};
 }}
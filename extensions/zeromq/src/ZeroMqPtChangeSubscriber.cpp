@@ -31,8 +31,7 @@ namespace catapult { namespace zeromq {
 
 		public:
 			void notifyAddPartials(const TransactionInfos& transactionInfos) override {
-				for (const auto& transactionInfo : transactionInfos)
-					m_publisher.publishTransaction(TransactionMarker::Partial_Transaction_Add_Marker, transactionInfo, Height());
+				m_publisher.publishTransactions(TransactionMarker::Partial_Transaction_Add_Marker, transactionInfos, Height());
 			}
 
 			void notifyAddCosignature(
@@ -42,8 +41,7 @@ namespace catapult { namespace zeromq {
 			}
 
 			void notifyRemovePartials(const TransactionInfos& transactionInfos) override {
-				for (const auto& transactionInfo : transactionInfos)
-					m_publisher.publishTransactionHash(TransactionMarker::Partial_Transaction_Remove_Marker, transactionInfo);
+				m_publisher.publishTransactionHashes(TransactionMarker::Partial_Transaction_Remove_Marker, transactionInfos);
 			}
 
 			void flush() override {
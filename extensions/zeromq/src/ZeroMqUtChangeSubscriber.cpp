@@ -31,13 +31,11 @@ namespace catapult { namespace zeromq {
 
 		public:
 			void notifyAdds(const TransactionInfos& transactionInfos) override {
-				for (const auto& transactionInfo : transactionInfos)
-					m_publisher.publishTransaction(TransactionMarker::Unconfirmed_Transaction_Add_Marker, transactionInfo, Height());
+				m_publisher.publishTransactions(TransactionMarker::Unconfirmed_Transaction_Add_Marker, transactionInfos, Height());
 			}
 
 			void notifyRemoves(const TransactionInfos& transactionInfos) override {
-				for (const auto& transactionInfo : transactionInfos)
-					m_publisher.publishTransactionHash(TransactionMarker::Unconfirmed_Transaction_Remove_Marker, transactionInfo);
+				m_publisher.publishTransactionHashes(TransactionMarker::Unconfirmed_Transaction_Remove_Marker, transactionInfos);
 			}
 
 			void flush() override {
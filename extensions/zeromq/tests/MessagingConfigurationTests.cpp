@@ -35,7 +35,8 @@ namespace catapult { namespace zeromq {
 					{
 						"messaging",
 						{
-							{ "subscriberPort", "9753" }
+							{ "subscriberPort", "9753" },
+							{ "enableBlockTransactionsCoalescing", "true" }
 						}
 					}
 				};
@@ -48,11 +49,13 @@ namespace catapult { namespace zeromq {
 			static void AssertZero(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(0u, config.SubscriberPort);
+				EXPECT_FALSE(config.EnableBlockTransactionsCoalescing);
 			}
 
 			static void AssertCustom(const MessagingConfiguration& config) {
 				// Assert:
 				EXPECT_EQ(9753u, config.SubscriberPort);
+				EXPECT_TRUE(config.EnableBlockTransactionsCoalescing);
 			}
 		};
 	}
@@ -72,6 +75,7 @@ namespace catapult { namespace zeromq {
 
 		// Assert:
 		EXPECT_EQ(7902u, config.SubscriberPort);
+		EXPECT_FALSE(config.EnableBlockTransactionsCoalescing);
 	}
 
 	// endregion
@@ -51,6 +51,9 @@ namespace catapult { namespace zeromq {
 		}
 
 		class EntityPublisherContext : public test::MqContext {
+		public:
+			using MqContext::MqContext;
+
 		public:
 			void publishBlockHeader(const model::BlockElement& blockElement) {
 				publisher().publishBlockHeader(blockElement);
@@ -68,10 +71,25 @@ namespace catapult { namespace zeromq {
 				publisher().publishTransaction(topicMarker, transactionElement, height);
 			}
 
+			void publishTransactions(
+					TransactionMarker topicMarker,
+					const std::vector<model::TransactionElement>& transactionElements,
+					Height height) {
+				publisher().publishTransactions(topicMarker, transactionElements, height);
+			}
+
+			void publishTransactions(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos, Height height) {
+				publisher().publishTransactions(topicMarker, transactionInfos, height);
+			}
+
 			void publishTransactionHash(TransactionMarker topicMarker, const model::TransactionInfo& transactionInfo) {
 				publisher().publishTransactionHash(topicMarker, transactionInfo);
 			}
 
+			void publishTransactionHashes(TransactionMarker topicMarker, const model::TransactionInfosSet& transactionInfos) {
+				publisher().publishTransactionHashes(topicMarker, transactionInfos);
+			}
+
 			void publishTransactionStatus(const model::Transaction& transaction, const Hash256& hash, uint32_t status) {
 				publisher().publishTransactionStatus(transaction, hash, status);
 			}
@@ -261,6 +279,121 @@ namespace catapult { namespace zeromq {
 
 	// endregion
 
+	// region publishTransactions
+
+	namespace {
+		std::vector<model::TransactionElement> CreateTransactionElementsWithAddresses(
+				const std::vector<std::unique_ptr<mocks::MockTransaction>>& transactions,
+				const std::vector<model::UnresolvedAddressSet>& addressSets) {
+			std::vector<model::TransactionElement> transactionElements;
+			for (auto i = 0u; i < transactions.size(); ++i) {
+				transactionElements.push_back(ToTransactionElement(*transactions[i]));
+				transactionElements.back().OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>(addressSets[i]);
+			}
+
+			return transactionElements;
+		}
+
+		std::shared_ptr<model::UnresolvedAddressSet> CreateAddressSetPointer(const UnresolvedAddress& address) {
+			return std::make_shared<model::UnresolvedAddressSet>(model::UnresolvedAddressSet{ address });
+		}
+
+		std::vector<std::unique_ptr<mocks::MockTransaction>> CreateMockTransactions(size_t count) {
+			std::vector<std::unique_ptr<mocks::MockTransaction>> transactions;
+			for (auto i = 0u; i < count; ++i)
+				transactions.push_back(mocks::CreateMockTransaction(0));
+
+			return transactions;
+		}
+	}
+
+	TEST(TEST_CLASS, CanPublishTransactions_TransactionElements) {
+		// Arrange:
+		EntityPublisherContext context;
+		auto transactions = CreateMockTransactions(2);
+		auto addresses1 = *GenerateRandomExtractedAddresses();
+		auto addresses2 = *GenerateRandomExtractedAddresses();
+		auto transactionElements = CreateTransactionElementsWithAddresses(transactions, { addresses1, addresses2 });
+		Height height(123);
+		context.subscribeAll(Marker, addresses1);
+		context.subscribeAll(Marker, addresses2);
+
+		// Act:
+		context.publishTransactions(Marker, transactionElements, height);
+
+		// Assert: messages are published for each transaction in order
+		auto& zmqSocket = context.zmqSocket();
+		for (const auto& transactionElement : transactionElements) {
+			const auto& addresses = *transactionElement.OptionalExtractedAddresses;
+			test::AssertMessages(zmqSocket, Marker, addresses, [&transactionElement, height](const auto& message, const auto& topic) {
+				test::AssertTransactionElementMessage(message, topic, transactionElement, height);
+			});
+		}
+
+		test::AssertNoPendingMessages(zmqSocket);
+	}
+
+	TEST(TEST_CLASS, CanPublishCoalescedTransactions_TransactionElements) {
+		// Arrange: first address is shared by all transactions, second address is only associated with the second transaction
+		EntityPublisherContext context(BlockTransactionsMode::Coalesced);
+		auto transactions = CreateMockTransactions(3);
+		auto sharedAddress = test::GenerateRandomByteArray<UnresolvedAddress>();
+		auto secondAddress = test::GenerateRandomByteArray<UnresolvedAddress>();
+		auto transactionElements = CreateTransactionElementsWithAddresses(transactions, {
+			{ sharedAddress }, { sharedAddress, secondAddress }, { sharedAddress }
+		});
+		Height height(123);
+		context.subscribeAll(Marker, { sharedAddress, secondAddress });
+
+		// Act:
+		context.publishTransactions(Marker, transactionElements, height);
+
+		// Assert: a single message is published for each address
+		auto& zmqSocket = context.zmqSocket();
+		test::AssertMessages(zmqSocket, Marker, { sharedAddress, secondAddress }, [&](const auto& message, const auto& topic) {
+			std::vector<const model::TransactionElement*> expectedTransactionElements{ &transactionElements[1] };
+			if (CreateTopic(Marker, sharedAddress) == topic)
+				expectedTransactionElements = { &transactionElements[0], &transactionElements[1], &transactionElements[2] };
+
+			test::AssertCoalescedTransactionElementsMessage(message, topic, expectedTransactionElements, height);
+		});
+
+		test::AssertNoPendingMessages(zmqSocket);
+	}
+
+	TEST(TEST_CLASS, CanPublishTransactions_TransactionInfos) {
+		// Arrange: associate each transaction with a single distinct address
+		EntityPublisherContext context;
+		std::map<UnresolvedAddress, model::TransactionInfo> addressToTransactionInfoMap;
+		model::TransactionInfosSet transactionInfos;
+		for (auto i = 0u; i < 3; ++i) {
+			auto address = test::GenerateRandomByteArray<UnresolvedAddress>();
+			auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0));
+			transactionInfo.OptionalExtractedAddresses = CreateAddressSetPointer(address);
+			transactionInfos.emplace(transactionInfo.copy());
+			addressToTransactionInfoMap.emplace(address, std::move(transactionInfo));
+		}
+
+		Height height(123);
+		model::UnresolvedAddressSet addresses;
+		for (const auto& pair : addressToTransactionInfoMap)
+			addresses.insert(pair.first);
+
+		context.subscribeAll(Marker, addresses);
+
+		// Act:
+		context.publishTransactions(Marker, transactionInfos, height);
+
+		// Assert:
+		const auto& transactionInfoMap = addressToTransactionInfoMap;
+		test::AssertMessages(context.zmqSocket(), Marker, addresses, [&transactionInfoMap, height](const auto& message, const auto& topic) {
+			const auto& address = reinterpret_cast<const UnresolvedAddress&>(topic[1]);
+			test::AssertTransactionInfoMessage(message, topic, transactionInfoMap.at(address), height);
+		});
+	}
+
+	// endregion
+
 	// region publishTransactionHash
 
 	namespace {
@@ -297,6 +430,35 @@ namespace catapult { namespace zeromq {
 		});
 	}
 
+	TEST(TEST_CLASS, CanPublishTransactionHashes) {
+		// Arrange: associate each transaction with a single distinct address
+		EntityPublisherContext context;
+		std::map<UnresolvedAddress, Hash256> addressToHashMap;
+		model::TransactionInfosSet transactionInfos;
+		for (auto i = 0u; i < 3; ++i) {
+			auto address = test::GenerateRandomByteArray<UnresolvedAddress>();
+			auto transactionInfo = ToTransactionInfo(mocks::CreateMockTransaction(0));
+			transactionInfo.OptionalExtractedAddresses = CreateAddressSetPointer(address);
+			addressToHashMap.emplace(address, transactionInfo.EntityHash);
+			transactionInfos.emplace(std::move(transactionInfo));
+		}
+
+		model::UnresolvedAddressSet addresses;
+		for (const auto& pair : addressToHashMap)
+			addresses.insert(pair.first);
+
+		context.subscribeAll(Marker, addresses);
+
+		// Act:
+		context.publishTransactionHashes(Marker, transactionInfos);
+
+		// Assert:
+		test::AssertMessages(context.zmqSocket(), Marker, addresses, [&addressToHashMap](const auto& message, const auto& topic) {
+			const auto& address = reinterpret_cast<const UnresolvedAddress&>(topic[1]);
+			test::AssertTransactionHashMessage(message, topic, addressToHashMap.at(address));
+		});
+	}
+
 	// endregion
 
 	// region publishTransactionStatus
@@ -130,6 +130,24 @@ namespace catapult { namespace test {
 		AssertMessagePart(message[4], &height, sizeof(Height));
 	}
 
+	void AssertCoalescedTransactionElementsMessage(
+			const zmq::multipart_t& message,
+			const std::vector<uint8_t>& topic,
+			const std::vector<const model::TransactionElement*>& transactionElements,
+			Height height) {
+		ASSERT_EQ(1 + 4 * transactionElements.size(), message.size());
+
+		AssertMessagePart(message[0], topic.data(), topic.size());
+		for (auto i = 0u; i < transactionElements.size(); ++i) {
+			const auto& transactionElement = *transactionElements[i];
+			const auto& transaction = transactionElement.Transaction;
+			AssertMessagePart(message[1 + 4 * i], &transaction, transaction.Size);
+			AssertMessagePart(message[2 + 4 * i], &transactionElement.EntityHash, Hash256::Size);
+			AssertMessagePart(message[3 + 4 * i], &transactionElement.MerkleComponentHash, Hash256::Size);
+			AssertMessagePart(message[4 + 4 * i], &height, sizeof(Height));
+		}
+	}
+
 	void AssertTransactionInfoMessage(
 			const zmq::multipart_t& message,
 			const std::vector<uint8_t>& topic,
@@ -81,6 +81,14 @@ namespace catapult { namespace test {
 			const model::TransactionElement& transactionElement,
 			Height height);
 
+	/// Asserts that the given \a message has \a topic as first part followed by the data of all \a transactionElements
+	/// (in order) and \a height.
+	void AssertCoalescedTransactionElementsMessage(
+			const zmq::multipart_t& message,
+			const std::vector<uint8_t>& topic,
+			const std::vector<const model::TransactionElement*>& transactionElements,
+			Height height);
+
 	/// Asserts that the given \a message has \a topic as first part and matches the data in \a transactionInfo and \a height.
 	void AssertTransactionInfoMessage(
 			const zmq::multipart_t& message,
@@ -117,12 +125,13 @@ namespace catapult { namespace test {
 	/// Base context for all zeromq related contexts.
 	class MqContext {
 	public:
-		/// Creates a message queue context.
-		MqContext()
+		/// Creates a message queue context with optional \a blockTransactionsMode.
+		explicit MqContext(zeromq::BlockTransactionsMode blockTransactionsMode = zeromq::BlockTransactionsMode::Individual)
 				: m_registry(mocks::CreateDefaultTransactionRegistry())
 				, m_pZeroMqEntityPublisher(std::make_shared<zeromq::ZeroMqEntityPublisher>(
 						GetDefaultLocalHostZmqPort(),
-						model::CreateNotificationPublisher(m_registry, UnresolvedMosaicId())))
+						model::CreateNotificationPublisher(m_registry, UnresolvedMosaicId()),
+						blockTransactionsMode))
 				, m_zmqSocket(m_zmqContext, ZMQ_SUB) {
 			m_zmqSocket.setsockopt(ZMQ_RCVTIMEO, 10);
 			m_zmqSocket.connect("tcp://localhost:" + std::to_string(GetDefaultLocalHostZmqPort()));
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "TimeBucketedHashSet.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
@@ -63,8 +64,62 @@ namespace catapult { namespace cache {
 		}
 	};
 
+	/// Defines cache types for an immutable set based cache that is backed by a time-bucketed hash set in memory.
+	template<typename TDescriptor>
+	struct ImmutableTimeBucketedHashSetAdapter {
+	private:
+		struct DescriptorAdapter {
+		public:
+			using KeyType = typename TDescriptor::KeyType;
+			using ValueType = typename TDescriptor::ValueType;
+			using StorageType = typename TDescriptor::KeyType;
+			using Serializer = typename TDescriptor::Serializer;
+
+			static constexpr auto GetKeyFromValue = TDescriptor::GetKeyFromValue;
+
+			static constexpr auto& ToKey(const StorageType& element) {
+				return element;
+			}
+
+			static constexpr auto& ToValue(const StorageType& element) {
+				return element;
+			}
+
+			static constexpr auto& ToStorage(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using ElementTraits = deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>;
+		using StorageSetType = CacheContainerView<DescriptorAdapter>;
+		using MemorySetType = TimeBucketedHashSet;
+
+		// workaround for VS truncation
+		using SetStorageTraits = deltaset::SetStorageTraits<
+			deltaset::ConditionalContainer<
+				deltaset::SetKeyTraits<MemorySetType>,
+				StorageSetType,
+				MemorySetType
+			>,
+			MemorySetType
+		>;
+
+		struct StorageTraits : public SetStorageTraits {};
+
+	public:
+		/// Base set type.
+		using BaseSetType = deltaset::OrderedSet<ElementTraits, StorageTraits>;
+
+		/// Base set delta type.
+		using BaseSetDeltaType = typename BaseSetType::DeltaType;
+
+		/// Base set delta pointer type.
+		using BaseSetDeltaPointerType = std::shared_ptr<BaseSetDeltaType>;
+	};
+
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	/// \note In memory, timestamped hashes are stored in time buckets so that lookups are constant time and pruning drops whole buckets.
+	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableTimeBucketedHashSetAdapter<HashCacheDescriptor>, std::true_type> {
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
@@ -0,0 +1,331 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TimeBucketedHashSet.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr uint8_t Control_Empty = 0x00;
+		constexpr uint8_t Control_Deleted = 0x01;
+		constexpr uint8_t Control_Full_Flag = 0x80;
+
+		constexpr size_t Min_Bucket_Capacity = 8;
+
+		uint64_t TruncateHash(const state::TimestampedHash& timestampedHash) {
+			uint64_t truncatedHash;
+			std::memcpy(&truncatedHash, timestampedHash.Hash.data(), sizeof(uint64_t));
+			return truncatedHash;
+		}
+
+		// use the high bits (that are not used for indexing) as a fingerprint in order to avoid most element comparisons
+		uint8_t ToFullControl(uint64_t truncatedHash) {
+			return static_cast<uint8_t>(Control_Full_Flag | (truncatedHash >> 57));
+		}
+
+		bool IsFull(uint8_t control) {
+			return 0 != (Control_Full_Flag & control);
+		}
+
+		bool RequiresRehash(size_t numUsedSlots, size_t capacity) {
+			// keep load factor (including tombstones) at or below 7/8
+			return 8 * numUsedSlots > 7 * capacity;
+		}
+	}
+
+	size_t TimeBucketedHashSet::Hasher::operator()(const state::TimestampedHash& timestampedHash) const {
+		return static_cast<size_t>(TruncateHash(timestampedHash));
+	}
+
+	// region const_iterator
+
+	TimeBucketedHashSet::const_iterator::const_iterator()
+			: m_pSet(nullptr)
+			, m_bucketIndex(0)
+			, m_slotIndex(0)
+	{}
+
+	TimeBucketedHashSet::const_iterator::const_iterator(const TimeBucketedHashSet& set, size_t bucketIndex, size_t slotIndex)
+			: m_pSet(&set)
+			, m_bucketIndex(bucketIndex)
+			, m_slotIndex(slotIndex)
+	{}
+
+	bool TimeBucketedHashSet::const_iterator::operator==(const const_iterator& rhs) const {
+		return m_pSet == rhs.m_pSet && m_bucketIndex == rhs.m_bucketIndex && m_slotIndex == rhs.m_slotIndex;
+	}
+
+	bool TimeBucketedHashSet::const_iterator::operator!=(const const_iterator& rhs) const {
+		return !(*this == rhs);
+	}
+
+	TimeBucketedHashSet::const_iterator& TimeBucketedHashSet::const_iterator::operator++() {
+		*this = m_pSet->makeIterator(m_bucketIndex, m_slotIndex + 1);
+		return *this;
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::const_iterator::operator++(int) {
+		auto copy = *this;
+		++*this;
+		return copy;
+	}
+
+	TimeBucketedHashSet::const_iterator::reference TimeBucketedHashSet::const_iterator::operator*() const {
+		return m_pSet->m_buckets[m_bucketIndex].Slots[m_slotIndex];
+	}
+
+	TimeBucketedHashSet::const_iterator::pointer TimeBucketedHashSet::const_iterator::operator->() const {
+		return &**this;
+	}
+
+	// endregion
+
+	TimeBucketedHashSet::TimeBucketedHashSet(uint8_t bucketTimeBits)
+			: m_bucketTimeBits(bucketTimeBits)
+			, m_size(0)
+	{}
+
+	// region size
+
+	bool TimeBucketedHashSet::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TimeBucketedHashSet::size() const {
+		return m_size;
+	}
+
+	size_t TimeBucketedHashSet::numBuckets() const {
+		return m_buckets.size();
+	}
+
+	// endregion
+
+	// region iteration / find
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::begin() const {
+		return makeIterator(0, 0);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::end() const {
+		return const_iterator(*this, m_buckets.size(), 0);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::cbegin() const {
+		return begin();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::cend() const {
+		return end();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::find(const key_type& key) const {
+		auto bucketIndex = findBucketIndex(windowId(key));
+		if (m_buckets.size() == bucketIndex || m_buckets[bucketIndex].WindowId != windowId(key))
+			return end();
+
+		const auto& bucket = m_buckets[bucketIndex];
+		auto slotIndex = findSlotIndex(bucket, key);
+		return bucket.Slots.size() == slotIndex ? end() : const_iterator(*this, bucketIndex, slotIndex);
+	}
+
+	// endregion
+
+	// region insert / erase
+
+	namespace {
+		size_t FindInsertSlotIndex(const std::vector<uint8_t>& controls, uint64_t truncatedHash) {
+			auto mask = controls.size() - 1;
+			auto slotIndex = static_cast<size_t>(truncatedHash) & mask;
+			while (IsFull(controls[slotIndex]))
+				slotIndex = (slotIndex + 1) & mask;
+
+			return slotIndex;
+		}
+
+		template<typename TBucket>
+		void Rehash(TBucket& bucket, size_t capacity) {
+			std::vector<uint8_t> controls(capacity, Control_Empty);
+			std::vector<state::TimestampedHash> slots(capacity);
+			for (auto i = 0u; i < bucket.Controls.size(); ++i) {
+				if (!IsFull(bucket.Controls[i]))
+					continue;
+
+				auto slotIndex = FindInsertSlotIndex(controls, TruncateHash(bucket.Slots[i]));
+				controls[slotIndex] = bucket.Controls[i];
+				slots[slotIndex] = bucket.Slots[i];
+			}
+
+			bucket.Controls = std::move(controls);
+			bucket.Slots = std::move(slots);
+			bucket.NumTombstones = 0;
+		}
+	}
+
+	std::pair<TimeBucketedHashSet::const_iterator, bool> TimeBucketedHashSet::insert(const value_type& value) {
+		auto id = windowId(value);
+		auto bucketIndex = findBucketIndex(id);
+		if (m_buckets.size() == bucketIndex || m_buckets[bucketIndex].WindowId != id) {
+			auto controls = std::vector<uint8_t>(Min_Bucket_Capacity, Control_Empty);
+			auto bucket = Bucket{ id, std::move(controls), std::vector<value_type>(Min_Bucket_Capacity), 0, 0 };
+			m_buckets.insert(m_buckets.begin() + static_cast<std::ptrdiff_t>(bucketIndex), std::move(bucket));
+		}
+
+		auto& bucket = m_buckets[bucketIndex];
+		auto existingSlotIndex = findSlotIndex(bucket, value);
+		if (bucket.Slots.size() != existingSlotIndex)
+			return std::make_pair(const_iterator(*this, bucketIndex, existingSlotIndex), false);
+
+		if (RequiresRehash(bucket.NumElements + bucket.NumTombstones + 1, bucket.Slots.size())) {
+			// only grow when live elements require it, otherwise rehashing in place is sufficient to purge tombstones
+			auto capacity = bucket.Slots.size();
+			Rehash(bucket, RequiresRehash(2 * (bucket.NumElements + 1), capacity) ? 2 * capacity : capacity);
+		}
+
+		auto truncatedHash = TruncateHash(value);
+		auto slotIndex = FindInsertSlotIndex(bucket.Controls, truncatedHash);
+		if (Control_Deleted == bucket.Controls[slotIndex])
+			--bucket.NumTombstones;
+
+		bucket.Controls[slotIndex] = ToFullControl(truncatedHash);
+		bucket.Slots[slotIndex] = value;
+		++bucket.NumElements;
+		++m_size;
+		return std::make_pair(const_iterator(*this, bucketIndex, slotIndex), true);
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::insert(const_iterator, const value_type& value) {
+		return insert(value).first;
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::erase(const_iterator iter) {
+		return eraseSlot(iter.m_bucketIndex, iter.m_slotIndex);
+	}
+
+	size_t TimeBucketedHashSet::erase(const key_type& key) {
+		auto iter = find(key);
+		if (end() == iter)
+			return 0;
+
+		erase(iter);
+		return 1;
+	}
+
+	void TimeBucketedHashSet::clear() {
+		m_buckets.clear();
+		m_size = 0;
+	}
+
+	void TimeBucketedHashSet::prune(const value_type& boundary) {
+		// drop all buckets that only contain elements with timestamps prior to the boundary
+		auto boundaryWindowId = windowId(boundary);
+		auto numPrunedBuckets = findBucketIndex(boundaryWindowId);
+		for (auto i = 0u; i < numPrunedBuckets; ++i)
+			m_size -= m_buckets[i].NumElements;
+
+		m_buckets.erase(m_buckets.begin(), m_buckets.begin() + static_cast<std::ptrdiff_t>(numPrunedBuckets));
+		if (m_buckets.empty() || m_buckets[0].WindowId != boundaryWindowId)
+			return;
+
+		// the first remaining bucket can contain elements on both sides of the boundary
+		auto& bucket = m_buckets[0];
+		for (auto i = 0u; i < bucket.Slots.size(); ++i) {
+			if (!IsFull(bucket.Controls[i]) || !(bucket.Slots[i] < boundary))
+				continue;
+
+			bucket.Controls[i] = Control_Deleted;
+			--bucket.NumElements;
+			++bucket.NumTombstones;
+			--m_size;
+		}
+
+		if (0 == bucket.NumElements)
+			m_buckets.erase(m_buckets.begin());
+	}
+
+	// endregion
+
+	// region private helpers
+
+	uint64_t TimeBucketedHashSet::windowId(const value_type& value) const {
+		return value.Time.unwrap() >> m_bucketTimeBits;
+	}
+
+	size_t TimeBucketedHashSet::findBucketIndex(uint64_t windowId) const {
+		auto iter = std::lower_bound(m_buckets.cbegin(), m_buckets.cend(), windowId, [](const auto& bucket, auto id) {
+			return bucket.WindowId < id;
+		});
+		return static_cast<size_t>(std::distance(m_buckets.cbegin(), iter));
+	}
+
+	size_t TimeBucketedHashSet::findSlotIndex(const Bucket& bucket, const key_type& key) const {
+		auto truncatedHash = TruncateHash(key);
+		auto fullControl = ToFullControl(truncatedHash);
+
+		auto mask = bucket.Slots.size() - 1;
+		auto slotIndex = static_cast<size_t>(truncatedHash) & mask;
+		for (auto i = 0u; i < bucket.Slots.size(); ++i) {
+			auto control = bucket.Controls[slotIndex];
+			if (Control_Empty == control)
+				break;
+
+			if (fullControl == control && key == bucket.Slots[slotIndex])
+				return slotIndex;
+
+			slotIndex = (slotIndex + 1) & mask;
+		}
+
+		return bucket.Slots.size();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::makeIterator(size_t bucketIndex, size_t slotIndex) const {
+		for (; bucketIndex < m_buckets.size(); ++bucketIndex, slotIndex = 0) {
+			const auto& controls = m_buckets[bucketIndex].Controls;
+			for (; slotIndex < controls.size(); ++slotIndex) {
+				if (IsFull(controls[slotIndex]))
+					return const_iterator(*this, bucketIndex, slotIndex);
+			}
+		}
+
+		return end();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::eraseSlot(size_t bucketIndex, size_t slotIndex) {
+		auto& bucket = m_buckets[bucketIndex];
+		bucket.Controls[slotIndex] = Control_Deleted;
+		--bucket.NumElements;
+		++bucket.NumTombstones;
+		--m_size;
+
+		if (0 != bucket.NumElements)
+			return makeIterator(bucketIndex, slotIndex + 1);
+
+		m_buckets.erase(m_buckets.begin() + static_cast<std::ptrdiff_t>(bucketIndex));
+		return makeIterator(bucketIndex, 0);
+	}
+
+	// endregion
+
+	void PruneBaseSet(TimeBucketedHashSet& elements, const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary) {
+		elements.prune(pruningBoundary.value());
+	}
+}}
@@ -0,0 +1,182 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/deltaset/PruningBoundary.h"
+#include "catapult/state/TimestampedHash.h"
+#include <functional>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Set of timestamped hashes that is partitioned into time windows (buckets) ordered by time.
+	/// Each bucket is an open-addressing hash table keyed by the (truncated) hash, so lookups do not depend on the number of
+	/// buckets and pruning can drop whole buckets at once.
+	/// \note Elements are iterated in bucket order but are unordered within a bucket.
+	/// \note Insertions and removals invalidate iterators and references.
+	class TimeBucketedHashSet {
+	public:
+		using value_type = state::TimestampedHash;
+		using key_type = state::TimestampedHash;
+
+		/// Hashes a timestamped hash by truncating its hash.
+		struct Hasher {
+			size_t operator()(const state::TimestampedHash& timestampedHash) const;
+		};
+
+		using hasher = Hasher;
+		using key_equal = std::equal_to<state::TimestampedHash>;
+
+		/// Default number of timestamp bits covered by a single bucket (~17.5 minutes).
+		static constexpr uint8_t Default_Bucket_Time_Bits = 20;
+
+	private:
+		struct Bucket {
+			uint64_t WindowId;
+			std::vector<uint8_t> Controls;
+			std::vector<value_type> Slots;
+			size_t NumElements;
+			size_t NumTombstones;
+		};
+
+	public:
+		/// Const iterator.
+		class const_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = const state::TimestampedHash;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates an uninitialized iterator.
+			const_iterator();
+
+			/// Creates an iterator pointing to the slot at \a slotIndex in the bucket at \a bucketIndex in \a set.
+			const_iterator(const TimeBucketedHashSet& set, size_t bucketIndex, size_t slotIndex);
+
+		public:
+			/// Returns \c true if this iterator and \a rhs are equal.
+			bool operator==(const const_iterator& rhs) const;
+
+			/// Returns \c true if this iterator and \a rhs are not equal.
+			bool operator!=(const const_iterator& rhs) const;
+
+		public:
+			/// Advances the iterator to the next position.
+			const_iterator& operator++();
+
+			/// Advances the iterator to the next position.
+			const_iterator operator++(int);
+
+		public:
+			/// Gets a reference to the current element.
+			reference operator*() const;
+
+			/// Gets a pointer to the current element.
+			pointer operator->() const;
+
+		private:
+			friend class TimeBucketedHashSet;
+
+			const TimeBucketedHashSet* m_pSet;
+			size_t m_bucketIndex;
+			size_t m_slotIndex;
+		};
+
+		using iterator = const_iterator;
+
+	public:
+		/// Creates an empty set with buckets that each cover 2^\a bucketTimeBits timestamp units.
+		explicit TimeBucketedHashSet(uint8_t bucketTimeBits = Default_Bucket_Time_Bits);
+
+	public:
+		/// Returns \c true if the set is empty.
+		bool empty() const;
+
+		/// Gets the number of elements in the set.
+		size_t size() const;
+
+		/// Gets the number of (non-empty) buckets in the set.
+		size_t numBuckets() const;
+
+	public:
+		/// Gets a const iterator to the first element.
+		const_iterator begin() const;
+
+		/// Gets a const iterator to the element following the last element.
+		const_iterator end() const;
+
+		/// Gets a const iterator to the first element.
+		const_iterator cbegin() const;
+
+		/// Gets a const iterator to the element following the last element.
+		const_iterator cend() const;
+
+		/// Searches for \a key in the set.
+		const_iterator find(const key_type& key) const;
+
+	public:
+		/// Inserts \a value into the set.
+		std::pair<const_iterator, bool> insert(const value_type& value);
+
+		/// Inserts \a value into the set (\a hint is ignored).
+		const_iterator insert(const_iterator hint, const value_type& value);
+
+		/// Inserts all values in the range [\a begin, \a end) into the set.
+		template<typename TIterator>
+		void insert(TIterator begin, TIterator end) {
+			for (auto iter = begin; end != iter; ++iter)
+				insert(*iter);
+		}
+
+		/// Removes the element pointed to by \a iter and returns an iterator to the following element.
+		const_iterator erase(const_iterator iter);
+
+		/// Removes the element with \a key from the set and returns the number of removed elements.
+		size_t erase(const key_type& key);
+
+		/// Removes all elements from the set.
+		void clear();
+
+		/// Removes all elements that are less than \a boundary.
+		void prune(const value_type& boundary);
+
+	private:
+		uint64_t windowId(const value_type& value) const;
+
+		size_t findBucketIndex(uint64_t windowId) const;
+
+		size_t findSlotIndex(const Bucket& bucket, const key_type& key) const;
+
+		const_iterator makeIterator(size_t bucketIndex, size_t slotIndex) const;
+
+		const_iterator eraseSlot(size_t bucketIndex, size_t slotIndex);
+
+	private:
+		uint8_t m_bucketTimeBits;
+		std::vector<Bucket> m_buckets;
+		size_t m_size;
+	};
+
+	/// Prunes all elements in \a elements that are less than the value of \a pruningBoundary.
+	void PruneBaseSet(TimeBucketedHashSet& elements, const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary);
+}}
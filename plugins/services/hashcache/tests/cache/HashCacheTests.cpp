@@ -22,6 +22,7 @@
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/CacheMixinsTests.h"
 #include "tests/test/cache/DeltaElementsMixinTests.h"
+#include "tests/test/nodeps/Random.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -68,7 +69,7 @@ namespace catapult { namespace cache {
 	DEFINE_CACHE_CONTAINS_TESTS(HashCacheMixinTraits, ViewAccessor, _View)
 	DEFINE_CACHE_CONTAINS_TESTS(HashCacheMixinTraits, DeltaAccessor, _Delta)
 
-	DEFINE_CACHE_ITERATION_TESTS_ORDERING(HashCacheMixinTraits, ViewAccessor, Ordered, _View)
+	DEFINE_CACHE_ITERATION_TESTS(HashCacheMixinTraits, ViewAccessor, _View)
 
 	DEFINE_CACHE_MUTATION_TESTS(HashCacheMixinTraits, DeltaAccessor, _Delta)
 
@@ -119,5 +120,34 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(state::TimestampedHash::HashType(), pruningBoundary.value().Hash);
 	}
 
+	TEST(TEST_CLASS, CommitRemovesAllElementsPriorToPruningBoundary) {
+		// Arrange: add hashes every 30 minutes so that they span multiple time buckets
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(1));
+		std::vector<state::TimestampedHash> timestampedHashes;
+		for (auto i = 0u; i < 10; ++i)
+			timestampedHashes.emplace_back(Timestamp(i * 30 * 60 * 1000), test::GenerateRandomByteArray<Hash256>());
+
+		{
+			auto delta = cache.createDelta();
+			for (const auto& timestampedHash : timestampedHashes)
+				delta->insert(timestampedHash);
+
+			cache.commit();
+		}
+
+		// Act (4 hours):
+		{
+			auto delta = cache.createDelta();
+			delta->prune(Timestamp(4 * 60 * 60 * 1000));
+			cache.commit();
+		}
+
+		// Assert (4 - 1 hours): only hashes with timestamps at or after 3 hours remain
+		auto view = cache.createView();
+		EXPECT_EQ(4u, view->size());
+		for (auto i = 0u; i < timestampedHashes.size(); ++i)
+			EXPECT_EQ(i >= 6, view->contains(timestampedHashes[i])) << "hash at " << i;
+	}
+
 	// endregion
 }}
@@ -0,0 +1,331 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/TimeBucketedHashSet.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimeBucketedHashSetTests
+
+	namespace {
+		constexpr uint8_t Bucket_Time_Bits = 10; // 1024 ms per bucket
+
+		state::TimestampedHash CreateTimestampedHash(uint64_t timestamp) {
+			return state::TimestampedHash(Timestamp(timestamp), test::GenerateRandomByteArray<Hash256>());
+		}
+
+		std::vector<state::TimestampedHash> CreateTimestampedHashes(const std::vector<uint64_t>& timestamps) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto timestamp : timestamps)
+				timestampedHashes.push_back(CreateTimestampedHash(timestamp));
+
+			return timestampedHashes;
+		}
+
+		TimeBucketedHashSet CreateSet(const std::vector<state::TimestampedHash>& timestampedHashes) {
+			TimeBucketedHashSet set(Bucket_Time_Bits);
+			set.insert(timestampedHashes.cbegin(), timestampedHashes.cend());
+			return set;
+		}
+
+		std::set<state::TimestampedHash> Collect(const TimeBucketedHashSet& set) {
+			return std::set<state::TimestampedHash>(set.cbegin(), set.cend());
+		}
+
+		void AssertContents(const std::vector<state::TimestampedHash>& expectedElements, const TimeBucketedHashSet& set) {
+			EXPECT_EQ(expectedElements.size(), set.size());
+			EXPECT_EQ(expectedElements.empty(), set.empty());
+			EXPECT_EQ(std::set<state::TimestampedHash>(expectedElements.cbegin(), expectedElements.cend()), Collect(set));
+
+			for (const auto& element : expectedElements)
+				EXPECT_NE(set.cend(), set.find(element)) << element;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptySet) {
+		// Act:
+		TimeBucketedHashSet set;
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.size());
+		EXPECT_EQ(0u, set.numBuckets());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	// endregion
+
+	// region insert / find
+
+	TEST(TEST_CLASS, CanInsertSingleElement) {
+		// Arrange:
+		TimeBucketedHashSet set(Bucket_Time_Bits);
+		auto timestampedHash = CreateTimestampedHash(1234);
+
+		// Act:
+		auto result = set.insert(timestampedHash);
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(timestampedHash, *result.first);
+		EXPECT_EQ(1u, set.numBuckets());
+		AssertContents({ timestampedHash }, set);
+	}
+
+	TEST(TEST_CLASS, InsertOfExistingElementHasNoEffect) {
+		// Arrange:
+		TimeBucketedHashSet set(Bucket_Time_Bits);
+		auto timestampedHash = CreateTimestampedHash(1234);
+		set.insert(timestampedHash);
+
+		// Act:
+		auto result = set.insert(timestampedHash);
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(timestampedHash, *result.first);
+		AssertContents({ timestampedHash }, set);
+	}
+
+	TEST(TEST_CLASS, CanInsertManyElementsIntoSingleBucket) {
+		// Arrange: force multiple table resizes
+		std::vector<uint64_t> timestamps;
+		for (auto i = 0u; i < 1000; ++i)
+			timestamps.push_back(i);
+
+		auto timestampedHashes = CreateTimestampedHashes(timestamps);
+
+		// Act:
+		auto set = CreateSet(timestampedHashes);
+
+		// Assert:
+		EXPECT_EQ(1u, set.numBuckets());
+		AssertContents(timestampedHashes, set);
+	}
+
+	TEST(TEST_CLASS, CanInsertElementsIntoMultipleBuckets) {
+		// Arrange: insert out of order
+		auto timestampedHashes = CreateTimestampedHashes({ 5000, 10, 3000, 1023, 1024, 100'000, 2 });
+
+		// Act:
+		auto set = CreateSet(timestampedHashes);
+
+		// Assert: buckets { 0, 1, 2, 4, 97 }
+		EXPECT_EQ(5u, set.numBuckets());
+		AssertContents(timestampedHashes, set);
+	}
+
+	TEST(TEST_CLASS, IterationVisitsBucketsInTimeOrder) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashes({ 5000, 10, 3000, 1023, 1024, 100'000, 2 }));
+
+		// Act:
+		std::vector<uint64_t> bucketIds;
+		for (const auto& timestampedHash : set)
+			bucketIds.push_back(timestampedHash.Time.unwrap() >> Bucket_Time_Bits);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint64_t>({ 0, 0, 0, 1, 2, 4, 97 }), bucketIds);
+	}
+
+	TEST(TEST_CLASS, FindDistinguishesElementsWithSameHashAndDifferentTimestamps) {
+		// Arrange:
+		auto timestampedHash1 = CreateTimestampedHash(1000);
+		auto timestampedHash2 = state::TimestampedHash(Timestamp(1001), Hash256());
+		std::memcpy(timestampedHash2.Hash.data(), timestampedHash1.Hash.data(), timestampedHash1.Hash.size());
+
+		auto set = CreateSet({ timestampedHash1 });
+
+		// Act + Assert:
+		EXPECT_NE(set.cend(), set.find(timestampedHash1));
+		EXPECT_EQ(set.cend(), set.find(timestampedHash2));
+	}
+
+	TEST(TEST_CLASS, FindReturnsEndWhenElementIsNotPresent) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashes({ 10, 2000, 5000 }));
+
+		// Act + Assert: existing and missing buckets
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(11)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(3000)));
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseElementByKey) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 20, 2000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		auto numErased = set.erase(timestampedHashes[1]);
+
+		// Assert:
+		EXPECT_EQ(1u, numErased);
+		EXPECT_EQ(2u, set.numBuckets());
+		AssertContents({ timestampedHashes[0], timestampedHashes[2] }, set);
+	}
+
+	TEST(TEST_CLASS, EraseOfUnknownElementHasNoEffect) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 20, 2000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		auto numErased = set.erase(CreateTimestampedHash(20));
+
+		// Assert:
+		EXPECT_EQ(0u, numErased);
+		AssertContents(timestampedHashes, set);
+	}
+
+	TEST(TEST_CLASS, EraseOfLastElementInBucketRemovesBucket) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 2000, 5000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		auto iter = set.erase(set.find(timestampedHashes[1]));
+
+		// Assert: iterator points to first element in next bucket
+		EXPECT_EQ(2u, set.numBuckets());
+		EXPECT_EQ(timestampedHashes[2], *iter);
+		AssertContents({ timestampedHashes[0], timestampedHashes[2] }, set);
+	}
+
+	TEST(TEST_CLASS, CanEraseAllElementsWhileIterating) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashes({ 10, 20, 30, 2000, 2001, 5000 }));
+
+		// Act:
+		auto numErased = 0u;
+		for (auto iter = set.cbegin(); set.cend() != iter; ++numErased)
+			iter = set.erase(iter);
+
+		// Assert:
+		EXPECT_EQ(6u, numErased);
+		EXPECT_EQ(0u, set.numBuckets());
+		AssertContents({}, set);
+	}
+
+	TEST(TEST_CLASS, CanReinsertElementsAfterErase) {
+		// Arrange: repeatedly erase and insert in order to create and reuse tombstones
+		auto timestampedHashes = CreateTimestampedHashes(std::vector<uint64_t>(100, 10));
+		TimeBucketedHashSet set(Bucket_Time_Bits);
+		set.insert(timestampedHashes[0]);
+
+		// Act:
+		for (auto i = 1u; i < timestampedHashes.size(); ++i) {
+			set.insert(timestampedHashes[i]);
+			set.erase(timestampedHashes[i - 1]);
+		}
+
+		// Assert:
+		AssertContents({ timestampedHashes.back() }, set);
+	}
+
+	TEST(TEST_CLASS, CanClearSet) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashes({ 10, 2000, 5000 }));
+
+		// Act:
+		set.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, set.numBuckets());
+		AssertContents({}, set);
+	}
+
+	// endregion
+
+	// region prune
+
+	TEST(TEST_CLASS, PruneRemovesWholeBucketsPriorToBoundary) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 1100, 1200, 2048, 5000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		set.prune(state::TimestampedHash(Timestamp(2048)));
+
+		// Assert:
+		EXPECT_EQ(2u, set.numBuckets());
+		AssertContents({ timestampedHashes[3], timestampedHashes[4] }, set);
+	}
+
+	TEST(TEST_CLASS, PruneRemovesElementsPriorToBoundaryInBoundaryBucket) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 1100, 1200, 1300, 5000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		set.prune(state::TimestampedHash(Timestamp(1200)));
+
+		// Assert:
+		EXPECT_EQ(2u, set.numBuckets());
+		AssertContents({ timestampedHashes[2], timestampedHashes[3], timestampedHashes[4] }, set);
+	}
+
+	TEST(TEST_CLASS, PruneCanRemoveBoundaryBucket) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 1100, 1200, 5000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		set.prune(state::TimestampedHash(Timestamp(1201)));
+
+		// Assert:
+		EXPECT_EQ(1u, set.numBuckets());
+		AssertContents({ timestampedHashes[3] }, set);
+	}
+
+	TEST(TEST_CLASS, PruneCanRemoveAllElements) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashes({ 10, 1100, 1200, 5000 }));
+
+		// Act:
+		set.prune(state::TimestampedHash(Timestamp(100'000)));
+
+		// Assert:
+		EXPECT_EQ(0u, set.numBuckets());
+		AssertContents({}, set);
+	}
+
+	TEST(TEST_CLASS, PruneBaseSetDelegatesToPrune) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashes({ 10, 1100, 1200, 5000 });
+		auto set = CreateSet(timestampedHashes);
+
+		// Act:
+		PruneBaseSet(set, deltaset::PruningBoundary<state::TimestampedHash>(state::TimestampedHash(Timestamp(1200))));
+
+		// Assert:
+		AssertContents({ timestampedHashes[2], timestampedHashes[3] }, set);
+	}
+
+	// endregion
+}}
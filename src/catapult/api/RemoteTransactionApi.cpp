@@ -51,6 +51,51 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtSketchTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = UnconfirmedTransactionsSketchResult;
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Transactions_Sketch;
+			static constexpr auto Friendly_Name = "pull unconfirmed transactions by sketch";
+
+			static auto CreateRequestPacketPayload(BlockFeeMultiplier minFeeMultiplier, utils::ShortHashSketch&& knownShortHashesSketch) {
+				const auto* pCells = knownShortHashesSketch.data();
+				ionet::PacketPayloadBuilder builder(Packet_Type);
+				builder.appendValue(minFeeMultiplier);
+				builder.appendValues(std::vector<utils::ShortHashSketch::Cell>(pCells, pCells + knownShortHashesSketch.size()));
+				return builder.build();
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				// an empty response indicates that the remote node was unable to decode the difference
+				auto dataSize = ionet::CalculatePacketDataSize(packet);
+				result.IsDecoded = 0 != dataSize;
+				result.DifferenceSize = 0;
+				if (!result.IsDecoded)
+					return true;
+
+				// otherwise, the response is composed of the size of the difference followed by transactions
+				if (dataSize < sizeof(uint32_t))
+					return false;
+
+				result.DifferenceSize = reinterpret_cast<const uint32_t&>(*packet.Data());
+
+				auto entitiesBuffer = RawBuffer{ packet.Data() + sizeof(uint32_t), dataSize - sizeof(uint32_t) };
+				auto offsets = ionet::ExtractEntityOffsets<model::Transaction>(entitiesBuffer, *this);
+				if (offsets.empty())
+					return 0 == entitiesBuffer.Size;
+
+				result.Transactions = model::TransactionRange::CopyVariable(
+						entitiesBuffer.pData,
+						entitiesBuffer.Size,
+						offsets,
+						sizeof(uint64_t));
+				return true;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -75,6 +120,12 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<UtSketchTraits> unconfirmedTransactionsBySketch(
+					BlockFeeMultiplier minFeeMultiplier,
+					utils::ShortHashSketch&& knownShortHashesSketch) const override {
+				return m_impl.dispatch(UtSketchTraits(m_registry), minFeeMultiplier, std::move(knownShortHashesSketch));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -22,11 +22,24 @@
 #include "RemoteApi.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
+#include "catapult/utils/ShortHashSketch.h"
 
 namespace catapult { namespace ionet { class PacketIo; } }
 
 namespace catapult { namespace api {
 
+	/// Unconfirmed transactions returned by a remote node in response to a sketch of known short hashes.
+	struct UnconfirmedTransactionsSketchResult {
+		/// \c true if the remote node was able to decode the difference between its short hashes and the known short hashes.
+		bool IsDecoded;
+
+		/// Number of short hashes in the decoded difference.
+		uint32_t DifferenceSize;
+
+		/// Unconfirmed transactions unknown to the requester.
+		model::TransactionRange Transactions;
+	};
+
 	/// Api for retrieving transaction information from a remote node.
 	class RemoteTransactionApi : public RemoteApi {
 	protected:
@@ -40,6 +53,12 @@ namespace catapult { namespace api {
 		virtual thread::future<model::TransactionRange> unconfirmedTransactions(
 				BlockFeeMultiplier minFeeMultiplier,
 				model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote that have a fee multiplier at least \a minFeeMultiplier
+		/// and do not have a short hash in the set represented by \a knownShortHashesSketch.
+		virtual thread::future<UnconfirmedTransactionsSketchResult> unconfirmedTransactionsBySketch(
+				BlockFeeMultiplier minFeeMultiplier,
+				utils::ShortHashSketch&& knownShortHashesSketch) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io and \a remoteIdentity
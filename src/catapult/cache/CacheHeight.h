@@ -19,7 +19,7 @@
 **/
 
 #pragma once
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ScalableReaderWriterLock.h"
 #include "catapult/types.h"
 
 namespace catapult { namespace cache {
@@ -28,7 +28,7 @@ namespace catapult { namespace cache {
 	class CacheHeightView : public utils::MoveOnly {
 	public:
 		/// Creates a cache height view around \a height with lock context \a readLock.
-		CacheHeightView(Height height, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+		CacheHeightView(Height height, utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock)
 				: m_height(height)
 				, m_readLock(std::move(readLock))
 		{}
@@ -41,14 +41,14 @@ namespace catapult { namespace cache {
 
 	private:
 		Height m_height;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ScalableReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Write only view on top of a cache height.
 	class CacheHeightModifier : public utils::MoveOnly {
 	public:
 		/// Creates a write only view around \a height with lock context \a writeLock.
-		CacheHeightModifier(Height& height, utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+		CacheHeightModifier(Height& height, utils::ScalableReaderWriterLock::WriterLockGuard&& writeLock)
 				: m_height(height)
 				, m_writeLock(std::move(writeLock))
 		{}
@@ -61,7 +61,7 @@ namespace catapult { namespace cache {
 
 	private:
 		Height& m_height;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ScalableReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
 	/// Synchronized height associated with a catapult cache.
@@ -81,6 +81,6 @@ namespace catapult { namespace cache {
 
 	private:
 		Height m_height;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ScalableReaderWriterLock m_lock;
 	};
 }}
@@ -27,6 +27,8 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace cache {
@@ -47,15 +49,14 @@ namespace catapult { namespace cache {
 			return readOnlyViews;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TSubCacheViews>
+		std::vector<Hash256> CollectSubCacheMerkleRoots(const TSubCacheViews& subViews) {
 			std::vector<Hash256> merkleRoots;
 			for (const auto& pSubView : subViews) {
 				Hash256 merkleRoot;
 				if (!pSubView)
 					continue;
 
-				updateMerkleRoot(*pSubView);
 				if (pSubView->tryGetMerkleRoot(merkleRoot))
 					merkleRoots.push_back(merkleRoot);
 			}
@@ -78,12 +79,14 @@ namespace catapult { namespace cache {
 			return stateHash;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TSubCacheViews, typename TUpdateMerkleRoots>
+		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoots updateMerkleRoots) {
 			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::Warning);
 
+			updateMerkleRoots();
+
 			StateHashInfo stateHashInfo;
-			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot);
+			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews);
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
@@ -115,7 +118,7 @@ namespace catapult { namespace cache {
 	}
 
 	StateHashInfo CatapultCacheView::calculateStateHash() const {
-		return CalculateStateHashInfo(m_subViews, [](const auto&) {});
+		return CalculateStateHashInfo(m_subViews, []() {});
 	}
 
 	ReadOnlyCatapultCache CatapultCacheView::toReadOnly() const {
@@ -146,7 +149,33 @@ namespace catapult { namespace cache {
 	}
 
 	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height) const {
-		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
+		return CalculateStateHashInfo(m_subViews, [&subViews = m_subViews, height]() {
+			for (const auto& pSubView : subViews) {
+				if (pSubView)
+					pSubView->updateMerkleRoot(height);
+			}
+		});
+	}
+
+	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height, thread::IoThreadPool& pool) const {
+		return CalculateStateHashInfo(m_subViews, [&subViews = m_subViews, height, &pool]() {
+			// sub caches are independent, so their merkle roots can be updated concurrently
+			// (merkle roots are collected afterwards in sub cache order, so the state hash is unchanged)
+			std::vector<SubCacheView*> merkleSubViews;
+			for (const auto& pSubView : subViews) {
+				if (pSubView && pSubView->supportsMerkleRoot())
+					merkleSubViews.push_back(pSubView.get());
+			}
+
+			if (merkleSubViews.empty())
+				return;
+
+			auto numPartitions = std::min(merkleSubViews.size(), static_cast<size_t>(pool.numWorkerThreads()));
+			thread::ParallelFor(pool.ioContext(), merkleSubViews, numPartitions, [height](auto* pSubView, auto) {
+				pSubView->updateMerkleRoot(height);
+				return true;
+			}).get();
+		});
 	}
 
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
@@ -57,6 +57,10 @@ namespace catapult { namespace cache {
 				return modifier().count(key);
 			}
 
+			std::vector<model::TransactionInfo> transactionInfos() const override {
+				return modifier().transactionInfos();
+			}
+
 			std::vector<model::TransactionInfo> removeAll() override {
 				auto transactionInfos = modifier().removeAll();
 				for (const auto& transactionInfo : transactionInfos)
@@ -64,6 +68,22 @@ namespace catapult { namespace cache {
 
 				return transactionInfos;
 			}
+
+			std::vector<model::TransactionInfo> prune(Timestamp timestamp) override {
+				auto transactionInfos = modifier().prune(timestamp);
+				for (const auto& transactionInfo : transactionInfos)
+					remove(transactionInfo);
+
+				return transactionInfos;
+			}
+
+			model::TransactionInfo evict(const model::TransactionInfo& transactionInfo) override {
+				auto evictedInfo = modifier().evict(transactionInfo);
+				if (evictedInfo)
+					remove(evictedInfo);
+
+				return evictedInfo;
+			}
 		};
 
 		using AggregateUtCache = BasicAggregateTransactionsCache<UtTraits, AggregateUtCacheModifier>;
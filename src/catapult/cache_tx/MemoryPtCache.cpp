@@ -112,6 +112,13 @@ namespace catapult { namespace cache {
 				: iter->second.weakCosignedTransactionInfo();
 	}
 
+	void MemoryPtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
+		for (const auto& pair : m_transactionDataContainer) {
+			if (!consumer(pair.second.weakCosignedTransactionInfo()))
+				return;
+		}
+	}
+
 	ShortHashPairRange MemoryPtCacheView::shortHashPairs() const {
 		auto shortHashPairs = model::EntityRange<ShortHashPair>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashPairsIter = shortHashPairs.begin();
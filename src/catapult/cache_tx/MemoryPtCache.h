@@ -39,6 +39,7 @@ namespace catapult { namespace cache {
 	class MemoryPtCacheView {
 	private:
 		using UnknownTransactionInfos = std::vector<model::CosignedTransactionInfo>;
+		using TransactionInfoConsumer = predicate<const model::WeakCosignedTransactionInfo&>;
 
 	public:
 		/// Creates a view around around a maximum response size (\a maxResponseSize), a partial transaction data container
@@ -55,6 +56,9 @@ namespace catapult { namespace cache {
 		/// Finds a partial transaction in the cache with associated \a hash or returns \c nullptr if no such transaction exists.
 		model::WeakCosignedTransactionInfo find(const Hash256& hash) const;
 
+		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
+		void forEach(const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hash pairs of all transactions in the cache.
 		/// Each short hash pair consists of the first 4 bytes of the transaction hash and the first 4 bytes of the cosignature hash.
 		ShortHashPairRange shortHashPairs() const;
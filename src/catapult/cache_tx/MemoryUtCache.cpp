@@ -23,6 +23,7 @@
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/model/FeeUtils.h"
+#include <algorithm>
 
 namespace catapult { namespace cache {
 
@@ -49,14 +50,52 @@ namespace catapult { namespace cache {
 
 	// region MemoryUtCacheView
 
+	namespace {
+		class UnknownTransactionsBuilder {
+		public:
+			UnknownTransactionsBuilder(BlockFeeMultiplier minFeeMultiplier, uint64_t maxResponseSize)
+					: m_minFeeMultiplier(minFeeMultiplier)
+					, m_maxResponseSize(maxResponseSize)
+					, m_totalSize(0)
+			{}
+
+		public:
+			std::vector<std::shared_ptr<const model::Transaction>> build() {
+				return std::move(m_transactions);
+			}
+
+			bool tryAdd(const TransactionData& data) {
+				if (data.pEntity->MaxFee < model::CalculateTransactionFee(m_minFeeMultiplier, *data.pEntity))
+					return true;
+
+				m_totalSize += data.pEntity->Size;
+				if (m_totalSize > m_maxResponseSize)
+					return false;
+
+				m_transactions.push_back(data.pEntity);
+				return true;
+			}
+
+		private:
+			BlockFeeMultiplier m_minFeeMultiplier;
+			uint64_t m_maxResponseSize;
+			uint64_t m_totalSize;
+			std::vector<std::shared_ptr<const model::Transaction>> m_transactions;
+		};
+	}
+
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			const ShortHashLookup& shortHashLookup,
+			const utils::ShortHashSketch& shortHashesSketch,
+			utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_idLookup(idLookup)
+			, m_shortHashLookup(shortHashLookup)
+			, m_shortHashesSketch(shortHashesSketch)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -87,25 +126,49 @@ namespace catapult { namespace cache {
 	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::unknownTransactions(
 			BlockFeeMultiplier minFeeMultiplier,
 			const utils::ShortHashesSet& knownShortHashes) const {
-		uint64_t totalSize = 0;
-		UnknownTransactions transactions;
+		return findTransactions(minFeeMultiplier, [&knownShortHashes](auto shortHash) {
+			return knownShortHashes.cend() == knownShortHashes.find(shortHash);
+		});
+	}
+
+	utils::ShortHashSketch MemoryUtCacheView::shortHashesSketch(size_t numCells) const {
+		// the maintained sketch has the maximum supported size, so it can be folded into any supported size
+		return m_shortHashesSketch.fold(utils::ShortHashSketch::CalculateRemoteSize(numCells));
+	}
+
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::requestedTransactions(
+			BlockFeeMultiplier minFeeMultiplier,
+			const utils::ShortHashesSet& requestedShortHashes) const {
+		std::vector<size_t> ids;
+		for (auto shortHash : requestedShortHashes) {
+			auto range = m_shortHashLookup.equal_range(shortHash);
+			for (auto iter = range.first; range.second != iter; ++iter)
+				ids.push_back(iter->second);
+		}
+
+		// return transactions in the order they were added
+		std::sort(ids.begin(), ids.end());
+
+		UnknownTransactionsBuilder builder(minFeeMultiplier, m_maxResponseSize);
+		for (auto id : ids) {
+			if (!builder.tryAdd(*m_transactionDataContainer.find(TransactionData(id))))
+				break;
+		}
+
+		return builder.build();
+	}
+
+	template<typename TShortHashPredicate>
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::findTransactions(
+			BlockFeeMultiplier minFeeMultiplier,
+			TShortHashPredicate shortHashPredicate) const {
+		UnknownTransactionsBuilder builder(minFeeMultiplier, m_maxResponseSize);
 		for (const auto& data : m_transactionDataContainer) {
-			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
-
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize)
-					break;
-
-				transactions.push_back(pTransaction);
-			}
+			if (shortHashPredicate(utils::ToShortHash(data.EntityHash)) && !builder.tryAdd(data))
+				break;
 		}
 
-		return transactions;
+		return builder.build();
 	}
 
 	// endregion
@@ -113,22 +176,55 @@ namespace catapult { namespace cache {
 	// region MemoryUtCacheModifier
 
 	namespace {
-		class MemoryUtCacheModifier : public UtCacheModifier {
-		private:
-			using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+		using ShortHashLookup = std::unordered_multimap<utils::ShortHash, size_t, utils::ShortHashHasher>;
+
+		// deadline index ordered by (deadline, id) so that expired transactions are at the front
+		using DeadlineIndex = std::set<std::pair<Timestamp, size_t>>;
 
+		// fee index ordered by (max fee multiplier, -id) so that the newest transaction with the lowest fee is at the front
+		struct FeeIndexComparer {
+			bool operator()(const std::pair<BlockFeeMultiplier, size_t>& lhs, const std::pair<BlockFeeMultiplier, size_t>& rhs) const {
+				return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second);
+			}
+		};
+
+		using FeeIndex = std::set<std::pair<BlockFeeMultiplier, size_t>, FeeIndexComparer>;
+
+		auto ToDeadlineKey(const TransactionData& data) {
+			return std::make_pair(data.pEntity->Deadline, data.Id);
+		}
+
+		auto ToFeeKey(const TransactionData& data) {
+			return std::make_pair(model::CalculateTransactionMaxFeeMultiplier(*data.pEntity), data.Id);
+		}
+
+		utils::ShortHashSketch CreateShortHashesSketch() {
+			// use the largest supported size so that sketches of all supported sizes can be folded from it
+			return utils::ShortHashSketch(utils::ShortHashSketch::Max_Remote_Cells);
+		}
+
+		class MemoryUtCacheModifier : public UtCacheModifier {
 		public:
 			MemoryUtCacheModifier(
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
+					ShortHashLookup& shortHashLookup,
+					utils::ShortHashSketch& shortHashesSketch,
+					DeadlineIndex& deadlineIndex,
+					FeeIndex& feeIndex,
 					AccountCounters& counters,
-					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+					utils::ScalableReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_idLookup(idLookup)
+					, m_shortHashLookup(shortHashLookup)
+					, m_shortHashesSketch(shortHashesSketch)
+					, m_deadlineIndex(deadlineIndex)
+					, m_feeIndex(feeIndex)
 					, m_counters(counters)
 					, m_writeLock(std::move(writeLock))
 			{}
@@ -145,8 +241,16 @@ namespace catapult { namespace cache {
 				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto id = nextId(transactionInfo.EntityHash);
+				m_idLookup.emplace(transactionInfo.EntityHash, id);
+
+				auto shortHash = utils::ToShortHash(transactionInfo.EntityHash);
+				m_shortHashLookup.emplace(shortHash, id);
+				m_shortHashesSketch.insert(shortHash);
+
+				const auto& data = *m_transactionDataContainer.emplace(transactionInfo, id).first;
+				m_deadlineIndex.insert(ToDeadlineKey(data));
+				m_feeIndex.insert(ToFeeKey(data));
 
 				m_counters.increment(transactionInfo.pEntity->SignerPublicKey);
 
@@ -159,44 +263,120 @@ namespace catapult { namespace cache {
 				if (m_idLookup.cend() == iter)
 					return model::TransactionInfo();
 
-				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
-				auto erasedInfo = dataIter->copy();
-
-				m_counters.decrement(dataIter->pEntity->SignerPublicKey);
-
-				m_transactionDataContainer.erase(dataIter);
-				m_idLookup.erase(iter);
-				return erasedInfo;
+				return remove(iter->second);
 			}
 
 			size_t count(const Key& key) const override {
 				return m_counters.count(key);
 			}
 
-			std::vector<model::TransactionInfo> removeAll() override {
-				if (!m_transactionDataContainer.empty())
-					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
-
-				// unfortunately cannot just move m_transactionDataContainer because it contains a different (derived) type
+			std::vector<model::TransactionInfo> transactionInfos() const override {
+				// unfortunately cannot just copy m_transactionDataContainer because it contains a different (derived) type
 				std::vector<model::TransactionInfo> transactionInfosCopy;
 				transactionInfosCopy.reserve(m_transactionDataContainer.size());
 
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				return transactionInfosCopy;
+			}
+
+			std::vector<model::TransactionInfo> removeAll() override {
+				if (!m_transactionDataContainer.empty())
+					CATAPULT_LOG(debug) << "removing " << m_transactionDataContainer.size() << " elements from ut cache";
+
+				auto transactionInfosCopy = transactionInfos();
+
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
+				m_shortHashLookup.clear();
+				m_shortHashesSketch = CreateShortHashesSketch();
+				m_deadlineIndex.clear();
+				m_feeIndex.clear();
 				m_counters.reset();
 				return transactionInfosCopy;
 			}
 
+			std::vector<model::TransactionInfo> prune(Timestamp timestamp) override {
+				std::vector<model::TransactionInfo> prunedInfos;
+				while (!m_deadlineIndex.empty()) {
+					const auto& deadlineKey = *m_deadlineIndex.cbegin();
+					if (deadlineKey.first >= timestamp)
+						break;
+
+					prunedInfos.push_back(remove(deadlineKey.second));
+				}
+
+				if (!prunedInfos.empty())
+					CATAPULT_LOG(debug) << "pruned " << prunedInfos.size() << " expired elements from ut cache";
+
+				return prunedInfos;
+			}
+
+			model::TransactionInfo evict(const model::TransactionInfo& transactionInfo) override {
+				if (m_maxCacheSize > m_transactionDataContainer.size() || m_feeIndex.empty())
+					return model::TransactionInfo();
+
+				const auto& feeKey = *m_feeIndex.cbegin();
+				if (feeKey.first >= model::CalculateTransactionMaxFeeMultiplier(*transactionInfo.pEntity))
+					return model::TransactionInfo();
+
+				auto id = feeKey.second;
+				auto evictedInfo = remove(id);
+				m_evictedIdLookup.emplace(evictedInfo.EntityHash, id);
+				return evictedInfo;
+			}
+
+		private:
+			size_t nextId(const Hash256& hash) {
+				// reuse the id of a transaction evicted by this modifier so that it is restored at its original position
+				auto evictedIdIter = m_evictedIdLookup.find(hash);
+				if (m_evictedIdLookup.cend() == evictedIdIter)
+					return ++m_idSequence;
+
+				auto id = evictedIdIter->second;
+				m_evictedIdLookup.erase(evictedIdIter);
+				return id;
+			}
+
+			model::TransactionInfo remove(size_t id) {
+				auto dataIter = m_transactionDataContainer.find(TransactionData(id));
+				auto erasedInfo = dataIter->copy();
+
+				m_counters.decrement(dataIter->pEntity->SignerPublicKey);
+
+				m_deadlineIndex.erase(ToDeadlineKey(*dataIter));
+				m_feeIndex.erase(ToFeeKey(*dataIter));
+				m_idLookup.erase(dataIter->EntityHash);
+				removeShortHash(utils::ToShortHash(dataIter->EntityHash), id);
+				m_transactionDataContainer.erase(dataIter);
+				return erasedInfo;
+			}
+
+			void removeShortHash(utils::ShortHash shortHash, size_t id) {
+				auto range = m_shortHashLookup.equal_range(shortHash);
+				for (auto iter = range.first; range.second != iter; ++iter) {
+					if (id == iter->second) {
+						m_shortHashLookup.erase(iter);
+						break;
+					}
+				}
+
+				m_shortHashesSketch.remove(shortHash);
+			}
+
 		private:
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
+			ShortHashLookup& m_shortHashLookup;
+			utils::ShortHashSketch& m_shortHashesSketch;
+			DeadlineIndex& m_deadlineIndex;
+			FeeIndex& m_feeIndex;
 			AccountCounters& m_counters;
-			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+			utils::ScalableReaderWriterLock::WriterLockGuard m_writeLock;
+			IdLookup m_evictedIdLookup;
 		};
 	}
 
@@ -206,7 +386,11 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
-		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+		cache::IdLookup IdLookup;
+		cache::ShortHashLookup ShortHashLookup;
+		utils::ShortHashSketch ShortHashesSketch = CreateShortHashesSketch();
+		cache::DeadlineIndex DeadlineIndex;
+		cache::FeeIndex FeeIndex;
 		AccountCounters Counters;
 	};
 
@@ -220,7 +404,13 @@ namespace catapult { namespace cache {
 
 	MemoryUtCacheView MemoryUtCache::view() const {
 		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, std::move(readLock));
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->IdLookup,
+				m_pImpl->ShortHashLookup,
+				m_pImpl->ShortHashesSketch,
+				std::move(readLock));
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -230,6 +420,10 @@ namespace catapult { namespace cache {
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
+				m_pImpl->ShortHashLookup,
+				m_pImpl->ShortHashesSketch,
+				m_pImpl->DeadlineIndex,
+				m_pImpl->FeeIndex,
 				m_pImpl->Counters,
 				std::move(writeLock)));
 	}
@@ -24,7 +24,8 @@
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ShortHashSketch.h"
+#include "catapult/utils/ScalableReaderWriterLock.h"
 #include <set>
 #include <unordered_map>
 
@@ -41,16 +42,20 @@ namespace catapult { namespace cache {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
 		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
+		using ShortHashLookup = std::unordered_multimap<utils::ShortHash, size_t, utils::ShortHashHasher>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), an id lookup (\a idLookup), a short hash lookup (\a shortHashLookup)
+		/// and a short hashes sketch (\a shortHashesSketch) with lock context \a readLock.
 		MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				const ShortHashLookup& shortHashLookup,
+				const utils::ShortHashSketch& shortHashesSketch,
+				utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Gets the number of unconfirmed transactions in the cache.
@@ -70,11 +75,27 @@ namespace catapult { namespace cache {
 		/// and do not have a short hash in \a knownShortHashes.
 		UnknownTransactions unknownTransactions(BlockFeeMultiplier minFeeMultiplier, const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets a sketch with at least \a numCells cells of the short hashes of all transactions in the cache.
+		/// \note The number of cells is rounded up to a size supported for sketches exchanged with remote nodes.
+		utils::ShortHashSketch shortHashesSketch(size_t numCells) const;
+
+		/// Gets a vector of all transactions in the cache that have a fee multiplier at least \a minFeeMultiplier
+		/// and have a short hash in \a requestedShortHashes.
+		UnknownTransactions requestedTransactions(
+				BlockFeeMultiplier minFeeMultiplier,
+				const utils::ShortHashesSet& requestedShortHashes) const;
+
+	private:
+		template<typename TShortHashPredicate>
+		UnknownTransactions findTransactions(BlockFeeMultiplier minFeeMultiplier, TShortHashPredicate shortHashPredicate) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		const ShortHashLookup& m_shortHashLookup;
+		const utils::ShortHashSketch& m_shortHashesSketch;
+		utils::ScalableReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Interface (read write) for caching unconfirmed transactions.
@@ -109,7 +130,7 @@ namespace catapult { namespace cache {
 		MemoryCacheOptions m_options;
 		size_t m_idSequence;
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ScalableReaderWriterLock m_lock;
 	};
 
 	/// Delegating proxy around a MemoryUtCache.
@@ -44,8 +44,19 @@ namespace catapult { namespace cache {
 		/// Gets the number of transactions an account with public \a key has placed into the cache.
 		virtual size_t count(const Key& key) const = 0;
 
+		/// Gets copies of all transaction infos in the cache in the order they were added.
+		virtual std::vector<model::TransactionInfo> transactionInfos() const = 0;
+
 		/// Removes all transactions from the cache.
 		virtual std::vector<model::TransactionInfo> removeAll() = 0;
+
+		/// Removes all transactions that have deadlines before the given \a timestamp.
+		virtual std::vector<model::TransactionInfo> prune(Timestamp timestamp) = 0;
+
+		/// Removes the transaction with the lowest max fee multiplier from a full cache in order to make room for \a transactionInfo.
+		/// Returns the removed transaction info or an empty info when no transaction with a lower max fee multiplier was found.
+		/// \note An evicted transaction that is added back by the same modifier is restored at its original position.
+		virtual model::TransactionInfo evict(const model::TransactionInfo& transactionInfo) = 0;
 	};
 
 	/// Delegating proxy around a UtCacheModifier.
@@ -60,10 +71,25 @@ namespace catapult { namespace cache {
 			return modifier().count(key);
 		}
 
+		/// Gets copies of all transaction infos in the cache in the order they were added.
+		std::vector<model::TransactionInfo> transactionInfos() const {
+			return modifier().transactionInfos();
+		}
+
 		/// Removes all transactions from the cache.
 		std::vector<model::TransactionInfo> removeAll() {
 			return modifier().removeAll();
 		}
+
+		/// Removes all transactions that have deadlines before the given \a timestamp.
+		std::vector<model::TransactionInfo> prune(Timestamp timestamp) {
+			return modifier().prune(timestamp);
+		}
+
+		/// Removes the transaction with the lowest max fee multiplier from a full cache in order to make room for \a transactionInfo.
+		model::TransactionInfo evict(const model::TransactionInfo& transactionInfo) {
+			return modifier().evict(transactionInfo);
+		}
 	};
 
 	/// Interface (write only) for caching unconfirmed transactions.
@@ -49,6 +49,9 @@ namespace catapult { namespace chain {
 	/// Validation failed because the unconfirmed cache is too full.
 	DEFINE_CHAIN_RESULT(Unconfirmed_Cache_Too_Full, 7);
 
+	/// Validation failed because the unconfirmed transaction was evicted by a transaction paying a higher fee.
+	DEFINE_CHAIN_RESULT(Unconfirmed_Cache_Evicted, 8);
+
 #ifndef CUSTOM_RESULT_DEFINITION
 }}
 #endif
@@ -24,6 +24,8 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <deque>
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -66,6 +68,11 @@ namespace catapult { namespace chain {
 				return true;
 			}
 
+			bool hasCapacity(size_t numReservedBytes) {
+				utils::SpinLockGuard guard(m_spinLock);
+				return m_numBytes + numReservedBytes < m_maxSize;
+			}
+
 			Height maxHeight() {
 				utils::SpinLockGuard guard(m_spinLock);
 				return m_elements.empty() ? Height(0) : m_elements.back().EndHeight;
@@ -220,6 +227,117 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// pulls consecutive block ranges from a remote node while keeping multiple requests outstanding
+		// notice that requests after the first one are issued speculatively assuming that all ranges are full,
+		// so pipelining stops as soon as a partial range is received
+		class BlockRangePipeline : public std::enable_shared_from_this<BlockRangePipeline> {
+		private:
+			using BlocksFromFutureSupplier = std::function<thread::future<model::BlockRange>(Height)>;
+
+		public:
+			BlockRangePipeline(
+					const BlocksFromFutureSupplier& futureSupplier,
+					const model::NodeIdentity& sourceIdentity,
+					const ChainSynchronizerConfiguration& config,
+					UnprocessedElements& unprocessedElements)
+					: m_futureSupplier(futureSupplier)
+					, m_sourceIdentity(sourceIdentity)
+					, m_numBlocksPerRange(config.MaxBlocksPerSyncAttempt)
+					, m_numBytesPerRange(config.MaxChainBytesPerSyncAttempt)
+					, m_maxPendingRequests(config.MaxPendingBlockRangeRequests)
+					, m_unprocessedElements(unprocessedElements)
+					, m_resultCode(ionet::NodeInteractionResultCode::Neutral)
+			{}
+
+		public:
+			NodeInteractionFuture start(Height height) {
+				m_nextRequestHeight = height;
+				pushRequest();
+				fill();
+				return processNext();
+			}
+
+		private:
+			void pushRequest() {
+				m_futures.push_back(m_futureSupplier(m_nextRequestHeight));
+				m_nextRequestHeight = m_nextRequestHeight + Height(m_numBlocksPerRange);
+			}
+
+			void fill() {
+				// reserve space for all outstanding requests so that the memory budget is respected
+				while (m_futures.size() < m_maxPendingRequests && m_unprocessedElements.hasCapacity(m_futures.size() * m_numBytesPerRange))
+					pushRequest();
+			}
+
+			NodeInteractionFuture processNext() {
+				auto future = std::move(m_futures.front());
+				m_futures.pop_front();
+				return thread::compose(std::move(future), [pThis = shared_from_this()](auto&& blocksFuture) {
+					return pThis->process(std::move(blocksFuture));
+				});
+			}
+
+			NodeInteractionFuture process(thread::future<model::BlockRange>&& blocksFuture) {
+				try {
+					auto range = blocksFuture.get();
+
+					// if the range is empty, the remote does not have any more blocks
+					if (range.empty()) {
+						CATAPULT_LOG(info) << "peer returned 0 blocks";
+						return complete(m_resultCode);
+					}
+
+					auto endHeight = (--range.cend())->Height;
+					auto numBlocks = range.size();
+					CATAPULT_LOG(info)
+							<< "peer returned " << numBlocks
+							<< " blocks (heights " << range.cbegin()->Height << " - " << endHeight << ")";
+
+					if (!m_unprocessedElements.add(model::AnnotatedBlockRange(std::move(range), m_sourceIdentity)))
+						return complete(m_resultCode);
+
+					m_resultCode = ionet::NodeInteractionResultCode::Success;
+
+					// a partial range breaks the contiguity of all speculatively requested ranges
+					if (numBlocks < m_numBlocksPerRange)
+						return complete(m_resultCode);
+
+					fill();
+					return m_futures.empty() ? complete(m_resultCode) : processNext();
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
+					return complete(ionet::NodeInteractionResultCode::Failure);
+				}
+			}
+
+			NodeInteractionFuture complete(ionet::NodeInteractionResultCode code) {
+				if (m_futures.empty())
+					return thread::make_ready_future(std::move(code));
+
+				// wait for all outstanding requests to complete before releasing the remote api
+				std::vector<thread::future<model::BlockRange>> futures;
+				for (auto& future : m_futures)
+					futures.push_back(std::move(future));
+
+				m_futures.clear();
+				return thread::compose(thread::when_all(std::move(futures)), [code](auto&&) {
+					return thread::make_ready_future(ionet::NodeInteractionResultCode(code));
+				});
+			}
+
+		private:
+			BlocksFromFutureSupplier m_futureSupplier;
+			model::NodeIdentity m_sourceIdentity;
+			uint32_t m_numBlocksPerRange;
+			size_t m_numBytesPerRange;
+			size_t m_maxPendingRequests;
+			UnprocessedElements& m_unprocessedElements;
+
+			Height m_nextRequestHeight;
+			std::deque<thread::future<model::BlockRange>> m_futures;
+			ionet::NodeInteractionResultCode m_resultCode;
+		};
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -232,11 +350,12 @@ namespace catapult { namespace chain {
 					const ChainSynchronizerConfiguration& config,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
+					, m_config(config)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
-							3 * config.MaxChainBytesPerSyncAttempt))
+							(std::max<size_t>(1, config.MaxPendingBlockRangeRequests) + 2) * config.MaxChainBytesPerSyncAttempt))
 			{}
 
 		public:
@@ -290,6 +409,17 @@ namespace catapult { namespace chain {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
+
+				// a fork must be delivered as a single range, so only pipeline when the local chain is being extended
+				if (0 == compareResult.ForkDepth && 1 < m_config.MaxPendingBlockRangeRequests) {
+					auto pPipeline = std::make_shared<BlockRangePipeline>(
+							CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
+							remoteChainApi.remoteIdentity(),
+							m_config,
+							*m_pUnprocessedElements);
+					return pPipeline->start(compareResult.CommonBlockHeight + Height(1));
+				}
+
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
 						compareResult.CommonBlockHeight + Height(1),
@@ -300,6 +430,7 @@ namespace catapult { namespace chain {
 
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
+			ChainSynchronizerConfiguration m_config;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
@@ -52,6 +52,10 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Maximum number of block range requests that can be outstanding at once when extending the local chain.
+		/// \note A value greater than one allows later ranges to be downloaded while earlier ranges are being processed.
+		uint32_t MaxPendingBlockRangeRequests;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
@@ -22,6 +22,8 @@
 #include "EntitiesSynchronizer.h"
 #include "catapult/api/RemoteTransactionApi.h"
 #include "catapult/model/NodeIdentity.h"
+#include "catapult/thread/FutureUtils.h"
+#include <atomic>
 
 namespace catapult { namespace chain {
 
@@ -50,11 +52,88 @@ namespace catapult { namespace chain {
 				m_transactionRangeConsumer(model::AnnotatedTransactionRange(std::move(range), sourceIdentity));
 			}
 
-		private:
+		protected:
 			BlockFeeMultiplier m_minFeeMultiplier;
 			ShortHashesSupplier m_shortHashesSupplier;
+
+		private:
 			handlers::TransactionRangeHandler m_transactionRangeConsumer;
 		};
+
+		// region UtSketchTraits
+
+		// minimum number of sketch cells (1152 bytes)
+		constexpr size_t Min_Sketch_Cells = 96;
+
+		// maximum number of sketch cells; when a larger sketch is needed, all short hashes are sent instead
+		constexpr size_t Max_Sketch_Cells = utils::ShortHashSketch::Max_Remote_Cells;
+
+		// number of sketch cells allocated per expected difference
+		constexpr size_t Cells_Per_Difference = 3;
+
+		class UtSketchTraits : public UtTraits {
+		private:
+			using DifferenceSizeEstimate = std::atomic<uint32_t>;
+
+		public:
+			UtSketchTraits(
+					BlockFeeMultiplier minFeeMultiplier,
+					const ShortHashesSupplier& shortHashesSupplier,
+					const ShortHashesSketchSupplier& shortHashesSketchSupplier,
+					const handlers::TransactionRangeHandler& transactionRangeConsumer)
+					: UtTraits(minFeeMultiplier, shortHashesSupplier, transactionRangeConsumer)
+					, m_shortHashesSketchSupplier(shortHashesSketchSupplier)
+					, m_pDifferenceSizeEstimate(std::make_shared<DifferenceSizeEstimate>(0))
+			{}
+
+		public:
+			thread::future<model::TransactionRange> apiCall(const RemoteApiType& api) const {
+				auto numCells = std::max<size_t>(Min_Sketch_Cells, Cells_Per_Difference * *m_pDifferenceSizeEstimate);
+				if (numCells > Max_Sketch_Cells)
+					return shortHashesApiCall(api, m_minFeeMultiplier, m_shortHashesSupplier, m_pDifferenceSizeEstimate, 0);
+
+				auto sketchFuture = api.unconfirmedTransactionsBySketch(m_minFeeMultiplier, m_shortHashesSketchSupplier(numCells));
+				return thread::compose(std::move(sketchFuture), [
+						&api,
+						numCells,
+						minFeeMultiplier = m_minFeeMultiplier,
+						shortHashesSupplier = m_shortHashesSupplier,
+						pDifferenceSizeEstimate = m_pDifferenceSizeEstimate](auto&& resultFuture) {
+					auto result = resultFuture.get();
+					if (result.IsDecoded) {
+						*pDifferenceSizeEstimate = result.DifferenceSize;
+						return thread::make_ready_future(std::move(result.Transactions));
+					}
+
+					// double the sketch size for the next attempt and fall back to sending all short hashes
+					CATAPULT_LOG(debug) << "peer was unable to decode unconfirmed transactions sketch with " << numCells << " cells";
+					auto minDifferenceSize = static_cast<uint32_t>(2 * numCells / Cells_Per_Difference);
+					return shortHashesApiCall(api, minFeeMultiplier, shortHashesSupplier, pDifferenceSizeEstimate, minDifferenceSize);
+				});
+			}
+
+		private:
+			static thread::future<model::TransactionRange> shortHashesApiCall(
+					const RemoteApiType& api,
+					BlockFeeMultiplier minFeeMultiplier,
+					const ShortHashesSupplier& shortHashesSupplier,
+					const std::shared_ptr<DifferenceSizeEstimate>& pDifferenceSizeEstimate,
+					uint32_t minDifferenceSize) {
+				auto rangeFuture = api.unconfirmedTransactions(minFeeMultiplier, shortHashesSupplier());
+				return rangeFuture.then([pDifferenceSizeEstimate, minDifferenceSize](auto&& completedRangeFuture) {
+					// number of returned transactions is a lower bound of the difference size
+					auto range = completedRangeFuture.get();
+					*pDifferenceSizeEstimate = std::max(minDifferenceSize, static_cast<uint32_t>(range.size()));
+					return range;
+				});
+			}
+
+		private:
+			ShortHashesSketchSupplier m_shortHashesSketchSupplier;
+			std::shared_ptr<DifferenceSizeEstimate> m_pDifferenceSizeEstimate;
+		};
+
+		// endregion
 	}
 
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
@@ -65,4 +144,14 @@ namespace catapult { namespace chain {
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
+
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
+			BlockFeeMultiplier minFeeMultiplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const ShortHashesSketchSupplier& shortHashesSketchSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer) {
+		auto traits = UtSketchTraits(minFeeMultiplier, shortHashesSupplier, shortHashesSketchSupplier, transactionRangeConsumer);
+		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtSketchTraits>>(std::move(traits));
+		return CreateRemoteNodeSynchronizer(pSynchronizer);
+	}
 }}
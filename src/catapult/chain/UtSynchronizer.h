@@ -22,6 +22,7 @@
 #include "RemoteNodeSynchronizer.h"
 #include "catapult/handlers/HandlerTypes.h"
 #include "catapult/model/RangeTypes.h"
+#include "catapult/utils/ShortHashSketch.h"
 
 namespace catapult { namespace api { class RemoteTransactionApi; } }
 
@@ -30,10 +31,23 @@ namespace catapult { namespace chain {
 	/// Function signature for supplying a range of short hashes.
 	using ShortHashesSupplier = supplier<model::ShortHashRange>;
 
+	/// Function signature for supplying a sketch of short hashes with the specified number of cells.
+	using ShortHashesSketchSupplier = std::function<utils::ShortHashSketch (size_t)>;
+
 	/// Creates an unconfirmed transactions synchronizer around the specified short hashes supplier (\a shortHashesSupplier)
 	/// and transaction range consumer (\a transactionRangeConsumer) for transactions with fee multipliers at least \a minFeeMultiplier.
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
 			BlockFeeMultiplier minFeeMultiplier,
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer);
+
+	/// Creates an unconfirmed transactions synchronizer around the specified short hashes supplier (\a shortHashesSupplier),
+	/// short hashes sketch supplier (\a shortHashesSketchSupplier) and transaction range consumer (\a transactionRangeConsumer)
+	/// for transactions with fee multipliers at least \a minFeeMultiplier.
+	/// \note Transactions are requested by sketch and all short hashes are only sent when the remote cannot decode the sketch.
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
+			BlockFeeMultiplier minFeeMultiplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const ShortHashesSketchSupplier& shortHashesSketchSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer);
 }}
@@ -27,19 +27,78 @@
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
 #include "catapult/cache_tx/UtCache.h"
 #include "catapult/model/FeeUtils.h"
+#include "catapult/model/TransactionUtils.h"
 #include "catapult/utils/HexFormatter.h"
 
 namespace catapult { namespace chain {
 
 	namespace {
 		struct ApplyState {
-			constexpr ApplyState(cache::UtCacheModifierProxy& modifier, cache::CatapultCacheDelta& unconfirmedCatapultCache)
+			constexpr ApplyState(
+					cache::UtCacheModifierProxy& modifier,
+					std::unique_ptr<cache::CatapultCacheDelta>& pUnconfirmedCatapultCache)
 					: Modifier(modifier)
-					, UnconfirmedCatapultCache(unconfirmedCatapultCache)
+					, pUnconfirmedCatapultCache(pUnconfirmedCatapultCache)
 			{}
 
 			cache::UtCacheModifierProxy& Modifier;
-			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
+			std::unique_ptr<cache::CatapultCacheDelta>& pUnconfirmedCatapultCache;
+		};
+
+		class ProcessContexts {
+		public:
+			ProcessContexts(
+					Height height,
+					Timestamp blockTime,
+					const ExecutionConfiguration& executionConfig,
+					cache::CatapultCacheDelta& unconfirmedCatapultCache)
+					: m_contextBuilder(height, blockTime, executionConfig)
+					, m_validatorContext(BuildValidatorContext(m_contextBuilder, unconfirmedCatapultCache))
+					, m_observerContext(m_contextBuilder.buildObserverContext())
+			{}
+
+		public:
+			const validators::ValidatorContext& validatorContext() const {
+				return m_validatorContext;
+			}
+
+			observers::ObserverContext& observerContext() {
+				return m_observerContext;
+			}
+
+		private:
+			static validators::ValidatorContext BuildValidatorContext(
+					ProcessContextsBuilder& contextBuilder,
+					cache::CatapultCacheDelta& unconfirmedCatapultCache) {
+				contextBuilder.setCache(unconfirmedCatapultCache);
+				return contextBuilder.buildValidatorContext();
+			}
+
+		private:
+			ProcessContextsBuilder m_contextBuilder;
+			validators::ValidatorContext m_validatorContext;
+			observers::ObserverContext m_observerContext;
+		};
+
+		class AddressCollectingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			AddressCollectingNotificationSubscriber(
+					model::NotificationSubscriber& subscriber,
+					model::NetworkIdentifier networkIdentifier,
+					model::UnresolvedAddressSet& addresses)
+					: m_subscriber(subscriber)
+					, m_addressCollector(networkIdentifier, addresses)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_addressCollector.notify(notification);
+				m_subscriber.notify(notification);
+			}
+
+		private:
+			model::NotificationSubscriber& m_subscriber;
+			model::AddressCollector m_addressCollector;
 		};
 	}
 
@@ -60,9 +119,14 @@ namespace catapult { namespace chain {
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_isAddressExtractionEnabled(false)
 		{}
 
 	public:
+		void enableAddressExtraction() {
+			m_isAddressExtractionEnabled = true;
+		}
+
 		void update(const std::vector<model::TransactionInfo>& utInfos) {
 			// 1. lock the UT cache and lock the unconfirmed copy
 			auto modifier = m_transactionsCache.modifier();
@@ -74,7 +138,7 @@ namespace catapult { namespace chain {
 				return;
 			}
 
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+			auto applyState = ApplyState(modifier, pUnconfirmedCatapultCache);
 			apply(applyState, utInfos, TransactionSource::New);
 		}
 
@@ -94,7 +158,7 @@ namespace catapult { namespace chain {
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
 			// 3. add back reverted txes
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+			auto applyState = ApplyState(modifier, pUnconfirmedCatapultCache);
 			apply(applyState, utInfos, TransactionSource::Reverted);
 
 			// 4. add back original txes that have not been confirmed
@@ -104,23 +168,18 @@ namespace catapult { namespace chain {
 		}
 
 	private:
-		void apply(const ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
+		using InvalidTransactionInfos = std::vector<std::pair<model::TransactionInfo, validators::ValidationResult>>;
+
+		void apply(ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
 			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
 		}
 
 		void apply(
-				const ApplyState& applyState,
+				ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
 				const predicate<const model::TransactionInfo&>& filter) {
-			// note that the validator and observer context height is one larger than the chain height
-			// since the validation and observation has to be for the *next* block
-			auto effectiveHeight = m_detachedCatapultCache.height() + Height(1);
-			ProcessContextsBuilder contextBuilder(effectiveHeight, m_timeSupplier(), m_executionConfig);
-			contextBuilder.setCache(applyState.UnconfirmedCatapultCache);
-			auto validatorContext = contextBuilder.buildValidatorContext();
-			auto observerContext = contextBuilder.buildObserverContext();
-
+			auto pContexts = createProcessContexts(applyState);
 			for (const auto& utInfo : utInfos) {
 				const auto& entity = *utInfo.pEntity;
 				const auto& entityHash = utInfo.EntityHash;
@@ -128,6 +187,13 @@ namespace catapult { namespace chain {
 				if (!filter(utInfo))
 					continue;
 
+				if (!pContexts) {
+					// if there is no unconfirmed cache state, it means that a block update is forthcoming
+					// just add the remaining transactions to the cache and they will be validated later
+					applyState.Modifier.add(utInfo);
+					continue;
+				}
+
 				auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
 				if (entity.MaxFee < minTransactionFee) {
 					// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
@@ -140,35 +206,123 @@ namespace catapult { namespace chain {
 					continue;
 				}
 
-				if (throttle(utInfo, transactionSource, applyState, validatorContext.Cache)) {
-					CATAPULT_LOG(warning) << "dropping transaction " << entityHash << " due to throttle";
-					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
-					continue;
+				// a full cache makes room for a transaction by evicting the transaction paying the lowest fee, if it pays less
+				// the changes made by the evicted transaction (and all transactions depending on them) are removed from the unconfirmed
+				// catapult cache by rebasing it before the transaction replacing it is executed
+				// notice that transactions invalidated by the rebase are only removed once the replacing transaction has been accepted
+				model::TransactionInfo evictedInfo;
+				InvalidTransactionInfos invalidInfos;
+				if (throttle(utInfo, transactionSource, applyState, pContexts->validatorContext().Cache)) {
+					evictedInfo = applyState.Modifier.evict(utInfo);
+					if (!evictedInfo) {
+						CATAPULT_LOG(warning) << "dropping transaction " << entityHash << " due to throttle";
+						m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+						continue;
+					}
+
+					invalidInfos = rebase(applyState, pContexts);
+					if (!pContexts) {
+						// a block update is forthcoming, so the transaction will be validated later
+						notifyEvicted(evictedInfo, utInfo);
+						applyState.Modifier.add(utInfo);
+						continue;
+					}
 				}
 
-				if (!applyState.Modifier.add(utInfo))
-					continue;
+				if (tryAddAndExecute(utInfo, applyState, *pContexts)) {
+					if (evictedInfo)
+						notifyEvicted(evictedInfo, utInfo);
+				} else if (evictedInfo) {
+					// the evicted transaction is restored at its original position, so its changes need to be reapplied in order
+					applyState.Modifier.add(evictedInfo);
+					invalidInfos = rebase(applyState, pContexts);
+				}
 
-				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
-				const auto& validator = *m_executionConfig.pValidator;
-				const auto& observer = *m_executionConfig.pObserver;
-				ProcessingNotificationSubscriber sub(validator, validatorContext, observer, observerContext);
-				sub.enableUndo();
-				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
-				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
-				if (!IsValidationResultSuccess(sub.result())) {
-					CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
-							<< "dropping transaction " << entityHash << ": " << sub.result();
+				for (const auto& invalidInfoPair : invalidInfos) {
+					applyState.Modifier.remove(invalidInfoPair.first.EntityHash);
+					drop(invalidInfoPair.first, invalidInfoPair.second);
+				}
+			}
+		}
 
-					// only forward failure (not neutral) results
-					if (IsValidationResultFailure(sub.result()))
-						m_failedTransactionSink(entity, entityHash, sub.result());
+		std::unique_ptr<ProcessContexts> createProcessContexts(const ApplyState& applyState) const {
+			if (!applyState.pUnconfirmedCatapultCache)
+				return nullptr;
 
-					sub.undo();
-					applyState.Modifier.remove(entityHash);
-					continue;
-				}
+			// note that the validator and observer context height is one larger than the chain height
+			// since the validation and observation has to be for the *next* block
+			auto effectiveHeight = m_detachedCatapultCache.height() + Height(1);
+			return std::make_unique<ProcessContexts>(
+					effectiveHeight,
+					m_timeSupplier(),
+					m_executionConfig,
+					*applyState.pUnconfirmedCatapultCache);
+		}
+
+		InvalidTransactionInfos rebase(ApplyState& applyState, std::unique_ptr<ProcessContexts>& pContexts) {
+			// contexts reference the unconfirmed catapult cache, which needs to be unlocked before it can be rebased
+			pContexts.reset();
+			applyState.pUnconfirmedCatapultCache.reset();
+			applyState.pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
+			pContexts = createProcessContexts(applyState);
+			if (!pContexts)
+				return InvalidTransactionInfos();
+
+			// reexecute all transactions remaining in the ut cache in order without removing the ones that are no longer valid
+			InvalidTransactionInfos invalidInfos;
+			for (auto& utInfo : applyState.Modifier.transactionInfos()) {
+				auto result = execute(model::WeakEntityInfo(*utInfo.pEntity, utInfo.EntityHash), *pContexts, nullptr);
+				if (!IsValidationResultSuccess(result))
+					invalidInfos.emplace_back(std::move(utInfo), result);
+			}
+
+			return invalidInfos;
+		}
+
+		bool tryAddAndExecute(const model::TransactionInfo& utInfo, const ApplyState& applyState, ProcessContexts& contexts) {
+			// when enabled, addresses are collected from the published notifications into the (shared) set of the added info
+			// notice that the set is filled before any change subscriber can access it because subscribers are notified on flush
+			std::shared_ptr<model::UnresolvedAddressSet> pExtractedAddresses;
+			if (m_isAddressExtractionEnabled && !utInfo.OptionalExtractedAddresses) {
+				pExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>();
+				auto utInfoWithAddresses = utInfo.copy();
+				utInfoWithAddresses.OptionalExtractedAddresses = pExtractedAddresses;
+				if (!applyState.Modifier.add(utInfoWithAddresses))
+					return false;
+			} else if (!applyState.Modifier.add(utInfo)) {
+				return false;
 			}
+
+			auto result = execute(model::WeakEntityInfo(*utInfo.pEntity, utInfo.EntityHash), contexts, pExtractedAddresses.get());
+			if (!IsValidationResultSuccess(result)) {
+				applyState.Modifier.remove(utInfo.EntityHash);
+				drop(utInfo, result);
+				return false;
+			}
+
+			return true;
+		}
+
+		validators::ValidationResult execute(
+				const model::WeakEntityInfo& entityInfo,
+				ProcessContexts& contexts,
+				model::UnresolvedAddressSet* pExtractedAddresses) const {
+			// notice that subscriber is created for each execution because aggregate result needs to be reset
+			const auto& validator = *m_executionConfig.pValidator;
+			const auto& observer = *m_executionConfig.pObserver;
+			ProcessingNotificationSubscriber sub(validator, contexts.validatorContext(), observer, contexts.observerContext());
+			sub.enableUndo();
+			if (pExtractedAddresses) {
+				AddressCollectingNotificationSubscriber collectingSub(sub, entityInfo.entity().Network, *pExtractedAddresses);
+				m_executionConfig.pNotificationPublisher->publish(entityInfo, collectingSub);
+			} else {
+				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
+			}
+
+			if (!IsValidationResultSuccess(sub.result()))
+				sub.undo();
+
+			return sub.result();
 		}
 
 		bool throttle(
@@ -179,6 +333,19 @@ namespace catapult { namespace chain {
 			return m_throttle(utInfo, { transactionSource, m_detachedCatapultCache.height(), cache, applyState.Modifier });
 		}
 
+		void drop(const model::TransactionInfo& utInfo, validators::ValidationResult result) const {
+			CATAPULT_LOG_LEVEL(validators::MapToLogLevel(result)) << "dropping transaction " << utInfo.EntityHash << ": " << result;
+
+			// only forward failure (not neutral) results
+			if (IsValidationResultFailure(result))
+				m_failedTransactionSink(*utInfo.pEntity, utInfo.EntityHash, result);
+		}
+
+		void notifyEvicted(const model::TransactionInfo& evictedInfo, const model::TransactionInfo& utInfo) const {
+			CATAPULT_LOG(debug) << "evicted transaction " << evictedInfo.EntityHash << " in favor of " << utInfo.EntityHash;
+			m_failedTransactionSink(*evictedInfo.pEntity, evictedInfo.EntityHash, Failure_Chain_Unconfirmed_Cache_Evicted);
+		}
+
 		void addAll(cache::UtCacheModifierProxy& modifier, const std::vector<model::TransactionInfo>& utInfos) {
 			for (const auto& utInfo : utInfos)
 				modifier.add(utInfo);
@@ -192,6 +359,7 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		bool m_isAddressExtractionEnabled;
 	};
 
 	UtUpdater::UtUpdater(
@@ -214,6 +382,10 @@ namespace catapult { namespace chain {
 
 	UtUpdater::~UtUpdater() = default;
 
+	void UtUpdater::enableAddressExtraction() {
+		m_pImpl->enableAddressExtraction();
+	}
+
 	void UtUpdater::update(const std::vector<model::TransactionInfo>& utInfos) {
 		m_pImpl->update(utInfos);
 	}
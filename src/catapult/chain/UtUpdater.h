@@ -86,6 +86,11 @@ namespace catapult { namespace chain {
 		/// Destroys the updater.
 		~UtUpdater();
 
+	public:
+		/// Enables extraction of transaction addresses from the notifications published while applying transactions.
+		/// \note Extracted addresses are attached to the infos added to the cache and are reused by subsequent updates.
+		void enableAddressExtraction();
+
 	public:
 		/// Updates this cache by applying new transaction infos in \a utInfos.
 		void update(const std::vector<model::TransactionInfo>& utInfos);
@@ -42,12 +42,15 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
+		LOAD_NODE_PROPERTY(EnableTransactionsCacheSnapshot);
+		LOAD_NODE_PROPERTY(EnableTransactionsSetReconciliation);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxPendingBlockRangeRequests);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -70,6 +73,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
 		LOAD_NODE_PROPERTY(TransactionDisruptorSize);
 		LOAD_NODE_PROPERTY(TransactionElementTraceInterval);
+		LOAD_NODE_PROPERTY(TransactionBatchSize);
 
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
@@ -77,6 +81,10 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
+		LOAD_NODE_PROPERTY(MaxBlocksPerRecoveryCommit);
+		LOAD_NODE_PROPERTY(TrustedCheckpointHeight);
+		LOAD_NODE_PROPERTY(TrustedCheckpointHash);
+
 		LOAD_NODE_PROPERTY(BatchVerificationRandomSource);
 
 		LOAD_NODE_PROPERTY(TrustedHosts);
@@ -125,7 +133,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeLte(bag, 34 + 4 + 4 + 5 + 7);
+		utils::VerifyBagSizeLte(bag, 41 + 4 + 4 + 5 + 7);
 		return config;
 	}
 
@@ -51,6 +51,13 @@ namespace catapult { namespace config {
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
 
+		/// \c true if the unconfirmed and partial transactions caches should be saved at shutdown and reloaded at startup.
+		bool EnableTransactionsCacheSnapshot;
+
+		/// \c true if unconfirmed transactions should be pulled from peers by exchanging sketches of short hashes.
+		/// \note Peers are only able to respond if they support sketches.
+		bool EnableTransactionsSetReconciliation;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -63,6 +70,9 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of outstanding block range requests when extending the local chain.
+		uint32_t MaxPendingBlockRangeRequests;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -115,6 +125,10 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Number of queued transactions that triggers dispatching of all queued transaction batches
+		/// before the next batch transaction task run (\c 0 to only dispatch periodically).
+		uint32_t TransactionBatchSize;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool EnableDispatcherAbortWhenFull;
 
@@ -127,6 +141,16 @@ namespace catapult { namespace config {
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
+		/// Maximum number of blocks executed between cache commits when recovery loads blocks from storage.
+		uint32_t MaxBlocksPerRecoveryCommit;
+
+		/// Height of the trusted checkpoint block up to which recovery imports blocks without validation.
+		/// \note \c 0 disables importing.
+		Height TrustedCheckpointHeight;
+
+		/// Hash of the trusted checkpoint block.
+		Hash256 TrustedCheckpointHash;
+
 		/// Source of random numbers used in batch verification.
 		std::string BatchVerificationRandomSource;
 
@@ -29,6 +29,7 @@
 #include "catapult/io/BlockStatementSerializer.h"
 #include "catapult/io/Stream.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoThreadPool.h"
 
 using namespace catapult::validators;
 
@@ -96,10 +97,12 @@ namespace catapult { namespace consumers {
 			DefaultBlockChainProcessor(
 					const BlockHitPredicateFactory& blockHitPredicateFactory,
 					const chain::BatchEntityProcessor& batchEntityProcessor,
-					ReceiptValidationMode receiptValidationMode)
+					ReceiptValidationMode receiptValidationMode,
+					const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
 					, m_batchEntityProcessor(batchEntityProcessor)
 					, m_receiptValidationMode(receiptValidationMode)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -121,7 +124,7 @@ namespace catapult { namespace consumers {
 
 				// initial cache state will be either last cache state or unwound cache state
 				std::vector<std::string> cacheStateLogs;
-				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, state.Cache.calculateStateHash(pParent->Height)));
+				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, calculateStateHash(state.Cache, pParent->Height)));
 
 				for (auto& element : elements) {
 					// 1. check generation hash
@@ -141,7 +144,7 @@ namespace catapult { namespace consumers {
 					}
 
 					// 3. check state hash
-					if (!CheckStateHash(element, state.Cache, cacheStateLogs))
+					if (!checkStateHash(element, state.Cache, cacheStateLogs))
 						return chain::Failure_Chain_Block_Inconsistent_State_Hash;
 
 					// 4. check receipts hash
@@ -212,12 +215,16 @@ namespace catapult { namespace consumers {
 				return validators::ValidationResult::Success;
 			}
 
-			static bool CheckStateHash(
+			cache::StateHashInfo calculateStateHash(const cache::CatapultCacheDelta& cacheDelta, Height height) const {
+				return m_pPool ? cacheDelta.calculateStateHash(height, *m_pPool) : cacheDelta.calculateStateHash(height);
+			}
+
+			bool checkStateHash(
 					model::BlockElement& element,
 					cache::CatapultCacheDelta& cacheDelta,
-					std::vector<std::string>& cacheStateLogs) {
+					std::vector<std::string>& cacheStateLogs) const {
 				const auto& block = element.Block;
-				auto cacheStateHashInfo = cacheDelta.calculateStateHash(block.Height);
+				auto cacheStateHashInfo = calculateStateHash(cacheDelta, block.Height);
 				cacheStateLogs.push_back(FormatCacheStateLog(block.Height, cacheStateHashInfo));
 
 				if (block.StateHash != cacheStateHashInfo.StateHash) {
@@ -267,6 +274,7 @@ namespace catapult { namespace consumers {
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
 			chain::BatchEntityProcessor m_batchEntityProcessor;
 			ReceiptValidationMode m_receiptValidationMode;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
@@ -274,6 +282,14 @@ namespace catapult { namespace consumers {
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode) {
-		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, nullptr);
+	}
+
+	BlockChainProcessor CreateBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			ReceiptValidationMode receiptValidationMode,
+			const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, pPool);
 	}
 }}
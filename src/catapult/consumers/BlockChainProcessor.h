@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace cache { class ReadOnlyCatapultCache; }
 	namespace chain { struct ObserverState; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace consumers {
@@ -82,4 +83,13 @@ namespace catapult { namespace consumers {
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode);
+
+	/// Creates a block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory)
+	/// and batch entity processor (\a batchEntityProcessor) with \a receiptValidationMode that uses \a pPool to parallelize
+	/// state hash calculation.
+	BlockChainProcessor CreateBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			ReceiptValidationMode receiptValidationMode,
+			const std::shared_ptr<thread::IoThreadPool>& pPool);
 }}
@@ -43,6 +43,13 @@ namespace catapult { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
+	/// generation hash seed (\a generationHashSeed) and uses \a pPool to parallelize transaction and large merkle tree hashing.
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	disruptor::ConstBlockConsumer CreateBlockHashCheckConsumer(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
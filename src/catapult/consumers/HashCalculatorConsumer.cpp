@@ -21,20 +21,27 @@
 #include "BlockConsumers.h"
 #include "ConsumerResultFactory.h"
 #include "TransactionConsumers.h"
-#include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/Sha3MultiBuffer.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
+		constexpr size_t Min_Transactions_Per_Partition = 64;
+		constexpr size_t Min_Parallel_Merkle_Layer_Size = 1024;
+
 		class BlockHashCalculatorConsumer {
 		public:
 			BlockHashCalculatorConsumer(
 					const GenerationHashSeed& generationHashSeed,
-					const model::TransactionRegistry& transactionRegistry)
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoThreadPool>& pPool)
 					: m_generationHashSeed(generationHashSeed)
 					, m_transactionRegistry(transactionRegistry)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -42,21 +49,18 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// note that disruptor input elements have been extracted from a packet (or created within this
+				// process), so their sizes have already been validated
 				for (auto& element : elements) {
-					// note that disruptor input elements have been extracted from a packet (or created within this
-					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
-						element.Transactions.push_back(transactionElement);
-
-						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+				}
 
-					Hash256 transactionsHash;
-					transactionsHashBuilder.final(transactionsHash);
-					if (element.Block.TransactionsHash != transactionsHash)
+				// hash transactions of all blocks together so that work is spread evenly independent of block sizes
+				updateHashes(elements);
+
+				for (auto& element : elements) {
+					if (element.Block.TransactionsHash != calculateTransactionsHash(element.Transactions))
 						return Abort(Failure_Consumer_Block_Transactions_Hash_Mismatch);
 
 					element.EntityHash = model::CalculateHash(element.Block);
@@ -65,16 +69,78 @@ namespace catapult { namespace consumers {
 				return Continue();
 			}
 
+		private:
+			void updateHashes(BlockElements& elements) const {
+				std::vector<model::TransactionElement*> transactionElements;
+				for (auto& element : elements) {
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
+
+				auto numPartitions = m_pPool
+						? std::min<size_t>(m_pPool->numWorkerThreads(), transactionElements.size() / Min_Transactions_Per_Partition)
+						: 0;
+				if (numPartitions <= 1) {
+					auto count = transactionElements.size();
+					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElements.data(), count);
+					return;
+				}
+
+				auto partitionCallback = [this](auto itBegin, auto itEnd, auto, auto) {
+					auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, &*itBegin, count);
+				};
+
+				thread::ParallelForPartition(m_pPool->ioContext(), transactionElements, numPartitions, partitionCallback).get();
+			}
+
+			Hash256 calculateTransactionsHash(const std::vector<model::TransactionElement>& transactionElements) const {
+				crypto::MerkleHashBuilder transactionsHashBuilder(transactionElements.size());
+				for (const auto& transactionElement : transactionElements)
+					transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
+
+				Hash256 transactionsHash;
+				if (!m_pPool || transactionElements.size() < Min_Parallel_Merkle_Layer_Size) {
+					transactionsHashBuilder.final(transactionsHash);
+					return transactionsHash;
+				}
+
+				// hash node pairs of large layers in parallel
+				transactionsHashBuilder.final(transactionsHash, [&pool = *m_pPool](const auto& layerBuffers, auto& layerHashes) {
+					if (layerBuffers.size() < Min_Parallel_Merkle_Layer_Size) {
+						crypto::Sha3_256MultiPart(layerBuffers.data(), 2, layerHashes.data(), layerHashes.size());
+						return;
+					}
+
+					auto partitionCallback = [&layerBuffers](auto itBegin, auto itEnd, auto startIndex, auto) {
+						auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+						crypto::Sha3_256MultiPart(&layerBuffers[2 * startIndex], 2, &*itBegin, count);
+					};
+
+					thread::ParallelForPartition(pool.ioContext(), layerHashes, pool.numWorkerThreads(), partitionCallback).get();
+				});
+
+				return transactionsHash;
+			}
+
 		private:
 			GenerationHashSeed m_generationHashSeed;
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<thread::IoThreadPool> m_pPool;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry);
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, nullptr);
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoThreadPool>& pPool) {
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, pPool);
 	}
 
 	namespace {
@@ -92,8 +158,7 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, element);
+				model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, elements);
 
 				return Continue();
 			}
@@ -19,13 +19,20 @@
 **/
 
 #include "MerkleHashBuilder.h"
-#include "Hashes.h"
-#include "catapult/functions.h"
+#include "Sha3MultiBuffer.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
 	namespace {
-		Hash256 Final(std::vector<Hash256>& hashes, const consumer<const Hash256*, size_t>& hashConsumer) {
+		void HashLayer(const std::vector<RawBuffer>& layerBuffers, std::vector<Hash256>& layerHashes) {
+			Sha3_256MultiPart(layerBuffers.data(), 2, layerHashes.data(), layerHashes.size());
+		}
+
+		Hash256 Final(
+				std::vector<Hash256>& hashes,
+				const MerkleHashBuilder::LayerHasher& layerHasher,
+				const consumer<const Hash256*, size_t>& hashConsumer) {
 			if (hashes.empty()) {
 				Hash256 hash{};
 				hashConsumer(&hash, 1);
@@ -35,30 +42,28 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
+
+			std::vector<RawBuffer> layerBuffers;
+			std::vector<Hash256> layerHashes;
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
 				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
 				if (1 == numRemainingHashes % 2)
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
+				// hash all pairs of the current layer at once (if there is an odd number of hashes, duplicate the last one)
+				layerBuffers.clear();
+				for (auto i = 0u; i < numRemainingHashes; i += 2) {
+					layerBuffers.push_back(hashes[i]);
+					layerBuffers.push_back(i + 1 < numRemainingHashes ? hashes[i + 1] : hashes[i]);
 				}
 
-				numRemainingHashes /= 2;
+				numRemainingHashes = layerBuffers.size() / 2;
+				layerHashes.resize(numRemainingHashes);
+				layerHasher(layerBuffers, layerHashes);
+
+				std::copy(layerHashes.cbegin(), layerHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), numRemainingHashes);
 			}
 
 			return hashes[0];
@@ -75,13 +80,18 @@ namespace catapult { namespace crypto {
 
 	void MerkleHashBuilder::final(Hash256& hash) {
 		// build the merkle root
-		hash = Final(m_hashes, [](const auto*, auto) {});
+		final(hash, HashLayer);
+	}
+
+	void MerkleHashBuilder::final(Hash256& hash, const LayerHasher& layerHasher) {
+		// build the merkle root
+		hash = Final(m_hashes, layerHasher, [](const auto*, auto) {});
 	}
 
 	void MerkleHashBuilder::final(std::vector<Hash256>& tree) {
 		// build the complete merkle tree
 		tree.reserve(TreeSize(m_hashes.size()));
-		Final(m_hashes, [&tree](const Hash256* pHash, size_t count) {
+		Final(m_hashes, HashLayer, [&tree](const Hash256* pHash, size_t count) {
 			for (auto i = 0u; i < count; ++i)
 				tree.push_back(*pHash++);
 		});
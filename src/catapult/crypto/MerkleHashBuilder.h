@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <vector>
 
@@ -26,6 +27,10 @@ namespace catapult { namespace crypto {
 
 	/// Builder for creating a merkle hash.
 	class MerkleHashBuilder {
+	public:
+		/// Hashes all node pairs of a layer (\a layerBuffers) into the (presized) parent layer (\a layerHashes).
+		using LayerHasher = consumer<const std::vector<RawBuffer>&, std::vector<Hash256>&>;
+
 	public:
 		/// Creates a new merkle hash builder with the specified initial \a capacity.
 		explicit MerkleHashBuilder(size_t capacity = 0);
@@ -37,6 +42,9 @@ namespace catapult { namespace crypto {
 		/// Finalizes the merkle hash into \a hash.
 		void final(Hash256& hash);
 
+		/// Finalizes the merkle hash into \a hash using \a layerHasher to hash the node pairs of each layer.
+		void final(Hash256& hash, const LayerHasher& layerHasher);
+
 		/// Finalizes the complete merkle tree into \a tree.
 		void final(std::vector<Hash256>& tree);
 
@@ -0,0 +1,426 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Sha3MultiBuffer.h"
+#include "Hashes.h"
+#include <cstring>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		constexpr size_t Sha3_256_Rate = 136;
+		constexpr size_t Rate_Words = Sha3_256_Rate / sizeof(uint64_t);
+		constexpr size_t State_Words = 25;
+		constexpr size_t Num_Rounds = 24;
+
+		constexpr uint64_t Round_Constants[Num_Rounds] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// region LaneOps
+
+		// each vector holds the same state word of Num_Lanes independent keccak states
+
+#if defined(__AVX512F__)
+		struct LaneOps {
+			static constexpr size_t Num_Lanes = 8;
+			using Vector = __m512i;
+
+			static Vector Load(const uint64_t* pWords) {
+				return _mm512_loadu_si512(pWords);
+			}
+
+			static void Store(uint64_t* pWords, Vector vector) {
+				_mm512_storeu_si512(pWords, vector);
+			}
+
+			static Vector Broadcast(uint64_t word) {
+				return _mm512_set1_epi64(static_cast<long long>(word));
+			}
+
+			static Vector Xor(Vector lhs, Vector rhs) {
+				return _mm512_xor_si512(lhs, rhs);
+			}
+
+			// calculates a ^ (~b & c)
+			static Vector XorAndNot(Vector a, Vector b, Vector c) {
+				return _mm512_ternarylogic_epi64(a, b, c, 0xD2);
+			}
+
+			template<int N>
+			static Vector Rotl(Vector vector) {
+				return _mm512_mask_rol_epi64(vector, static_cast<__mmask8>(0xFF), vector, N);
+			}
+		};
+#elif defined(__AVX2__)
+		struct LaneOps {
+			static constexpr size_t Num_Lanes = 4;
+			using Vector = __m256i;
+
+			static Vector Load(const uint64_t* pWords) {
+				return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWords));
+			}
+
+			static void Store(uint64_t* pWords, Vector vector) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(pWords), vector);
+			}
+
+			static Vector Broadcast(uint64_t word) {
+				return _mm256_set1_epi64x(static_cast<long long>(word));
+			}
+
+			static Vector Xor(Vector lhs, Vector rhs) {
+				return _mm256_xor_si256(lhs, rhs);
+			}
+
+			// calculates a ^ (~b & c)
+			static Vector XorAndNot(Vector a, Vector b, Vector c) {
+				return _mm256_xor_si256(a, _mm256_andnot_si256(b, c));
+			}
+
+			template<int N>
+			static Vector Rotl(Vector vector) {
+				if constexpr (0 == N)
+					return vector;
+				else
+					return _mm256_or_si256(_mm256_slli_epi64(vector, N), _mm256_srli_epi64(vector, 64 - N));
+			}
+		};
+#else
+		// portable fallback, the fixed size lane loops allow the compiler to vectorize with whatever instruction set is enabled
+		struct LaneOps {
+			static constexpr size_t Num_Lanes = 4;
+
+			struct Vector {
+				uint64_t Words[Num_Lanes];
+			};
+
+			static Vector Load(const uint64_t* pWords) {
+				Vector vector;
+				std::memcpy(vector.Words, pWords, sizeof(Vector));
+				return vector;
+			}
+
+			static void Store(uint64_t* pWords, const Vector& vector) {
+				std::memcpy(pWords, vector.Words, sizeof(Vector));
+			}
+
+			static Vector Broadcast(uint64_t word) {
+				Vector vector;
+				for (auto& vectorWord : vector.Words)
+					vectorWord = word;
+
+				return vector;
+			}
+
+			static Vector Xor(const Vector& lhs, const Vector& rhs) {
+				Vector vector;
+				for (auto i = 0u; i < Num_Lanes; ++i)
+					vector.Words[i] = lhs.Words[i] ^ rhs.Words[i];
+
+				return vector;
+			}
+
+			// calculates a ^ (~b & c)
+			static Vector XorAndNot(const Vector& a, const Vector& b, const Vector& c) {
+				Vector vector;
+				for (auto i = 0u; i < Num_Lanes; ++i)
+					vector.Words[i] = a.Words[i] ^ (~b.Words[i] & c.Words[i]);
+
+				return vector;
+			}
+
+			template<int N>
+			static Vector Rotl(const Vector& vector) {
+				if constexpr (0 == N) {
+					return vector;
+				} else {
+					Vector result;
+					for (auto i = 0u; i < Num_Lanes; ++i)
+						result.Words[i] = (vector.Words[i] << N) | (vector.Words[i] >> (64 - N));
+
+					return result;
+				}
+			}
+		};
+#endif
+
+		constexpr auto Num_Lanes = LaneOps::Num_Lanes;
+
+		// endregion
+
+		// region KeccakF1600
+
+		// permutes Num_Lanes interleaved states, where word i of lane j is stored at pState[i * Num_Lanes + j]
+		void KeccakF1600(uint64_t* pState) {
+			using Vector = LaneOps::Vector;
+
+			Vector a[State_Words];
+			for (auto i = 0u; i < State_Words; ++i)
+				a[i] = LaneOps::Load(pState + i * Num_Lanes);
+
+			Vector b[State_Words];
+			Vector c[5];
+			Vector d[5];
+			for (auto round = 0u; round < Num_Rounds; ++round) {
+				// theta
+				c[0] = LaneOps::Xor(LaneOps::Xor(LaneOps::Xor(a[0], a[5]), LaneOps::Xor(a[10], a[15])), a[20]);
+				c[1] = LaneOps::Xor(LaneOps::Xor(LaneOps::Xor(a[1], a[6]), LaneOps::Xor(a[11], a[16])), a[21]);
+				c[2] = LaneOps::Xor(LaneOps::Xor(LaneOps::Xor(a[2], a[7]), LaneOps::Xor(a[12], a[17])), a[22]);
+				c[3] = LaneOps::Xor(LaneOps::Xor(LaneOps::Xor(a[3], a[8]), LaneOps::Xor(a[13], a[18])), a[23]);
+				c[4] = LaneOps::Xor(LaneOps::Xor(LaneOps::Xor(a[4], a[9]), LaneOps::Xor(a[14], a[19])), a[24]);
+
+				d[0] = LaneOps::Xor(c[4], LaneOps::Rotl<1>(c[1]));
+				d[1] = LaneOps::Xor(c[0], LaneOps::Rotl<1>(c[2]));
+				d[2] = LaneOps::Xor(c[1], LaneOps::Rotl<1>(c[3]));
+				d[3] = LaneOps::Xor(c[2], LaneOps::Rotl<1>(c[4]));
+				d[4] = LaneOps::Xor(c[3], LaneOps::Rotl<1>(c[0]));
+
+				for (auto y = 0u; y < State_Words; y += 5) {
+					a[y + 0] = LaneOps::Xor(a[y + 0], d[0]);
+					a[y + 1] = LaneOps::Xor(a[y + 1], d[1]);
+					a[y + 2] = LaneOps::Xor(a[y + 2], d[2]);
+					a[y + 3] = LaneOps::Xor(a[y + 3], d[3]);
+					a[y + 4] = LaneOps::Xor(a[y + 4], d[4]);
+				}
+
+				// rho and pi
+				b[0] = LaneOps::Rotl<0>(a[0]);
+				b[10] = LaneOps::Rotl<1>(a[1]);
+				b[20] = LaneOps::Rotl<62>(a[2]);
+				b[5] = LaneOps::Rotl<28>(a[3]);
+				b[15] = LaneOps::Rotl<27>(a[4]);
+				b[16] = LaneOps::Rotl<36>(a[5]);
+				b[1] = LaneOps::Rotl<44>(a[6]);
+				b[11] = LaneOps::Rotl<6>(a[7]);
+				b[21] = LaneOps::Rotl<55>(a[8]);
+				b[6] = LaneOps::Rotl<20>(a[9]);
+				b[7] = LaneOps::Rotl<3>(a[10]);
+				b[17] = LaneOps::Rotl<10>(a[11]);
+				b[2] = LaneOps::Rotl<43>(a[12]);
+				b[12] = LaneOps::Rotl<25>(a[13]);
+				b[22] = LaneOps::Rotl<39>(a[14]);
+				b[23] = LaneOps::Rotl<41>(a[15]);
+				b[8] = LaneOps::Rotl<45>(a[16]);
+				b[18] = LaneOps::Rotl<15>(a[17]);
+				b[3] = LaneOps::Rotl<21>(a[18]);
+				b[13] = LaneOps::Rotl<8>(a[19]);
+				b[14] = LaneOps::Rotl<18>(a[20]);
+				b[24] = LaneOps::Rotl<2>(a[21]);
+				b[9] = LaneOps::Rotl<61>(a[22]);
+				b[19] = LaneOps::Rotl<56>(a[23]);
+				b[4] = LaneOps::Rotl<14>(a[24]);
+
+				// chi
+				for (auto y = 0u; y < State_Words; y += 5) {
+					a[y + 0] = LaneOps::XorAndNot(b[y + 0], b[y + 1], b[y + 2]);
+					a[y + 1] = LaneOps::XorAndNot(b[y + 1], b[y + 2], b[y + 3]);
+					a[y + 2] = LaneOps::XorAndNot(b[y + 2], b[y + 3], b[y + 4]);
+					a[y + 3] = LaneOps::XorAndNot(b[y + 3], b[y + 4], b[y + 0]);
+					a[y + 4] = LaneOps::XorAndNot(b[y + 4], b[y + 0], b[y + 1]);
+				}
+
+				// iota
+				a[0] = LaneOps::Xor(a[0], LaneOps::Broadcast(Round_Constants[round]));
+			}
+
+			for (auto i = 0u; i < State_Words; ++i)
+				LaneOps::Store(pState + i * Num_Lanes, a[i]);
+		}
+
+		// endregion
+
+		// region MessageReader
+
+		class MessageReader {
+		public:
+			MessageReader()
+					: m_pParts(nullptr)
+					, m_numParts(0)
+					, m_partIndex(0)
+					, m_partOffset(0)
+			{}
+
+		public:
+			void reset(const RawBuffer* pParts, size_t numParts) {
+				m_pParts = pParts;
+				m_numParts = numParts;
+				m_partIndex = 0;
+				m_partOffset = 0;
+			}
+
+			// reads the next rate sized block into \a pBlock and returns \c true if it is the final (padded) block
+			bool read(uint8_t* pBlock) {
+				size_t size = 0;
+				while (size < Sha3_256_Rate && m_partIndex < m_numParts) {
+					const auto& part = m_pParts[m_partIndex];
+					auto count = std::min(Sha3_256_Rate - size, part.Size - m_partOffset);
+					if (0 != count)
+						std::memcpy(pBlock + size, part.pData + m_partOffset, count);
+
+					size += count;
+					m_partOffset += count;
+					if (m_partOffset == part.Size) {
+						++m_partIndex;
+						m_partOffset = 0;
+					}
+				}
+
+				// when the message size is a multiple of the rate, padding is added in a separate block
+				if (Sha3_256_Rate == size)
+					return false;
+
+				std::memset(pBlock + size, 0, Sha3_256_Rate - size);
+				pBlock[size] |= 0x06;
+				pBlock[Sha3_256_Rate - 1] |= 0x80;
+				return true;
+			}
+
+		private:
+			const RawBuffer* m_pParts;
+			size_t m_numParts;
+			size_t m_partIndex;
+			size_t m_partOffset;
+		};
+
+		// endregion
+
+		// region MultiBufferHasher
+
+		class MultiBufferHasher {
+		public:
+			MultiBufferHasher(const RawBuffer* pDataBuffers, size_t numParts, Hash256* pHashes, size_t count)
+					: m_pDataBuffers(pDataBuffers)
+					, m_numParts(numParts)
+					, m_pHashes(pHashes)
+					, m_count(count)
+					, m_nextMessageIndex(0)
+					, m_numActiveLanes(Num_Lanes)
+					, m_state()
+					, m_messageIndexes()
+					, m_isLaneActive()
+			{}
+
+		public:
+			void hash() {
+				for (auto lane = 0u; lane < Num_Lanes; ++lane)
+					startNextMessage(lane);
+
+				// messages are assigned to lanes as soon as a lane is free, so messages of different sizes can be mixed
+				bool isFinalBlock[Num_Lanes] = {};
+				while (0 != m_numActiveLanes) {
+					for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+						if (m_isLaneActive[lane])
+							isFinalBlock[lane] = absorb(lane);
+					}
+
+					KeccakF1600(m_state);
+
+					for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+						if (!m_isLaneActive[lane] || !isFinalBlock[lane])
+							continue;
+
+						squeeze(lane, m_pHashes[m_messageIndexes[lane]]);
+						startNextMessage(lane);
+					}
+				}
+			}
+
+		private:
+			void startNextMessage(size_t lane) {
+				if (m_nextMessageIndex == m_count) {
+					m_isLaneActive[lane] = false;
+					--m_numActiveLanes;
+					return;
+				}
+
+				m_messageIndexes[lane] = m_nextMessageIndex++;
+				m_readers[lane].reset(m_pDataBuffers + m_messageIndexes[lane] * m_numParts, m_numParts);
+				m_isLaneActive[lane] = true;
+
+				for (auto i = 0u; i < State_Words; ++i)
+					m_state[i * Num_Lanes + lane] = 0;
+			}
+
+			bool absorb(size_t lane) {
+				uint8_t block[Sha3_256_Rate];
+				auto isFinalBlock = m_readers[lane].read(block);
+				for (auto i = 0u; i < Rate_Words; ++i) {
+					uint64_t word;
+					std::memcpy(&word, block + i * sizeof(uint64_t), sizeof(uint64_t));
+					m_state[i * Num_Lanes + lane] ^= word;
+				}
+
+				return isFinalBlock;
+			}
+
+			void squeeze(size_t lane, Hash256& hash) const {
+				for (auto i = 0u; i < Hash256::Size / sizeof(uint64_t); ++i)
+					std::memcpy(hash.data() + i * sizeof(uint64_t), &m_state[i * Num_Lanes + lane], sizeof(uint64_t));
+			}
+
+		private:
+			const RawBuffer* m_pDataBuffers;
+			size_t m_numParts;
+			Hash256* m_pHashes;
+			size_t m_count;
+			size_t m_nextMessageIndex;
+			size_t m_numActiveLanes;
+
+			alignas(64) uint64_t m_state[State_Words * Num_Lanes];
+			MessageReader m_readers[Num_Lanes];
+			size_t m_messageIndexes[Num_Lanes];
+			bool m_isLaneActive[Num_Lanes];
+		};
+
+		// endregion
+	}
+
+	size_t Sha3_256MultiLaneCount() {
+		return Num_Lanes;
+	}
+
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count) {
+		Sha3_256MultiPart(pDataBuffers, 1, pHashes, count);
+	}
+
+	void Sha3_256MultiPart(const RawBuffer* pDataBuffers, size_t numParts, Hash256* pHashes, size_t count) {
+		// a single message does not benefit from multiple lanes
+		if (1 == count) {
+			Sha3_256_Builder builder;
+			for (auto i = 0u; i < numParts; ++i)
+				builder.update(pDataBuffers[i]);
+
+			builder.final(*pHashes);
+			return;
+		}
+
+		MultiBufferHasher(pDataBuffers, numParts, pHashes, count).hash();
+	}
+}}
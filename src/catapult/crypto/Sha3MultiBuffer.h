@@ -0,0 +1,36 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace crypto {
+
+	/// Gets the number of messages that are hashed concurrently by the multi-buffer hash functions.
+	/// \note This depends on the instruction set the library is compiled for (8 with AVX-512, 4 otherwise).
+	size_t Sha3_256MultiLaneCount();
+
+	/// Calculates the 256-bit SHA3 hashes of \a count independent data buffers (\a pDataBuffers) into \a pHashes.
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count);
+
+	/// Calculates the 256-bit SHA3 hashes of \a count independent messages into \a pHashes, where each message is composed of
+	/// \a numParts consecutive data buffers in \a pDataBuffers that are hashed as if they were concatenated.
+	void Sha3_256MultiPart(const RawBuffer* pDataBuffers, size_t numParts, Hash256* pHashes, size_t count);
+}}
@@ -20,23 +20,81 @@
 
 #pragma once
 #include "DeltaElements.h"
+#include "catapult/utils/traits/Traits.h"
 #include "catapult/exceptions.h"
+#include <utility>
 
 namespace catapult { namespace deltaset {
 
+	namespace detail {
+		template<typename TContainer, typename = void>
+		struct SupportsBucketReserve : std::false_type {};
+
+		template<typename TContainer>
+		struct SupportsBucketReserve<
+				TContainer,
+				utils::traits::is_type_expression_t<decltype(
+						std::declval<TContainer&>().reserve(0),
+						std::declval<TContainer&>().bucket_count() * std::declval<TContainer&>().max_load_factor())>
+		> : std::true_type {};
+
+		template<typename TContainer, typename = void>
+		struct SupportsMappedValueAssignment : std::false_type {};
+
+		template<typename TContainer>
+		struct SupportsMappedValueAssignment<
+				TContainer,
+				utils::traits::is_type_expression_t<decltype(
+						std::declval<TContainer&>().begin()->second = std::declval<const typename TContainer::mapped_type&>())>
+		> : std::true_type {};
+
+		template<typename TContainer, typename = void>
+		struct SupportsNodeExtraction : std::false_type {};
+
+		template<typename TContainer>
+		struct SupportsNodeExtraction<
+				TContainer,
+				utils::traits::is_type_expression_t<decltype(
+						std::declval<TContainer&>().extract(std::declval<typename TContainer::const_iterator>()).value())>
+		> : std::true_type {};
+
+		template<typename TStorageSet, typename TIterator, typename TElement>
+		void UpdateElement(TStorageSet& elements, TIterator iter, const TElement& element) {
+			if constexpr (SupportsMappedValueAssignment<TStorageSet>()) {
+				// assign value in place so that neither a node nor the value's storage needs to be reallocated
+				iter->second = element.second;
+			} else if constexpr (SupportsNodeExtraction<TStorageSet>()) {
+				// reuse the existing node
+				auto node = elements.extract(iter);
+				node.value() = element;
+				elements.insert(std::move(node));
+			} else {
+				iter = elements.erase(iter);
+				elements.insert(iter, element);
+			}
+		}
+	}
+
 	/// Applies all changes in \a deltas to \a elements.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
 	void UpdateSet(TStorageSet& elements, const DeltaElements<TMemorySet>& deltas) {
-		if (!deltas.Added.empty())
+		if (!deltas.Added.empty()) {
+			if constexpr (detail::SupportsBucketReserve<TStorageSet>()) {
+				// only reserve when the buckets need to grow because reserving fewer elements can rehash into fewer buckets
+				auto newSize = elements.size() + deltas.Added.size();
+				if (static_cast<float>(newSize) > static_cast<float>(elements.bucket_count()) * elements.max_load_factor())
+					elements.reserve(newSize);
+			}
+
 			elements.insert(deltas.Added.cbegin(), deltas.Added.cend());
+		}
 
 		for (const auto& element : deltas.Copied) {
 			auto iter = elements.find(TKeyTraits::ToKey(element));
 			if (elements.cend() == iter)
 				CATAPULT_THROW_INVALID_ARGUMENT("element not found, cannot update");
 
-			iter = elements.erase(iter);
-			elements.insert(iter, element);
+			detail::UpdateElement(elements, iter, element);
 		}
 
 		for (const auto& element : deltas.Removed)
@@ -76,9 +76,17 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Creates a batch range dispatcher around \a dispatcher with specified \a equalityStrategy.
 		BatchRangeDispatcher(ConsumerDispatcher& dispatcher, model::NodeIdentityEqualityStrategy equalityStrategy)
+				: BatchRangeDispatcher(dispatcher, equalityStrategy, 0)
+		{}
+
+		/// Creates a batch range dispatcher around \a dispatcher with specified \a equalityStrategy that dispatches
+		/// all queued elements as soon as at least \a maxBatchSize entities are queued (\c 0 to disable).
+		BatchRangeDispatcher(ConsumerDispatcher& dispatcher, model::NodeIdentityEqualityStrategy equalityStrategy, size_t maxBatchSize)
 				: m_dispatcher(dispatcher)
 				, m_equalityStrategy(equalityStrategy)
+				, m_maxBatchSize(maxBatchSize)
 				, m_rangesMap(CreateGroupedRangesMap(m_equalityStrategy))
+				, m_numQueuedEntities(0)
 		{}
 
 	public:
@@ -90,20 +98,36 @@ namespace catapult { namespace disruptor {
 
 	public:
 		/// Queues processing of \a range from \a source.
+		/// \note All queued elements are dispatched immediately when the max batch size is reached.
 		void queue(TAnnotatedEntityRange&& range, InputSource source) {
-			utils::SpinLockGuard guard(m_lock);
-			m_rangesMap[{ range.SourceIdentity, source }].push_back(std::move(range.Range));
+			{
+				utils::SpinLockGuard guard(m_lock);
+				m_numQueuedEntities += range.Range.size();
+				m_rangesMap[{ range.SourceIdentity, source }].push_back(std::move(range.Range));
+				if (0 == m_maxBatchSize || m_numQueuedEntities < m_maxBatchSize)
+					return;
+			}
+
+			dispatch();
 		}
 
 		/// Dispatches all queued elements to the underlying dispatcher.
 		void dispatch() {
+			// create the replacement map outside of the lock so that queuing threads are not blocked by its allocation
 			auto rangesMap = CreateGroupedRangesMap(m_equalityStrategy);
 
 			{
 				utils::SpinLockGuard guard(m_lock);
-				rangesMap = std::move(m_rangesMap);
+				m_numQueuedEntities = 0;
+				std::swap(rangesMap, m_rangesMap);
 			}
 
+			dispatch(std::move(rangesMap));
+		}
+
+	private:
+		void dispatch(GroupedRangesMap&& rangesMap) {
+			// ranges are only merged per source so that failures and bans can be attributed to the correct node
 			for (auto& pair : rangesMap) {
 				auto mergedRange = EntityRange::MergeRanges(std::move(pair.second));
 				m_dispatcher.processElement(ConsumerInput({ std::move(mergedRange), pair.first.SourceIdentity }, pair.first.Source));
@@ -118,7 +142,9 @@ namespace catapult { namespace disruptor {
 	private:
 		ConsumerDispatcher& m_dispatcher;
 		model::NodeIdentityEqualityStrategy m_equalityStrategy;
+		size_t m_maxBatchSize;
 		GroupedRangesMap m_rangesMap;
+		size_t m_numQueuedEntities;
 		mutable utils::SpinLock m_lock;
 	};
 }}
@@ -140,17 +140,15 @@ namespace catapult { namespace disruptor {
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
+	DisruptorElementId ConsumerDispatcher::tryClaim() {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
-		auto maxPosition = m_barriers[0].position();
-		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
-		auto totalCapacity = m_disruptor.capacity();
-
-		if (requiredCapacity < totalCapacity)
-			return true;
+		auto id = m_disruptor.tryClaim(minPosition);
+		if (0 != id && id - minPosition + 1 < m_disruptor.capacity())
+			return id;
 
+		auto maxPosition = 0 == id ? m_disruptor.added() : id;
 		CATAPULT_LOG(warning) << "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << maxPosition << ")";
-		return requiredCapacity == totalCapacity;
+		return id;
 	}
 
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete) {
@@ -166,9 +164,9 @@ namespace catapult { namespace disruptor {
 			return 0;
 		}
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		if (!canProcessNextElement()) {
+		// atomically check spare capacity AND reserve a slot (without blocking other producers)
+		auto id = tryClaim();
+		if (0 == id) {
 			if (m_shouldThrowIfFull)
 				CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
 
@@ -176,7 +174,9 @@ namespace catapult { namespace disruptor {
 		}
 
 		++m_numActiveElements;
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete));
+		m_disruptor.publish(id, std::move(input), wrap(processingComplete));
+
+		// publishing is ordered, so the first barrier never passes an unpublished element
 		m_barriers[0].advance();
 		return id;
 	}
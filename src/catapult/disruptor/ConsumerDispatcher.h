@@ -75,7 +75,7 @@ namespace catapult { namespace disruptor {
 
 		void advance(ConsumerEntry& consumerEntry);
 
-		bool canProcessNextElement() const;
+		DisruptorElementId tryClaim();
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
 
@@ -88,7 +88,5 @@ namespace catapult { namespace disruptor {
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
-
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
 }}
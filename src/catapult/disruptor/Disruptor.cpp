@@ -22,27 +22,55 @@
 #include "catapult/utils/Functional.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
 	// short rationale for lack of locks:
 	//  1. m_container is initialized with size, so most operations here don't require locks
-	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
-	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
+	//  2. producers claim slots with a CAS on m_allElementsCount (tryClaim checks if the Disruptor is full),
+	//     so each slot is written by exactly one producer
+	//  3. slots are published strictly in claim order via m_publishedElementsCount
+	//  4. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
 
 	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
 			: m_elementTraceInterval(elementTraceInterval)
 			, m_container(disruptorSize)
 			, m_allElementsCount(0)
+			, m_publishedElementsCount(0)
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
-		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
+		auto id = ++m_allElementsCount;
+		publish(id, std::move(input), processingComplete);
+		return id;
+	}
+
+	DisruptorElementId Disruptor::tryClaim(PositionType minPosition) {
+		auto numClaimedElements = m_allElementsCount.load();
+		do {
+			// check for space for *next* element
+			auto requiredCapacity = numClaimedElements - minPosition + 1 + 1;
+			if (requiredCapacity > m_container.capacity())
+				return 0;
+		} while (!m_allElementsCount.compare_exchange_weak(numClaimedElements, numClaimedElements + 1));
+
+		return numClaimedElements + 1;
+	}
+
+	void Disruptor::publish(DisruptorElementId id, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
+		// slot is owned exclusively by the claiming producer, so it can be filled before waiting for predecessors
+		auto position = id - 1;
+		auto& element = m_container[position];
+		element = DisruptorElement(std::move(input), id, processingComplete);
+		if (IsIntervalElementId(id, m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
-		m_container.push_back(std::move(element));
-		return element.id();
+		// wait for all previously claimed elements to be published
+		while (position != m_publishedElementsCount.load(std::memory_order_acquire))
+			std::this_thread::yield();
+
+		m_publishedElementsCount.store(id, std::memory_order_release);
 	}
 
 	void Disruptor::markSkipped(PositionType position, const ConsumerResult& result) {
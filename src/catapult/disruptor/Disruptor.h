@@ -26,6 +26,7 @@
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/CircularBuffer.h"
 #include "catapult/utils/NonCopyable.h"
+#include <algorithm>
 #include <vector>
 
 namespace catapult { namespace disruptor {
@@ -40,8 +41,19 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Adds \a input to the underlying container and returns the assigned disruptor element id.
 		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note This does not check for free space and can overwrite unprocessed elements.
 		DisruptorElementId add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
 
+		/// Claims the next element slot unless it would overwrite an element at or after \a minPosition.
+		/// Returns the claimed disruptor element id or \c 0 if the disruptor is full.
+		/// \note Multiple producers can claim concurrently.
+		DisruptorElementId tryClaim(PositionType minPosition);
+
+		/// Publishes \a input into the slot claimed for \a id.
+		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note Elements are published in claim order, so this blocks until all elements with lower ids are published.
+		void publish(DisruptorElementId id, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
+
 		/// Sets the skip flag on the element at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result);
 
@@ -55,7 +67,7 @@ namespace catapult { namespace disruptor {
 
 		/// Gets the size of the disruptor.
 		inline size_t size() const {
-			return m_container.size();
+			return static_cast<size_t>(std::min<uint64_t>(m_publishedElementsCount, m_container.capacity()));
 		}
 
 		/// Gets the capacity of the disruptor.
@@ -63,14 +75,20 @@ namespace catapult { namespace disruptor {
 			return m_container.capacity();
 		}
 
-		/// Gets the number of total elements added to the disruptor.
+		/// Gets the number of total elements added (claimed) to the disruptor.
 		inline uint64_t added() const {
 			return m_allElementsCount;
 		}
 
+		/// Gets the number of total elements published to the disruptor.
+		inline uint64_t published() const {
+			return m_publishedElementsCount;
+		}
+
 	private:
 		size_t m_elementTraceInterval;
 		utils::CircularBuffer<DisruptorElement> m_container;
 		std::atomic<uint64_t> m_allElementsCount;
+		std::atomic<uint64_t> m_publishedElementsCount;
 	};
 }}
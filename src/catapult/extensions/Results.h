@@ -37,6 +37,9 @@ namespace catapult { namespace extensions {
 	/// Validation failed because socket read rate limit was exceeded.
 	DEFINE_EXTENSION_RESULT(Read_Rate_Limit_Exceeded, 3);
 
+	/// Validation failed because the unconfirmed transaction was pruned from the unconfirmed cache after its deadline passed.
+	DEFINE_EXTENSION_RESULT(Unconfirmed_Transaction_Cache_Prune, 4);
+
 #ifndef CUSTOM_RESULT_DEFINITION
 }}
 #endif
@@ -0,0 +1,112 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionsSnapshotStorage.h"
+#include "catapult/io/BufferedFileStream.h"
+#include "catapult/io/EntityIoUtils.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace extensions {
+
+	void SaveTransactionsSnapshot(
+			const std::string& filename,
+			Height height,
+			const std::vector<std::shared_ptr<const model::Transaction>>& transactions) {
+		// write to a temporary file so that an interrupted save never leaves a partial snapshot behind
+		auto tempFilename = filename + ".tmp";
+		{
+			io::BufferedOutputFileStream outputStream(io::RawFile(tempFilename, io::OpenMode::Read_Write));
+			io::Write(outputStream, height);
+			io::Write32(outputStream, static_cast<uint32_t>(transactions.size()));
+			for (const auto& pTransaction : transactions)
+				io::WriteEntity(outputStream, *pTransaction);
+
+			outputStream.flush();
+		}
+
+		boost::filesystem::rename(tempFilename, filename);
+		CATAPULT_LOG(info) << "saved " << transactions.size() << " transactions at height " << height << " to " << filename;
+	}
+
+	namespace {
+		model::TransactionRange ReadTransactions(io::InputStream& inputStream, uint32_t numTransactions, uint64_t maxDataSize) {
+			// read all transactions into a single buffer so that the range does not require an allocation per transaction
+			std::vector<uint8_t> buffer;
+			std::vector<size_t> offsets;
+			offsets.reserve(std::min<uint64_t>(numTransactions, maxDataSize / sizeof(model::Transaction)));
+			for (auto i = 0u; i < numTransactions; ++i) {
+				auto transactionSize = io::Read32(inputStream);
+				if (transactionSize < sizeof(model::Transaction))
+					CATAPULT_THROW_RUNTIME_ERROR_1("transactions snapshot contains transaction with invalid size", transactionSize);
+
+				if (buffer.size() + transactionSize > maxDataSize)
+					CATAPULT_THROW_RUNTIME_ERROR_1("transactions snapshot contains truncated transaction", transactionSize);
+
+				auto offset = buffer.size();
+				offsets.push_back(offset);
+				buffer.resize(offset + transactionSize);
+				std::memcpy(&buffer[offset], &transactionSize, sizeof(uint32_t));
+				inputStream.read({ &buffer[offset] + sizeof(uint32_t), transactionSize - sizeof(uint32_t) });
+			}
+
+			return offsets.empty()
+					? model::TransactionRange()
+					: model::TransactionRange::CopyVariable(buffer.data(), buffer.size(), offsets);
+		}
+
+		model::TransactionRange ReadTransactionsSnapshot(const std::string& filename, Height height) {
+			io::RawFile file(filename, io::OpenMode::Read_Only);
+			auto fileSize = file.size();
+			io::BufferedInputFileStream inputStream(std::move(file));
+			auto snapshotHeight = io::Read<Height>(inputStream);
+			auto numTransactions = io::Read32(inputStream);
+			if (height != snapshotHeight) {
+				CATAPULT_LOG(warning)
+						<< "ignoring " << numTransactions << " transactions in " << filename
+						<< " saved at height " << snapshotHeight << " (current height " << height << ")";
+				return model::TransactionRange();
+			}
+
+			auto transactions = ReadTransactions(inputStream, numTransactions, fileSize - sizeof(Height) - sizeof(uint32_t));
+			CATAPULT_LOG(info) << "loaded " << numTransactions << " transactions at height " << height << " from " << filename;
+			return transactions;
+		}
+	}
+
+	model::TransactionRange LoadTransactionsSnapshot(const std::string& filename, Height height) {
+		if (!boost::filesystem::exists(filename))
+			return model::TransactionRange();
+
+		// a corrupt snapshot is dropped because the transactions can always be received again from the network
+		model::TransactionRange transactions;
+		try {
+			transactions = ReadTransactionsSnapshot(filename, height);
+		} catch (const catapult_runtime_error& e) {
+			CATAPULT_LOG(warning) << "ignoring corrupt transactions snapshot " << filename << ": " << e.what();
+		}
+
+		boost::filesystem::remove(filename);
+		return transactions;
+	}
+}}
@@ -0,0 +1,40 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/RangeTypes.h"
+#include "catapult/types.h"
+#include <string>
+#include <vector>
+
+namespace catapult { namespace extensions {
+
+	/// Saves \a transactions into the snapshot file \a filename and tags them with chain \a height.
+	/// \note The snapshot is written to a temporary file that replaces \a filename only after it has been fully written.
+	void SaveTransactionsSnapshot(
+			const std::string& filename,
+			Height height,
+			const std::vector<std::shared_ptr<const model::Transaction>>& transactions);
+
+	/// Loads all transactions from the snapshot file \a filename and removes the file.
+	/// \note An empty range is returned when the file does not exist, cannot be read
+	///       or was saved at a chain height other than \a height.
+	model::TransactionRange LoadTransactionsSnapshot(const std::string& filename, Height height);
+}}
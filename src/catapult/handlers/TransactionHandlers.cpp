@@ -20,6 +20,7 @@
 
 #include "TransactionHandlers.h"
 #include "HandlerUtils.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/utils/ShortHash.h"
 #include "catapult/types.h"
@@ -88,4 +89,82 @@ namespace catapult { namespace handlers {
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever) {
 		handlers.registerHandler(ionet::PacketType::Pull_Transactions, CreatePullTransactionsHandler(utRetriever));
 	}
+
+	namespace {
+		struct PullTransactionsSketchInfo {
+		public:
+			PullTransactionsSketchInfo() : IsValid(false)
+			{}
+
+		public:
+			bool IsValid;
+			BlockFeeMultiplier MinFeeMultiplier;
+			std::vector<utils::ShortHashSketch::Cell> Cells;
+		};
+
+		auto ProcessPullTransactionsSketchRequest(const ionet::Packet& packet) {
+			// packet is guaranteed to have correct type because this function is only called for matching packets by ServerPacketHandlers
+			auto dataSize = ionet::CalculatePacketDataSize(packet);
+			if (dataSize < sizeof(BlockFeeMultiplier))
+				return PullTransactionsSketchInfo();
+
+			// data is prepended with min fee multiplier
+			PullTransactionsSketchInfo info;
+			info.MinFeeMultiplier = BlockFeeMultiplier(reinterpret_cast<const BlockFeeMultiplier::ValueType&>(*packet.Data()));
+			dataSize -= sizeof(BlockFeeMultiplier);
+
+			// followed by (non-empty) sketch cells
+			using Cell = utils::ShortHashSketch::Cell;
+			const auto* pCellDataStart = packet.Data() + sizeof(BlockFeeMultiplier);
+			auto numCells = ionet::CountFixedSizeStructures<Cell>({ pCellDataStart, dataSize });
+			if (0 == numCells || numCells != utils::ShortHashSketch::CalculateRemoteSize(numCells))
+				return PullTransactionsSketchInfo();
+
+			if (numCells > utils::ShortHashSketch::Max_Remote_Cells) {
+				CATAPULT_LOG(warning) << "rejecting unconfirmed transactions sketch with " << numCells << " cells";
+				return PullTransactionsSketchInfo();
+			}
+
+			info.Cells.resize(numCells);
+			std::memcpy(static_cast<void*>(info.Cells.data()), pCellDataStart, dataSize);
+
+			info.IsValid = true;
+			return info;
+		}
+
+		auto CreatePullTransactionsSketchHandler(const UtSketchSupplier& utSketchSupplier, const UtRetriever& requestedUtRetriever) {
+			return [utSketchSupplier, requestedUtRetriever](const auto& packet, auto& context) {
+				auto info = ProcessPullTransactionsSketchRequest(packet);
+				if (!info.IsValid)
+					return;
+
+				auto sketch = utSketchSupplier(info.Cells.size());
+				sketch.subtract(utils::ShortHashSketch(std::move(info.Cells)));
+
+				utils::ShortHashesSet localShortHashes;
+				utils::ShortHashesSet remoteShortHashes;
+				if (!sketch.tryDecode(localShortHashes, remoteShortHashes)) {
+					CATAPULT_LOG(debug) << "unable to decode unconfirmed transactions sketch with " << sketch.size() << " cells";
+					context.response(ionet::PacketPayload(ionet::PacketType::Pull_Transactions_Sketch));
+					return;
+				}
+
+				auto transactions = requestedUtRetriever(info.MinFeeMultiplier, localShortHashes);
+
+				ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Transactions_Sketch);
+				builder.appendValue(static_cast<uint32_t>(localShortHashes.size() + remoteShortHashes.size()));
+				builder.appendEntities(transactions);
+				context.response(builder.build());
+			};
+		}
+	}
+
+	void RegisterPullTransactionsSketchHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UtSketchSupplier& utSketchSupplier,
+			const UtRetriever& requestedUtRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Transactions_Sketch,
+				CreatePullTransactionsSketchHandler(utSketchSupplier, requestedUtRetriever));
+	}
 }}
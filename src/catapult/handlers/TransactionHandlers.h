@@ -24,6 +24,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/Transaction.h"
 #include "catapult/utils/ShortHash.h"
+#include "catapult/utils/ShortHashSketch.h"
 #include <unordered_set>
 
 namespace catapult { namespace handlers {
@@ -44,4 +45,17 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Prototype for a function that calculates a sketch with the specified number of cells of all unconfirmed transaction short hashes.
+	using UtSketchSupplier = std::function<utils::ShortHashSketch (size_t)>;
+
+	/// Registers a pull transactions sketch handler in \a handlers that subtracts the requested sketch from the sketch supplied by
+	/// \a utSketchSupplier and responds with unconfirmed transactions returned by the retriever (\a requestedUtRetriever)
+	/// for all decoded short hashes that are only known locally.
+	/// \note The response is empty when the difference cannot be decoded. Otherwise, it is composed of the size of the
+	///       decoded difference followed by the requested transactions.
+	void RegisterPullTransactionsSketchHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const UtSketchSupplier& utSketchSupplier,
+			const UtRetriever& requestedUtRetriever);
 }}
@@ -32,6 +32,13 @@ namespace catapult { namespace io {
 		/// Indicates \a blockElement was saved.
 		virtual void notifyBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Indicates consecutive \a blockElements were saved.
+		/// \note Subscribers that can process multiple blocks more efficiently than one at a time should override this.
+		virtual void notifyBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				notifyBlock(blockElement);
+		}
+
 		/// Indicates all blocks after \a height were invalidated.
 		virtual void notifyDropBlocksAfter(Height height) = 0;
 	};
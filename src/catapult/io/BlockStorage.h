@@ -45,6 +45,13 @@ namespace catapult { namespace io {
 		/// Saves \a blockElement.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
+		/// Saves consecutive \a blockElements.
+		/// \note Storages that can write multiple blocks more efficiently than one at a time should override this.
+		virtual void saveBlocks(const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements)
+				saveBlock(blockElement);
+		}
+
 		/// Drops all blocks after \a height.
 		virtual void dropBlocksAfter(Height height) = 0;
 	};
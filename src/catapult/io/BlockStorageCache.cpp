@@ -71,7 +71,7 @@ namespace catapult { namespace io {
 
 	BlockStorageView::BlockStorageView(
 			const BlockStorage& storage,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+			utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock,
 			const CachedData& cachedData)
 			: m_storage(storage)
 			, m_readLock(std::move(readLock))
@@ -128,7 +128,7 @@ namespace catapult { namespace io {
 	BlockStorageModifier::BlockStorageModifier(
 			BlockStorage& storage,
 			PrunableBlockStorage& stagingStorage,
-			utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
+			utils::ScalableReaderWriterLock::WriterLockGuard&& writeLock,
 			CachedData& cachedData)
 			: m_storage(storage)
 			, m_stagingStorage(stagingStorage)
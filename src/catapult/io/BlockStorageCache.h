@@ -20,7 +20,7 @@
 
 #pragma once
 #include "BlockStorage.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ScalableReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
 
@@ -32,7 +32,7 @@ namespace catapult { namespace io {
 		/// Creates a view around \a storage and cache data (\a cachedData) with lock context \a readLock.
 		BlockStorageView(
 				const BlockStorage& storage,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
+				utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock,
 				const CachedData& cachedData);
 
 	public:
@@ -59,7 +59,7 @@ namespace catapult { namespace io {
 
 	private:
 		const BlockStorage& m_storage;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ScalableReaderWriterLock::ReaderLockGuard m_readLock;
 		const CachedData& m_cachedData;
 	};
 
@@ -70,7 +70,7 @@ namespace catapult { namespace io {
 		BlockStorageModifier(
 				BlockStorage& storage,
 				PrunableBlockStorage& stagingStorage,
-				utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
+				utils::ScalableReaderWriterLock::WriterLockGuard&& writeLock,
 				CachedData& cachedData);
 
 	public:
@@ -89,7 +89,7 @@ namespace catapult { namespace io {
 	private:
 		BlockStorage& m_storage;
 		PrunableBlockStorage& m_stagingStorage;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ScalableReaderWriterLock::WriterLockGuard m_writeLock;
 		CachedData& m_cachedData;
 		Height m_saveStartHeight;
 	};
@@ -115,6 +115,6 @@ namespace catapult { namespace io {
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ScalableReaderWriterLock m_lock;
 	};
 }}
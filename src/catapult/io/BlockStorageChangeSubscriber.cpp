@@ -34,6 +34,10 @@ namespace catapult { namespace io {
 				m_pStorage->saveBlock(blockElement);
 			}
 
+			void notifyBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				m_pStorage->saveBlocks(blockElements);
+			}
+
 			void notifyDropBlocksAfter(Height height) override {
 				m_pStorage->dropBlocksAfter(height);
 			}
@@ -24,6 +24,7 @@
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
+#include "SizeCalculatingOutputStream.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "catapult/preprocessor.h"
 #include <boost/filesystem/path.hpp>
@@ -174,25 +175,16 @@ namespace catapult { namespace io {
 	// region LightBlockStorage
 
 	namespace {
-		// use RawFile adapter instead of BufferedFileStream because everything read/written is in consecutive memory,
-		// so there's no benefit to buffering
-		class RawFileOutputStreamAdapter : public OutputStream {
-		public:
-			explicit RawFileOutputStreamAdapter(RawFile& rawFile) : m_rawFile(rawFile)
-			{}
-
-		public:
-			void write(const RawBuffer& buffer) override {
-				m_rawFile.write(buffer);
-			}
-
-			void flush() override {
-				CATAPULT_THROW_INVALID_ARGUMENT("flush not supported");
-			}
-
-		private:
-			RawFile& m_rawFile;
-		};
+		template<typename TWriter>
+		void WriteWithSingleSyscall(RawFile&& rawFile, TWriter writer) {
+			// size buffer to fit all data so that serializers issuing many small writes only incur a single write syscall
+			SizeCalculatingOutputStream sizeCalculatingOutputStream;
+			writer(sizeCalculatingOutputStream);
+
+			BufferedOutputFileStream outputStream(std::move(rawFile), sizeCalculatingOutputStream.size());
+			writer(outputStream);
+			outputStream.flush();
+		}
 	}
 
 	Height FileBlockStorage::chainHeight() const {
@@ -226,18 +218,18 @@ namespace catapult { namespace io {
 			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
 		}
 
-		{
-			// write element
-			auto pBlockFile = OpenBlockFile(m_dataDirectory, height, OpenMode::Read_Write);
-			RawFileOutputStreamAdapter streamAdapter(*pBlockFile);
-			WriteBlockElement(blockElement, streamAdapter);
-
-			// write statements
-			if (blockElement.OptionalStatement) {
-				BufferedOutputFileStream blockStatementOutputStream(OpenBlockStatementFile(m_dataDirectory, height, OpenMode::Read_Write));
-				WriteBlockStatement(*blockElement.OptionalStatement, blockStatementOutputStream);
-				blockStatementOutputStream.flush();
-			}
+		// write element
+		auto blockPath = GetBlockPath(m_dataDirectory, height, Block_File_Extension);
+		WriteWithSingleSyscall(RawFile(blockPath.generic_string(), OpenMode::Read_Write), [&blockElement](auto& outputStream) {
+			WriteBlockElement(blockElement, outputStream);
+		});
+
+		// write statements
+		if (blockElement.OptionalStatement) {
+			auto blockStatementFile = OpenBlockStatementFile(m_dataDirectory, height, OpenMode::Read_Write);
+			WriteWithSingleSyscall(std::move(blockStatementFile), [&blockStatement = *blockElement.OptionalStatement](auto& outputStream) {
+				WriteBlockStatement(blockStatement, outputStream);
+			});
 		}
 
 		if (FileBlockStorageMode::Hash_Index == m_mode)
@@ -118,6 +118,14 @@ namespace catapult { namespace io {
 		});
 	}
 
+	size_t FileQueueReader::tryReadNextMessages(size_t maxMessages, const consumer<const std::vector<uint8_t>&>& consumer) {
+		size_t numMessages = 0;
+		while (numMessages < maxMessages && tryReadNextMessage(consumer))
+			++numMessages;
+
+		return numMessages;
+	}
+
 	void FileQueueReader::skip(uint32_t count) {
 		for (auto i = 0u; i < count; ++i)
 			process([](const auto&) {});
@@ -65,6 +65,11 @@ namespace catapult { namespace io {
 		/// Tries to read the next message and forwards it to \a consumer if successful.
 		bool tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer);
 
+		/// Tries to read at most \a maxMessages next messages and forwards each of them to \a consumer if successful.
+		/// Returns the number of messages read.
+		/// \note Each message is removed as soon as \a consumer successfully processes it.
+		size_t tryReadNextMessages(size_t maxMessages, const consumer<const std::vector<uint8_t>&>& consumer);
+
 		/// Skips at most the next \a count messages.
 		void skip(uint32_t count);
 
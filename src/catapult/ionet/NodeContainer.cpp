@@ -53,7 +53,7 @@ namespace catapult { namespace ionet {
 	NodeContainerView::NodeContainerView(
 			const NodeContainerData& nodeContainerData,
 			const BannedNodes& bannedNodes,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
+			utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_nodeContainerData(nodeContainerData)
 			, m_bannedNodes(bannedNodes)
 			, m_readLock(std::move(readLock))
@@ -105,7 +105,7 @@ namespace catapult { namespace ionet {
 	NodeContainerModifier::NodeContainerModifier(
 			NodeContainerData& nodeContainerData,
 			BannedNodes& bannedNodes,
-			utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
+			utils::ScalableReaderWriterLock::WriterLockGuard&& writeLock)
 			: m_nodeContainerData(nodeContainerData)
 			, m_bannedNodes(bannedNodes)
 			, m_writeLock(std::move(writeLock))
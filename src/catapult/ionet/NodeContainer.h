@@ -23,7 +23,7 @@
 #include "NodeInfo.h"
 #include "NodeSet.h"
 #include "catapult/utils/ArraySet.h"
-#include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/ScalableReaderWriterLock.h"
 #include <unordered_map>
 
 namespace catapult {
@@ -43,7 +43,7 @@ namespace catapult { namespace ionet {
 		NodeContainerView(
 				const NodeContainerData& nodeContainerData,
 				const BannedNodes& bannedNodes,
-				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+				utils::ScalableReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
 		/// Number of nodes.
@@ -73,7 +73,7 @@ namespace catapult { namespace ionet {
 	private:
 		const NodeContainerData& m_nodeContainerData;
 		const BannedNodes& m_bannedNodes;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		utils::ScalableReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
 	/// Write only view on top of node container.
@@ -83,7 +83,7 @@ namespace catapult { namespace ionet {
 		NodeContainerModifier(
 				NodeContainerData& nodeContainerData,
 				BannedNodes& bannedNodes,
-				utils::SpinReaderWriterLock::WriterLockGuard&& writeLock);
+				utils::ScalableReaderWriterLock::WriterLockGuard&& writeLock);
 
 	public:
 		/// Adds \a node to the collection with \a source.
@@ -125,7 +125,7 @@ namespace catapult { namespace ionet {
 	private:
 		NodeContainerData& m_nodeContainerData;
 		BannedNodes& m_bannedNodes;
-		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
+		utils::ScalableReaderWriterLock::WriterLockGuard m_writeLock;
 	};
 
 	/// Container of nodes.
@@ -155,7 +155,7 @@ namespace catapult { namespace ionet {
 	private:
 		std::unique_ptr<NodeContainerData> m_pImpl;
 		BannedNodes m_bannedNodes;
-		mutable utils::SpinReaderWriterLock m_lock;
+		mutable utils::ScalableReaderWriterLock m_lock;
 	};
 
 	/// Finds all active nodes in \a view.
@@ -66,6 +66,9 @@ namespace catapult { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Unconfirmed transactions have been requested by a peer with a sketch of known short hashes. */ \
+	ENUM_VALUE(Pull_Transactions_Sketch, 13) \
+	\
 	/* api only packets have types [500, 600) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -35,6 +35,9 @@
 namespace catapult { namespace local {
 
 	namespace {
+		// maximum number of queued messages read by an ingestion worker at once
+		constexpr size_t Max_Ingestion_Batch_Size = 100;
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -76,17 +79,26 @@ namespace catapult { namespace local {
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
-				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
-				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
+				// block changes are decoded per message so that runs of consecutive blocks in a message can be forwarded together
+				addIngestionWorker("block_change", *m_pBlockChangeSubscriber, ReadAllBlockChanges);
+				addIngestionWorker("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange);
+				addIngestionWorker("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange);
+				addIngestionWorker("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus);
+				addIngestionWorker("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
 						auto& inputStream,
 						auto& subscriber) {
 					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
-				}));
+				});
+			}
+
+			template<typename TSubscriber, typename TMessageReader>
+			void addIngestionWorker(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				// each queue is drained by a dedicated thread so that a burst in one queue does not delay the others
+				auto& pool = m_pBootstrapper->pool();
+				auto pIngestionPool = pool.pushIsolatedPool(queueName + " ingestion", 1);
+				auto pServiceGroup = pool.pushServiceGroup(queueName + " scheduler");
+				auto pScheduler = pServiceGroup->registerService(thread::CreateScheduler(pIngestionPool));
+				pScheduler->addTask(createIngestionTask(queueName, subscriber, readNextMessage));
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
@@ -98,7 +110,8 @@ namespace catapult { namespace local {
 
 				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
 				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
+					subscribers::MessageQueueDescriptor descriptor{ queuePath, "index_broker_r.dat", "index.dat" };
+					subscribers::ReadAll(descriptor, Max_Ingestion_Batch_Size, subscriber, readNextMessage);
 					return thread::make_ready_future(thread::TaskResult::Continue);
 				};
 
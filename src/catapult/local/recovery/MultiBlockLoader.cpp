@@ -24,6 +24,7 @@
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/NemesisBlockLoader.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockChainConfiguration.h"
@@ -112,11 +113,15 @@ namespace catapult { namespace local {
 				const BlockDependentNotificationObserverFactory& observerFactory,
 				const plugins::PluginManager& pluginManager,
 				const extensions::LocalNodeStateRef& stateRef,
-				Height startHeight)
+				Height startHeight,
+				uint32_t maxBlocksPerCommit,
+				extensions::StateHashVerification stateHashVerification)
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
+				, m_maxBlocksPerCommit(std::max<uint32_t>(1, maxBlocksPerCommit))
+				, m_stateHashVerification(stateHashVerification)
 		{}
 
 	public:
@@ -130,14 +135,29 @@ namespace catapult { namespace local {
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
-				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+				// execute multiple blocks in a single cache delta in order to amortize commit costs
+				auto cacheDelta = m_stateRef.Cache.createDelta();
+				auto observerState = observers::ObserverState(cacheDelta);
 
-				stateHash = execute(*pBlockElement);
-				notifyProgress(height, chainHeight);
+				auto readOnlyCache = cacheDelta.toReadOnly();
+				auto resolverContext = m_pluginManager.createResolverContext(readOnlyCache);
 
-				pParentBlockElement = std::move(pBlockElement);
-				height = height + Height(1);
+				for (auto i = 0u; i < m_maxBlocksPerCommit && chainHeight >= height; ++i) {
+					auto pBlockElement = storage.loadBlockElement(height);
+					score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+
+					stateHash = execute(*pBlockElement, resolverContext, observerState, cacheDelta);
+					notifyProgress(height, chainHeight);
+
+					pParentBlockElement = std::move(pBlockElement);
+					height = height + Height(1);
+				}
+
+				// intermediate state hashes are not checked because only committed state needs to match the chain
+				if (extensions::StateHashVerification::Enabled == m_stateHashVerification)
+					RequireStateHashMatch(pParentBlockElement->Block, stateHash);
+
+				m_stateRef.Cache.commit(height - Height(1));
 			}
 
 			if (chainHeight >= m_startHeight) {
@@ -150,22 +170,28 @@ namespace catapult { namespace local {
 		}
 
 	private:
-		Hash256 execute(const model::BlockElement& blockElement) const {
-			auto cacheDelta = m_stateRef.Cache.createDelta();
-			auto observerState = observers::ObserverState(cacheDelta);
-
-			auto readOnlyCache = cacheDelta.toReadOnly();
-			auto resolverContext = m_pluginManager.createResolverContext(readOnlyCache);
-
+		Hash256 execute(
+				const model::BlockElement& blockElement,
+				const model::ResolverContext& resolverContext,
+				observers::ObserverState& observerState,
+				cache::CatapultCacheDelta& cacheDelta) const {
 			const auto& block = blockElement.Block;
 			observers::NotificationObserverAdapter observer(m_observerFactory(block), m_pluginManager.createNotificationPublisher());
 			chain::ExecuteBlock(blockElement, { observer, resolverContext, observerState });
 
-			// populate patricia tree delta
-			auto stateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
+			// populate patricia tree delta after every block because value activity is height dependent
+			return cacheDelta.calculateStateHash(block.Height).StateHash;
+		}
+
+		static void RequireStateHashMatch(const model::Block& block, const Hash256& cacheStateHash) {
+			if (block.StateHash == cacheStateHash)
+				return;
 
-			m_stateRef.Cache.commit(block.Height);
-			return stateHash;
+			CATAPULT_LOG(error)
+					<< "block state hash (" << block.StateHash << ") does not match "
+					<< "cache state hash (" << cacheStateHash << ") "
+					<< "at height " << block.Height;
+			CATAPULT_THROW_RUNTIME_ERROR_1("block state hash does not match cache state hash", block.Height);
 		}
 
 	private:
@@ -173,6 +199,8 @@ namespace catapult { namespace local {
 		const plugins::PluginManager& m_pluginManager;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		uint32_t m_maxBlocksPerCommit;
+		extensions::StateHashVerification m_stateHashVerification;
 	};
 
 	model::ChainScore LoadBlockChain(
@@ -180,7 +208,32 @@ namespace catapult { namespace local {
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight) {
-		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight);
+		return LoadBlockChain(observerFactory, pluginManager, stateRef, startHeight, 1);
+	}
+
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			uint32_t maxBlocksPerCommit) {
+		return LoadBlockChain(
+				observerFactory,
+				pluginManager,
+				stateRef,
+				startHeight,
+				maxBlocksPerCommit,
+				extensions::StateHashVerification::Disabled);
+	}
+
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			uint32_t maxBlocksPerCommit,
+			extensions::StateHashVerification stateHashVerification) {
+		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight, maxBlocksPerCommit, stateHashVerification);
 
 		utils::StackLogger logger("load block chain", utils::LogLevel::Warning);
 		utils::StackTimer stopwatch;
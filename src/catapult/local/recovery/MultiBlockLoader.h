@@ -24,7 +24,10 @@
 #include <functional>
 
 namespace catapult {
-	namespace extensions { struct LocalNodeStateRef; }
+	namespace extensions {
+		struct LocalNodeStateRef;
+		enum class StateHashVerification;
+	}
 	namespace model {
 		struct Block;
 		struct BlockChainConfiguration;
@@ -57,4 +60,26 @@ namespace catapult { namespace local {
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight);
+
+	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
+	/// and updating \a stateRef starting with the block at \a startHeight.
+	/// Cache changes are committed after at most \a maxBlocksPerCommit blocks.
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			uint32_t maxBlocksPerCommit);
+
+	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
+	/// and updating \a stateRef starting with the block at \a startHeight.
+	/// Cache changes are committed after at most \a maxBlocksPerCommit blocks.
+	/// When \a stateHashVerification is enabled, the state hash of the last block of each commit is checked before committing.
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			uint32_t maxBlocksPerCommit,
+			extensions::StateHashVerification stateHashVerification);
 }}
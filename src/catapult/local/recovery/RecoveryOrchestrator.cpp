@@ -26,12 +26,14 @@
 #include "RepairState.h"
 #include "StateChangeRepairingSubscriber.h"
 #include "StorageStart.h"
+#include "TrustedBlockImport.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/NemesisBlockLoader.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/FilesystemUtils.h"
@@ -145,8 +147,9 @@ namespace catapult { namespace local {
 				if (heights.Cache > heights.Storage)
 					CATAPULT_THROW_RUNTIME_ERROR_2("cache height is larger than storage height", heights.Cache, heights.Storage);
 
-				if (!stateRef().Config.Node.EnableCacheDatabaseStorage)
-					repairStateFromStorage(heights);
+				auto isImported = importTrustedBlocks(systemState.commitStep(), heights);
+				if (!stateRef().Config.Node.EnableCacheDatabaseStorage || isImported)
+					repairStateFromStorage(heights, isImported);
 
 				CATAPULT_LOG(info) << "loaded block chain (height = " << heights.Storage << ", score = " << m_score.get() << ")";
 
@@ -173,7 +176,33 @@ namespace catapult { namespace local {
 						readNextMessage);
 			}
 
-			void repairStateFromStorage(const extensions::StateHeights& heights) {
+			bool importTrustedBlocks(consumers::CommitOperationStep commitStep, extensions::StateHeights& heights) {
+				const auto& nodeConfig = stateRef().Config.Node;
+				auto importDirectory = m_dataDirectory.dir("import");
+				if (Height() == nodeConfig.TrustedCheckpointHeight || !boost::filesystem::exists(importDirectory.path()))
+					return false;
+
+				// only import into a consistent state
+				if (consumers::CommitOperationStep::All_Updated != commitStep || heights.Cache != heights.Storage) {
+					CATAPULT_LOG(warning) << "skipping import of trusted blocks because state is not consistent";
+					return false;
+				}
+
+				io::FileBlockStorage importStorage(importDirectory.str(), io::FileBlockStorageMode::None);
+				auto numImportedBlocks = ImportTrustedBlocks(
+						importStorage,
+						*m_pBlockStorage,
+						{ nodeConfig.TrustedCheckpointHeight, nodeConfig.TrustedCheckpointHash },
+						m_pluginManager.transactionRegistry(),
+						stateRef().Config.BlockChain.Network.GenerationHashSeed);
+				if (0 == numImportedBlocks)
+					return false;
+
+				heights.Storage = m_pBlockStorage->chainHeight();
+				return true;
+			}
+
+			void repairStateFromStorage(const extensions::StateHeights& heights, bool isImported) {
 				if (heights.Cache == heights.Storage)
 					return;
 
@@ -181,7 +210,18 @@ namespace catapult { namespace local {
 				// discontinuities in block analysis (e.g. statistic cache expects consecutive blocks)
 				CATAPULT_LOG(info) << "loading state - block loading required";
 				auto observerFactory = [&pluginManager = m_pluginManager](const auto&) { return pluginManager.createObserver(); };
-				auto partialScore = LoadBlockChain(observerFactory, m_pluginManager, stateRef(), heights.Cache + Height(1));
+
+				// imported blocks have never been executed locally, so their state hashes need to be checked when supported
+				auto stateHashVerification = isImported && stateRef().Config.BlockChain.EnableVerifiableState
+						? extensions::StateHashVerification::Enabled
+						: extensions::StateHashVerification::Disabled;
+				auto partialScore = LoadBlockChain(
+						observerFactory,
+						m_pluginManager,
+						stateRef(),
+						heights.Cache + Height(1),
+						stateRef().Config.Node.MaxBlocksPerRecoveryCommit,
+						stateHashVerification);
 				m_score += partialScore;
 			}
 
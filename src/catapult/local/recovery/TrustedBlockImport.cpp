@@ -0,0 +1,128 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TrustedBlockImport.h"
+#include "catapult/io/BlockStatementSerializer.h"
+#include "catapult/io/BlockStorage.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/model/BlockStatement.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
+
+namespace catapult { namespace local {
+
+	namespace {
+		void VerifyHashChain(
+				const io::BlockStorage& sourceStorage,
+				const Hash256& lastBlockHash,
+				Height startHeight,
+				const TrustedCheckpoint& checkpoint) {
+			// walk backwards from the checkpoint so that every block is authenticated by its (trusted) successor
+			auto expectedBlockHash = checkpoint.BlockHash;
+			for (auto height = checkpoint.Height; height >= startHeight; height = height - Height(1)) {
+				auto pBlock = sourceStorage.loadBlock(height);
+				auto blockHash = model::CalculateHash(*pBlock);
+				if (height != pBlock->Height || expectedBlockHash != blockHash) {
+					CATAPULT_LOG(error) << "block at " << height << " has unexpected hash " << blockHash;
+					CATAPULT_THROW_RUNTIME_ERROR_1("block does not link to trusted checkpoint", height);
+				}
+
+				expectedBlockHash = pBlock->PreviousBlockHash;
+			}
+
+			if (lastBlockHash != expectedBlockHash)
+				CATAPULT_THROW_RUNTIME_ERROR_1("trusted blocks do not link to local chain", startHeight - Height(1));
+		}
+
+		std::shared_ptr<const model::BlockStatement> LoadBlockStatement(const io::BlockStorage& storage, Height height) {
+			// statements are stored separately from block elements
+			auto blockStatementPair = storage.loadBlockStatementData(height);
+			if (!blockStatementPair.second)
+				return nullptr;
+
+			auto pBlockStatement = std::make_shared<model::BlockStatement>();
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> blockStatementStream(blockStatementPair.first);
+			io::ReadBlockStatement(blockStatementStream, *pBlockStatement);
+			return pBlockStatement;
+		}
+
+		model::BlockElement CreateVerifiedBlockElement(
+				const model::BlockElement& sourceBlockElement,
+				const std::shared_ptr<const model::BlockStatement>& pSourceBlockStatement,
+				const model::TransactionRegistry& transactionRegistry,
+				const GenerationHashSeed& generationHashSeed) {
+			const auto& block = sourceBlockElement.Block;
+			model::BlockElement blockElement(block);
+			blockElement.EntityHash = model::CalculateHash(block);
+			blockElement.GenerationHash = model::CalculateGenerationHash(block.GenerationHashProof.Gamma);
+			blockElement.SubCacheMerkleRoots = sourceBlockElement.SubCacheMerkleRoots;
+			blockElement.OptionalStatement = pSourceBlockStatement;
+
+			for (const auto& transaction : block.Transactions())
+				blockElement.Transactions.emplace_back(transaction);
+
+			model::UpdateHashes(transactionRegistry, generationHashSeed, blockElement.Transactions);
+
+			// transactions hash is part of the (already authenticated) block header
+			auto merkleTree = model::CalculateMerkleTree(blockElement.Transactions);
+			auto transactionsHash = merkleTree.empty() ? Hash256() : merkleTree.back();
+			if (block.TransactionsHash != transactionsHash)
+				CATAPULT_THROW_RUNTIME_ERROR_1("block has invalid transactions hash", block.Height);
+
+			// receipts hash is part of the (already authenticated) block header, but the imported statement is not
+			auto receiptsHash = blockElement.OptionalStatement ? model::CalculateMerkleHash(*blockElement.OptionalStatement) : Hash256();
+			if (block.ReceiptsHash != receiptsHash)
+				CATAPULT_THROW_RUNTIME_ERROR_1("block has invalid receipts hash", block.Height);
+
+			return blockElement;
+		}
+	}
+
+	size_t ImportTrustedBlocks(
+			const io::BlockStorage& sourceStorage,
+			io::BlockStorage& destinationStorage,
+			const TrustedCheckpoint& checkpoint,
+			const model::TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed) {
+		auto startHeight = destinationStorage.chainHeight() + Height(1);
+		if (checkpoint.Height < startHeight)
+			return 0;
+
+		if (sourceStorage.chainHeight() < checkpoint.Height)
+			CATAPULT_THROW_RUNTIME_ERROR_2("source storage is missing blocks", sourceStorage.chainHeight(), checkpoint.Height);
+
+		// verify the complete hash chain before saving any blocks
+		auto pLastBlockElement = destinationStorage.loadBlockElement(startHeight - Height(1));
+		VerifyHashChain(sourceStorage, pLastBlockElement->EntityHash, startHeight, checkpoint);
+
+		CATAPULT_LOG(info) << "importing trusted blocks " << startHeight << " - " << checkpoint.Height;
+		for (auto height = startHeight; height <= checkpoint.Height; height = height + Height(1)) {
+			auto pSourceBlockElement = sourceStorage.loadBlockElement(height);
+			auto pSourceBlockStatement = LoadBlockStatement(sourceStorage, height);
+			destinationStorage.saveBlock(CreateVerifiedBlockElement(
+					*pSourceBlockElement,
+					pSourceBlockStatement,
+					transactionRegistry,
+					generationHashSeed));
+		}
+
+		return static_cast<size_t>((checkpoint.Height - startHeight).unwrap() + 1);
+	}
+}}
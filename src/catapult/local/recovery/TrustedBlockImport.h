@@ -0,0 +1,52 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult {
+	namespace io { class BlockStorage; }
+	namespace model { class TransactionRegistry; }
+}
+
+namespace catapult { namespace local {
+
+	/// Trusted block chain checkpoint.
+	struct TrustedCheckpoint {
+		/// Height of the checkpoint block.
+		catapult::Height Height;
+
+		/// Hash of the checkpoint block.
+		Hash256 BlockHash;
+	};
+
+	/// Imports all blocks following the last block in \a destinationStorage up to and including the \a checkpoint block
+	/// from \a sourceStorage.
+	/// Block and transaction hashes are recalculated using \a transactionRegistry and \a generationHashSeed and
+	/// must link up to the checkpoint block hash. Transactions and statements must match the block transactions and receipts hashes.
+	/// Signatures are not verified.
+	/// Returns the number of imported blocks.
+	size_t ImportTrustedBlocks(
+			const io::BlockStorage& sourceStorage,
+			io::BlockStorage& destinationStorage,
+			const TrustedCheckpoint& checkpoint,
+			const model::TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed);
+}}
@@ -34,6 +34,7 @@
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
+#include "catapult/extensions/TransactionsSnapshotStorage.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/FileQueue.h"
 #include "catapult/ionet/NodeContainer.h"
@@ -159,6 +160,9 @@ namespace catapult { namespace local {
 				m_bannedNodeIdentitySink = serviceState.hooks().bannedNodeIdentitySink();
 				m_isBooted = true;
 
+				if (m_config.Node.EnableTransactionsCacheSnapshot)
+					loadUtCacheSnapshot(serviceState.hooks());
+
 				// save nemesis state on first boot so that state directory is created and NemesisBlockNotifier
 				// is always bypassed on subsequent boots
 				if (isFirstBoot)
@@ -217,12 +221,23 @@ namespace catapult { namespace local {
 				CATAPULT_LOG(info) << "loaded block chain (height = " << heights.Cache << ", score = " << m_score.get() << ")";
 			}
 
+			void loadUtCacheSnapshot(const extensions::ServerHooks& hooks) {
+				auto height = m_catapultCache.createView().height();
+				auto transactions = extensions::LoadTransactionsSnapshot(m_dataDirectory.rootDir().file("ut.dat"), height);
+				if (transactions.empty())
+					return;
+
+				// push the saved transactions through the dispatcher so that they are reverified before being readded to the cache
+				hooks.transactionRangeConsumerFactory()(disruptor::InputSource::Local)(std::move(transactions));
+			}
+
 		public:
 			void shutdown() override {
 				utils::StackLogger stackLogger("shutting down local node", utils::LogLevel::Info);
 
 				m_pBootstrapper->pool().shutdown();
 				saveStateToDisk();
+				saveUtCacheSnapshot();
 			}
 
 		private:
@@ -235,6 +250,20 @@ namespace catapult { namespace local {
 				SaveStateToDirectoryWithCheckpointing(m_dataDirectory, m_config.Node, m_catapultCache, m_score.get());
 			}
 
+			void saveUtCacheSnapshot() {
+				if (!m_isBooted || !m_config.Node.EnableTransactionsCacheSnapshot)
+					return;
+
+				std::vector<std::shared_ptr<const model::Transaction>> transactions;
+				m_pUtCache->view().forEach([&transactions](const auto& transactionInfo) {
+					transactions.push_back(transactionInfo.pEntity);
+					return true;
+				});
+
+				auto height = m_catapultCache.createView().height();
+				extensions::SaveTransactionsSnapshot(m_dataDirectory.rootDir().file("ut.dat"), height, transactions);
+			}
+
 		public:
 			const cache::CatapultCache& cache() const override {
 				return m_catapultCache;
@@ -23,6 +23,7 @@
 #include "TransactionPlugin.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/Sha3MultiBuffer.h"
 
 namespace catapult { namespace model {
 
@@ -63,6 +64,29 @@ namespace catapult { namespace model {
 		return CalculateHash(transaction, buffer, &generationHashSeed);
 	}
 
+	void CalculateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const Transaction* const* pTransactions,
+			Hash256* pHashes,
+			size_t count) {
+		// each message is composed of the same parts as in CalculateHash
+		constexpr size_t Num_Parts = 4;
+		std::vector<RawBuffer> dataBuffers;
+		dataBuffers.reserve(Num_Parts * count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& transaction = *pTransactions[i];
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+
+			dataBuffers.push_back(transaction.Signature);
+			dataBuffers.push_back(transaction.SignerPublicKey);
+			dataBuffers.push_back(generationHashSeed);
+			dataBuffers.push_back(plugin.dataBuffer(transaction));
+		}
+
+		crypto::Sha3_256MultiPart(dataBuffers.data(), Num_Parts, pHashes, count);
+	}
+
 	Hash256 CalculateMerkleComponentHash(
 			const Transaction& transaction,
 			const Hash256& transactionHash,
@@ -106,4 +130,27 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			TransactionElement* const* pTransactionElements,
+			size_t count) {
+		std::vector<const Transaction*> transactions;
+		transactions.reserve(count);
+		for (auto i = 0u; i < count; ++i)
+			transactions.push_back(&pTransactionElements[i]->Transaction);
+
+		std::vector<Hash256> entityHashes(count);
+		CalculateHashes(transactionRegistry, generationHashSeed, transactions.data(), entityHashes.data(), count);
+
+		for (auto i = 0u; i < count; ++i) {
+			auto& transactionElement = *pTransactionElements[i];
+			transactionElement.EntityHash = entityHashes[i];
+			transactionElement.MerkleComponentHash = CalculateMerkleComponentHash(
+					transactionElement.Transaction,
+					transactionElement.EntityHash,
+					transactionRegistry);
+		}
+	}
 }}
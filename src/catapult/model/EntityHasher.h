@@ -40,6 +40,16 @@ namespace catapult { namespace model {
 	/// generation hash seed (\a generationHashSeed).
 	Hash256 CalculateHash(const Transaction& transaction, const GenerationHashSeed& generationHashSeed, const RawBuffer& buffer);
 
+	/// Calculates the hashes for \a count transactions (\a pTransactions) into \a pHashes for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	/// \note Hashes are calculated concurrently using multi-buffer hashing.
+	void CalculateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const Transaction* const* pTransactions,
+			Hash256* pHashes,
+			size_t count);
+
 	/// Calculates the merkle component hash for the given \a transaction with \a transactionHash
 	/// using transaction information from \a transactionRegistry.
 	Hash256 CalculateMerkleComponentHash(
@@ -56,4 +66,27 @@ namespace catapult { namespace model {
 				const TransactionRegistry& transactionRegistry,
 				const GenerationHashSeed& generationHashSeed,
 				TransactionElement& transactionElement);
+
+	/// Calculates the hashes for \a count transaction elements (\a pTransactionElements) in place for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			TransactionElement* const* pTransactionElements,
+			size_t count);
+
+	/// Calculates the hashes for all \a transactionElements in place for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	template<typename TTransactionElement>
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			std::vector<TTransactionElement>& transactionElements) {
+		std::vector<TransactionElement*> transactionElementPointers;
+		transactionElementPointers.reserve(transactionElements.size());
+		for (auto& transactionElement : transactionElements)
+			transactionElementPointers.push_back(&transactionElement);
+
+		UpdateHashes(transactionRegistry, generationHashSeed, transactionElementPointers.data(), transactionElementPointers.size());
+	}
 }}
@@ -113,42 +113,47 @@ namespace catapult { namespace model {
 
 			SingleBufferRange(const uint8_t* pData, size_t dataSize, const std::vector<size_t>& offsets, uint8_t alignment)
 					: SubRange(CalculateTotalSize(dataSize, offsets, alignment))
-					, m_buffer(SubRange::totalSize()) {
+					, m_pBuffer(0 == SubRange::totalSize() ? nullptr : AllocateBuffer(SubRange::totalSize())) {
+				// buffers are uninitialized, so only zero the parts that are not overwritten with data
+				if (!pData && m_pBuffer)
+					std::memset(m_pBuffer.get(), 0, SubRange::totalSize());
+
 				size_t totalPadding = 0;
 				for (auto i = 0u; i < offsets.size(); ++i) {
 					auto offset = offsets[i];
-					auto* pDest = &m_buffer[offset + totalPadding - offsets[0]];
+					auto* pDest = m_pBuffer.get() + offset + totalPadding - offsets[0];
 					SubRange::entities().push_back(reinterpret_cast<TEntity*>(pDest));
 
 					auto size = (i == offsets.size() - 1 ? dataSize : offsets[i + 1]) - offset;
-					if (pData)
+					auto paddingSize = i == offsets.size() - 1 ? 0 : utils::GetPaddingSize(size, alignment);
+					if (pData) {
 						std::memcpy(pDest, &pData[offset], size);
+						std::memset(pDest + size, 0, paddingSize);
+					}
 
-					totalPadding += utils::GetPaddingSize(size, alignment);
+					totalPadding += paddingSize;
 				}
 			}
 
 		public:
 			uint8_t* data() {
-				return m_buffer.data();
+				return m_pBuffer.get();
 			}
 
 		private:
 			const uint8_t* data() const {
-				return m_buffer.data();
+				return m_pBuffer.get();
 			}
 
 		public:
 			std::vector<std::shared_ptr<TEntity>> detachEntities() {
 				std::vector<std::shared_ptr<TEntity>> entities(SubRange::size());
-				auto offsets = generateOffsets();
-				auto pBufferShared = std::make_shared<decltype(m_buffer)>(std::move(m_buffer));
+				auto pBuffer = std::move(m_pBuffer);
 
+				// entities share ownership of the (exact size) buffer, so no per entity allocations or copies are required
 				size_t i = 0;
-				for (auto offset : offsets) {
-					auto pEntity = reinterpret_cast<TEntity*>(&(*pBufferShared)[offset]);
-					entities[i++] = std::shared_ptr<TEntity>(pEntity, [pBufferShared](const auto*) {});
-				}
+				for (auto* pEntity : SubRange::entities())
+					entities[i++] = std::shared_ptr<TEntity>(pBuffer, pEntity);
 
 				return entities;
 			}
@@ -169,6 +174,10 @@ namespace catapult { namespace model {
 			}
 
 		private:
+			static std::shared_ptr<uint8_t> AllocateBuffer(size_t size) {
+				return std::shared_ptr<uint8_t>(new uint8_t[size], std::default_delete<uint8_t[]>());
+			}
+
 			static size_t CalculateTotalSize(size_t dataSize, const std::vector<size_t>& offsets, uint8_t alignment) {
 				// this works because last entity is *not* padded
 				if (1 != alignment) {
@@ -182,7 +191,7 @@ namespace catapult { namespace model {
 			}
 
 		private:
-			std::vector<uint8_t> m_buffer;
+			std::shared_ptr<uint8_t> m_pBuffer;
 		};
 
 		// endregion
@@ -27,42 +27,26 @@
 
 namespace catapult { namespace model {
 
-	namespace {
-		class AddressCollector : public NotificationSubscriber {
-		public:
-			explicit AddressCollector(NetworkIdentifier networkIdentifier) : m_networkIdentifier(networkIdentifier)
-			{}
-
-		public:
-			void notify(const Notification& notification) override {
-				if (Core_Register_Account_Address_Notification == notification.Type)
-					m_addresses.insert(static_cast<const AccountAddressNotification&>(notification).Address.unresolved());
-				else if (Core_Register_Account_Public_Key_Notification == notification.Type)
-					m_addresses.insert(toAddress(static_cast<const AccountPublicKeyNotification&>(notification).PublicKey));
-			}
-
-		public:
-			const UnresolvedAddressSet& addresses() const {
-				return m_addresses;
-			}
-
-		private:
-			UnresolvedAddress toAddress(const Key& publicKey) const {
-				auto resolvedAddress = PublicKeyToAddress(publicKey, m_networkIdentifier);
-				return resolvedAddress.copyTo<UnresolvedAddress>();
-			}
-
-		private:
-			NetworkIdentifier m_networkIdentifier;
-			UnresolvedAddressSet m_addresses;
-		};
+	AddressCollector::AddressCollector(NetworkIdentifier networkIdentifier, UnresolvedAddressSet& addresses)
+			: m_networkIdentifier(networkIdentifier)
+			, m_addresses(addresses)
+	{}
+
+	void AddressCollector::notify(const Notification& notification) {
+		if (Core_Register_Account_Address_Notification == notification.Type) {
+			m_addresses.insert(static_cast<const AccountAddressNotification&>(notification).Address.unresolved());
+		} else if (Core_Register_Account_Public_Key_Notification == notification.Type) {
+			const auto& publicKey = static_cast<const AccountPublicKeyNotification&>(notification).PublicKey;
+			m_addresses.insert(PublicKeyToAddress(publicKey, m_networkIdentifier).copyTo<UnresolvedAddress>());
+		}
 	}
 
 	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
 		Hash256 transactionHash;
 		WeakEntityInfo weakInfo(transaction, transactionHash);
-		AddressCollector sub(NetworkIdentifier(weakInfo.entity().Network));
+		UnresolvedAddressSet addresses;
+		AddressCollector sub(weakInfo.entity().Network, addresses);
 		notificationPublisher.publish(weakInfo, sub);
-		return sub.addresses();
+		return addresses;
 	}
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "ContainerTypes.h"
+#include "NotificationSubscriber.h"
 
 namespace catapult {
 	namespace model {
@@ -30,6 +31,20 @@ namespace catapult {
 
 namespace catapult { namespace model {
 
+	/// Notification subscriber that collects the addresses of all accounts registered by notifications.
+	class AddressCollector : public NotificationSubscriber {
+	public:
+		/// Creates a collector that adds all addresses (on the network identified by \a networkIdentifier) to \a addresses.
+		AddressCollector(NetworkIdentifier networkIdentifier, UnresolvedAddressSet& addresses);
+
+	public:
+		void notify(const Notification& notification) override;
+
+	private:
+		NetworkIdentifier m_networkIdentifier;
+		UnresolvedAddressSet& m_addresses;
+	};
+
 	/// Extracts all addresses that are involved in \a transaction using \a notificationPublisher.
 	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher);
 }}
@@ -37,11 +37,14 @@ namespace catapult { namespace state {
 	AccountBalances::AccountBalances(AccountBalances&& accountBalances) = default;
 
 	AccountBalances& AccountBalances::operator=(const AccountBalances& accountBalances) {
-		m_optimizedMosaicId = accountBalances.optimizedMosaicId();
-		m_balances.optimize(m_optimizedMosaicId);
+		// copy into a new map because this instance might already contain balances (e.g. when assigned in place by deltaset commit)
+		CompactMosaicMap balances;
+		balances.optimize(accountBalances.optimizedMosaicId());
 		for (const auto& pair : accountBalances)
-			m_balances.insert(pair);
+			balances.insert(pair);
 
+		m_balances = std::move(balances);
+		m_optimizedMosaicId = accountBalances.optimizedMosaicId();
 		return *this;
 	}
 
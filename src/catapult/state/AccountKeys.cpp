@@ -28,22 +28,13 @@ namespace catapult { namespace state {
 	AccountKeys::KeyAccessor<TAccountPublicKey>::KeyAccessor() = default;
 
 	template<typename TAccountPublicKey>
-	AccountKeys::KeyAccessor<TAccountPublicKey>::KeyAccessor(const KeyAccessor& keyAccessor) {
-		*this = keyAccessor;
-	}
+	AccountKeys::KeyAccessor<TAccountPublicKey>::KeyAccessor(const KeyAccessor&) = default;
 
 	template<typename TAccountPublicKey>
 	AccountKeys::KeyAccessor<TAccountPublicKey>::KeyAccessor(KeyAccessor&&) = default;
 
 	template<typename TAccountPublicKey>
-	AccountKeys::KeyAccessor<TAccountPublicKey>& AccountKeys::KeyAccessor<TAccountPublicKey>::operator=(const KeyAccessor& keyAccessor) {
-		if (keyAccessor.m_pKey)
-			m_pKey = std::make_shared<TAccountPublicKey>(*keyAccessor.m_pKey);
-		else
-			m_pKey.reset();
-
-		return *this;
-	}
+	AccountKeys::KeyAccessor<TAccountPublicKey>& AccountKeys::KeyAccessor<TAccountPublicKey>::operator=(const KeyAccessor&) = default;
 
 	template<typename TAccountPublicKey>
 	AccountKeys::KeyAccessor<TAccountPublicKey>& AccountKeys::KeyAccessor<TAccountPublicKey>::operator=(KeyAccessor&&) = default;
@@ -63,6 +54,7 @@ namespace catapult { namespace state {
 		if (m_pKey)
 			CATAPULT_THROW_INVALID_ARGUMENT("must call unset before resetting key with value");
 
+		// always allocate a new key because the current one might be shared with copies
 		m_pKey = std::make_shared<TAccountPublicKey>(key);
 	}
 
@@ -57,20 +57,21 @@ namespace catapult { namespace state {
 		// region KeyAccessor
 
 		/// Key accessor.
+		/// \note Underlying keys are immutable, so copies share them.
 		template<typename TAccountPublicKey>
 		class KeyAccessor {
 		public:
 			/// Creates unset key.
 			KeyAccessor();
 
-			/// Copy constructor that makes a deep copy of \a keyAccessor.
+			/// Copy constructor that makes a shallow copy of \a keyAccessor.
 			KeyAccessor(const KeyAccessor& keyAccessor);
 
 			/// Move constructor that move constructs a key accessor from \a keyAccessor.
 			KeyAccessor(KeyAccessor&& keyAccessor);
 
 		public:
-			/// Assignment operator that makes a deep copy of \a keyAccessor.
+			/// Assignment operator that makes a shallow copy of \a keyAccessor.
 			KeyAccessor& operator=(const KeyAccessor& keyAccessor);
 
 			/// Move assignment operator that assigns \a keyAccessor.
@@ -22,10 +22,13 @@
 #include "catapult/constants.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
+#include <atomic>
+#include <memory>
 
 namespace catapult { namespace state {
 
 	/// Compact array-based stack that allocates memory dynamically only when it is not empty.
+	/// \note Copies share the underlying memory until either one is modified (copy-on-write).
 	template<typename T, size_t N>
 	class CompactArrayStack {
 	public:
@@ -109,10 +112,11 @@ namespace catapult { namespace state {
 		CompactArrayStack() : m_size(0)
 		{}
 
-		/// Copy constructor that makes a deep copy of \a stack.
-		CompactArrayStack(const CompactArrayStack& stack) {
-			*this = stack;
-		}
+		/// Copy constructor that makes a shallow copy of \a stack.
+		CompactArrayStack(const CompactArrayStack& stack)
+				: m_pArray(stack.m_pArray)
+				, m_size(stack.m_size)
+		{}
 
 		/// Move constructor that move constructs a stack from \a stack.
 		CompactArrayStack(CompactArrayStack&& stack)
@@ -122,11 +126,9 @@ namespace catapult { namespace state {
 		}
 
 	public:
-		/// Assignment operator that makes a deep copy of \a stack.
+		/// Assignment operator that makes a shallow copy of \a stack.
 		CompactArrayStack& operator=(const CompactArrayStack& stack) {
-			if (stack.m_pArray)
-				m_pArray = std::make_unique<std::array<T, N>>(*stack.m_pArray);
-
+			m_pArray = stack.m_pArray;
 			m_size = stack.m_size;
 			return *this;
 		}
@@ -170,24 +172,31 @@ namespace catapult { namespace state {
 			if (0 == m_size)
 				CATAPULT_THROW_OUT_OF_RANGE("cannot peek when empty");
 
+			detach();
 			return m_pArray->front();
 		}
 
 	public:
 		/// Pushes \a value onto the stack.
 		void push(const T& value) {
+			if (m_pArray)
+				detach();
+			else
+				m_pArray = std::make_shared<std::array<T, N>>();
+
 			shiftRight();
 			if (m_size < N)
 				++m_size;
 
-			if (!m_pArray)
-				m_pArray = std::make_unique<std::array<T, N>>();
-
 			m_pArray->front() = value;
 		}
 
 		/// Pops the top value from the stack.
 		void pop() {
+			if (!m_pArray)
+				CATAPULT_THROW_OUT_OF_RANGE("cannot pop when empty");
+
+			detach();
 			shiftLeft();
 			m_pArray->back() = T();
 			--m_size;
@@ -197,26 +206,30 @@ namespace catapult { namespace state {
 		}
 
 	private:
-		void shiftLeft() {
-			if (!m_pArray)
-				CATAPULT_THROW_OUT_OF_RANGE("cannot pop when empty");
+		void detach() {
+			if (1 == m_pArray.use_count()) {
+				// synchronize with the release of any other (now destroyed) copy before modifying the memory in place
+				std::atomic_thread_fence(std::memory_order_acquire);
+				return;
+			}
+
+			m_pArray = std::make_shared<std::array<T, N>>(*m_pArray);
+		}
 
+		void shiftLeft() {
 			auto& array = *m_pArray;
 			for (auto i = 0u; i < array.size() - 1; ++i)
 				array[i] = array[i + 1];
 		}
 
 		void shiftRight() {
-			if (!m_pArray)
-				return;
-
 			auto& array = *m_pArray;
 			for (auto i = array.size() - 1; i > 0; --i)
 				array[i] = array[i - 1];
 		}
 
 	private:
-		std::unique_ptr<std::array<T, N>> m_pArray;
+		std::shared_ptr<std::array<T, N>> m_pArray;
 		size_t m_size;
 	};
 }}
@@ -35,6 +35,10 @@ namespace catapult { namespace subscribers {
 			this->forEach([&blockElement](auto& subscriber) { subscriber.notifyBlock(blockElement); });
 		}
 
+		void notifyBlocks(const std::vector<model::BlockElement>& blockElements) override {
+			this->forEach([&blockElements](auto& subscriber) { subscriber.notifyBlocks(blockElements); });
+		}
+
 		void notifyDropBlocksAfter(Height height) override {
 			this->forEach([height](auto& subscriber) { subscriber.notifyDropBlocksAfter(height); });
 		}
@@ -30,7 +30,7 @@
 namespace catapult { namespace subscribers {
 
 	namespace {
-		void ReadAndNotifyBlock(io::InputStream& inputStream, io::BlockChangeSubscriber& subscriber) {
+		std::shared_ptr<model::BlockElement> ReadBlock(io::InputStream& inputStream) {
 			auto pBlockElement = io::ReadBlockElement(inputStream);
 			if (0 != io::Read8(inputStream)) {
 				auto pStatement = std::make_shared<model::BlockStatement>();
@@ -38,7 +38,11 @@ namespace catapult { namespace subscribers {
 				pBlockElement->OptionalStatement = pStatement;
 			}
 
-			subscriber.notifyBlock(*pBlockElement);
+			return pBlockElement;
+		}
+
+		void ReadAndNotifyBlock(io::InputStream& inputStream, io::BlockChangeSubscriber& subscriber) {
+			subscriber.notifyBlock(*ReadBlock(inputStream));
 		}
 
 		void ReadAndNotifyDropBlocksAfter(io::InputStream& inputStream, io::BlockChangeSubscriber& subscriber) {
@@ -59,4 +63,58 @@ namespace catapult { namespace subscribers {
 
 		CATAPULT_THROW_INVALID_ARGUMENT_1("invalid block change operation type", static_cast<uint16_t>(operationType));
 	}
+
+	namespace {
+		class BlockChangeBatcher {
+		public:
+			explicit BlockChangeBatcher(io::BlockChangeSubscriber& subscriber) : m_subscriber(subscriber)
+			{}
+
+		public:
+			void add(const std::shared_ptr<model::BlockElement>& pBlockElement) {
+				// only consecutive blocks can be forwarded together
+				if (!m_blockElements.empty() && m_blockElements.back().Block.Height + Height(1) != pBlockElement->Block.Height)
+					flush();
+
+				m_blockElementOwners.push_back(pBlockElement);
+				m_blockElements.push_back(*pBlockElement);
+			}
+
+			void flush() {
+				if (m_blockElements.empty())
+					return;
+
+				m_subscriber.notifyBlocks(m_blockElements);
+				m_blockElements.clear();
+				m_blockElementOwners.clear();
+			}
+
+		private:
+			io::BlockChangeSubscriber& m_subscriber;
+			std::vector<std::shared_ptr<model::BlockElement>> m_blockElementOwners;
+			std::vector<model::BlockElement> m_blockElements;
+		};
+	}
+
+	void ReadAllBlockChanges(io::InputStream& inputStream, io::BlockChangeSubscriber& subscriber) {
+		BlockChangeBatcher batcher(subscriber);
+		while (!inputStream.eof()) {
+			auto operationType = static_cast<BlockChangeOperationType>(io::Read8(inputStream));
+
+			switch (operationType) {
+			case BlockChangeOperationType::Block:
+				batcher.add(ReadBlock(inputStream));
+				continue;
+			case BlockChangeOperationType::Drop_Blocks_After:
+				// preserve ordering by forwarding all preceding blocks before the drop
+				batcher.flush();
+				ReadAndNotifyDropBlocksAfter(inputStream, subscriber);
+				continue;
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid block change operation type", static_cast<uint16_t>(operationType));
+		}
+
+		batcher.flush();
+	}
 }}
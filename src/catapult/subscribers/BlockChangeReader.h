@@ -31,4 +31,8 @@ namespace catapult { namespace subscribers {
 
 	/// Reads next block change from \a inputStream and forwards it to \a subscriber.
 	void ReadNextBlockChange(io::InputStream& inputStream, io::BlockChangeSubscriber& subscriber);
+
+	/// Reads all block changes from \a inputStream and forwards them to \a subscriber.
+	/// \note Runs of consecutive blocks are forwarded together via a single call to notifyBlocks.
+	void ReadAllBlockChanges(io::InputStream& inputStream, io::BlockChangeSubscriber& subscriber);
 }}
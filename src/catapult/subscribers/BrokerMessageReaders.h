@@ -65,6 +65,21 @@ namespace catapult { namespace subscribers {
 		}
 	}
 
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage
+	/// by reading at most \a maxBatchSize queued messages at once.
+	/// \note Each message is decoded from its own buffer and \a subscriber is flushed before the message is removed,
+	///       so a failure only causes the failing message to be read again.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(io::FileQueueReader& reader, size_t maxBatchSize, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		bool shouldContinue = true;
+		while (shouldContinue) {
+			shouldContinue = 0 != reader.tryReadNextMessages(maxBatchSize, [&subscriber, readNextMessage](const auto& buffer) {
+				io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+				ReadAll(inputStream, subscriber, readNextMessage);
+			});
+		}
+	}
+
 	/// Describes a message queue.
 	struct MessageQueueDescriptor {
 		/// Path of the message queue.
@@ -77,9 +92,10 @@ namespace catapult { namespace subscribers {
 		std::string IndexWriterFilename;
 	};
 
-	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage
+	/// by reading at most \a maxBatchSize queued messages at once.
 	template<typename TSubscriber, typename TMessageReader>
-	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
+	void ReadAll(const MessageQueueDescriptor& descriptor, size_t maxBatchSize, TSubscriber& subscriber, TMessageReader readNextMessage) {
 		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
 
 		auto numPendingMessages = reader.pending();
@@ -87,6 +103,12 @@ namespace catapult { namespace subscribers {
 			return;
 
 		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
-		subscribers::ReadAll(reader, subscriber, readNextMessage);
+		subscribers::ReadAll(reader, maxBatchSize, subscriber, readNextMessage);
+	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		ReadAll(descriptor, 1, subscriber, readNextMessage);
 	}
 }}
@@ -21,18 +21,15 @@
 #pragma once
 #include "Future.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 namespace catapult { namespace thread {
 
-	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
-	/// Future is returned that is resolved when all items have been processed.
-	template<typename TItems, typename TWorkCallback>
-	thread::future<bool> ParallelForPartition(
-			boost::asio::io_context& ioContext,
-			TItems& items,
-			size_t numPartitions,
-			TWorkCallback callback) {
+	namespace detail {
 		// region ParallelContext
+
 		class ParallelContext {
 		public:
 			ParallelContext() : m_numOutstandingOperations(1) // note that the work partitioning is the initial operation
@@ -79,8 +76,40 @@ namespace catapult { namespace thread {
 
 		// endregion
 
-		auto pParallelContext = std::make_shared<ParallelContext>();
-		DecrementGuard mainOperationGuard(*pParallelContext);
+		// region DynamicParallelContext
+
+		class DynamicParallelContext : public ParallelContext {
+		public:
+			DynamicParallelContext() : m_nextIndex(0), m_isStopped(false)
+			{}
+
+		public:
+			size_t claim(size_t numItems) {
+				return m_isStopped ? std::numeric_limits<size_t>::max() : m_nextIndex.fetch_add(numItems);
+			}
+
+			void stop() {
+				m_isStopped = true;
+			}
+
+		private:
+			std::atomic<size_t> m_nextIndex;
+			std::atomic<bool> m_isStopped;
+		};
+
+		// endregion
+	}
+
+	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each partition.
+	/// Future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForPartition(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		auto pParallelContext = std::make_shared<detail::ParallelContext>();
+		detail::DecrementGuard mainOperationGuard(*pParallelContext);
 
 		auto numRemainingPartitions = numPartitions;
 		auto numTotalItems = items.size();
@@ -100,7 +129,7 @@ namespace catapult { namespace thread {
 			auto startIndex = numTotalItems - numRemainingItems;
 			auto batchIndex = numPartitions - numRemainingPartitions;
 			boost::asio::post(ioContext, [callback, pParallelContext, itBegin, itEnd, startIndex, batchIndex]() {
-				DecrementGuard threadOperationGuard(*pParallelContext);
+				detail::DecrementGuard threadOperationGuard(*pParallelContext);
 				callback(itBegin, itEnd, startIndex, batchIndex);
 			});
 
@@ -124,4 +153,47 @@ namespace catapult { namespace thread {
 			}
 		});
 	}
+
+	/// Uses \a ioContext to process \a items on (at most) \a numWorkers workers and calls \a callback for each item.
+	/// Each worker repeatedly claims the next batch of (at most) \a batchSize unprocessed items, so workers that are assigned
+	/// cheap items process more batches than workers that are assigned expensive ones.
+	/// Future is returned that is resolved when all items have been processed.
+	/// \note No new batches are claimed after \a callback returns \c false for any item.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForDynamic(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numWorkers,
+			size_t batchSize,
+			TWorkCallback callback) {
+		auto pParallelContext = std::make_shared<detail::DynamicParallelContext>();
+		detail::DecrementGuard mainOperationGuard(*pParallelContext);
+
+		auto numItems = items.size();
+		batchSize = std::max<size_t>(1, batchSize);
+		numWorkers = std::min(numWorkers, (numItems + batchSize - 1) / batchSize);
+		for (auto i = 0u; i < numWorkers; ++i) {
+			// each thread captures pParallelContext by value, which keeps that object alive
+			pParallelContext->incrementOutstandingOperations();
+			boost::asio::post(ioContext, [callback, pParallelContext, itBegin = items.begin(), numItems, batchSize]() {
+				detail::DecrementGuard threadOperationGuard(*pParallelContext);
+				for (;;) {
+					auto startIndex = pParallelContext->claim(batchSize);
+					if (startIndex >= numItems)
+						return;
+
+					auto endIndex = std::min(startIndex + batchSize, numItems);
+					for (auto index = startIndex; index < endIndex; ++index) {
+						using DifferenceType = typename std::iterator_traits<decltype(itBegin)>::difference_type;
+						if (!callback(itBegin[static_cast<DifferenceType>(index)], index)) {
+							pParallelContext->stop();
+							return;
+						}
+					}
+				}
+			});
+		}
+
+		return pParallelContext->future();
+	}
 }}
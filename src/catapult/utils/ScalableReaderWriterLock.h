@@ -0,0 +1,256 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "SpinReaderWriterLock.h"
+#include <array>
+
+namespace catapult { namespace utils {
+
+	/// Custom reader writer lock that allows multiple readers and a single writer and prefers writers.
+	/// Readers are counted in cache line aligned slots that are distributed across threads so that concurrent readers
+	/// do not contend on a single shared atomic.
+	/// \note
+	/// - readers only write to their own slot, so reader acquisition and release scale with the number of cores
+	/// - writers need to scan all reader slots, so writer acquisition is more expensive than with SpinReaderWriterLock
+	/// - lock guards do not allocate
+	template<typename TReaderNotificationPolicy>
+	class BasicScalableReaderWriterLock : private TReaderNotificationPolicy {
+	private:
+		// 0[active writer]|1234567...[total writers]
+		static constexpr uint32_t Active_Writer_Flag = 0x8000'0000;
+		static constexpr uint32_t Pending_Writer_Mask = 0x7FFF'FFFF;
+
+		static constexpr size_t Num_Reader_Slots = 16;
+		static constexpr size_t Cache_Line_Size = 64;
+
+		struct alignas(Cache_Line_Size) ReaderSlot {
+			std::atomic<uint32_t> NumReaders;
+		};
+
+		using ReaderSlots = std::array<ReaderSlot, Num_Reader_Slots>;
+
+	private:
+#pragma push_macro("Yield")
+#undef Yield
+		static void Yield() {
+			std::this_thread::yield();
+		}
+#pragma pop_macro("Yield")
+
+	public:
+		// region WriterLockGuard
+
+		/// RAII writer lock guard.
+		class WriterLockGuard {
+		public:
+			/// Creates a guard around \a lock.
+			explicit WriterLockGuard(BasicScalableReaderWriterLock& lock) : WriterLockGuard(lock, nullptr, nullptr)
+			{}
+
+			/// Creates a guard around \a lock, the reader slot (\a pReaderSlot) and \a pIsActive of the promoted reader.
+			/// \note This constructor is used when writer is created by promotion.
+			WriterLockGuard(BasicScalableReaderWriterLock& lock, ReaderSlot* pReaderSlot, bool* pIsActive)
+					: m_pLock(&lock)
+					, m_pReaderSlot(pReaderSlot)
+					, m_pIsActive(pIsActive)
+			{}
+
+			~WriterLockGuard() {
+				if (!m_pLock)
+					return;
+
+				// change the writer back to a reader (when promoted) and unset the active writer flag
+				m_pLock->releaseWriter(m_pReaderSlot);
+				if (m_pIsActive)
+					*m_pIsActive = false;
+			}
+
+			/// Move constructor.
+			WriterLockGuard(WriterLockGuard&& rhs)
+					: m_pLock(rhs.m_pLock)
+					, m_pReaderSlot(rhs.m_pReaderSlot)
+					, m_pIsActive(rhs.m_pIsActive) {
+				rhs.m_pLock = nullptr;
+			}
+
+		private:
+			BasicScalableReaderWriterLock* m_pLock;
+			ReaderSlot* m_pReaderSlot;
+			bool* m_pIsActive;
+		};
+
+		// endregion
+
+		// region ReaderLockGuard
+
+		/// RAII reader lock guard.
+		class ReaderLockGuard {
+		public:
+			/// Creates a guard around \a lock and the acquired reader slot (\a readerSlot).
+			ReaderLockGuard(BasicScalableReaderWriterLock& lock, ReaderSlot& readerSlot)
+					: m_pLock(&lock)
+					, m_pReaderSlot(&readerSlot)
+					, m_isWriterActive(false) {
+				m_pLock->readerAcquired();
+			}
+
+			~ReaderLockGuard() {
+				if (!m_pLock)
+					return;
+
+				// decrease the number of readers by one
+				m_pReaderSlot->NumReaders.fetch_sub(1);
+				m_pLock->readerReleased();
+			}
+
+			/// Move constructor.
+			ReaderLockGuard(ReaderLockGuard&& rhs)
+					: m_pLock(rhs.m_pLock)
+					, m_pReaderSlot(rhs.m_pReaderSlot)
+					, m_isWriterActive(rhs.m_isWriterActive) {
+				rhs.m_pLock = nullptr;
+			}
+
+		public:
+			/// Promotes this reader lock to a writer lock.
+			/// \note Deadlock is possible when promoteToWriter is called concurrently by multiple threads for the same lock.
+			///       Each of the concurrent threads holds a reader lock, so a writer lock cannot be acquired by any thread.
+			WriterLockGuard promoteToWriter() {
+				if (m_isWriterActive)
+					CATAPULT_THROW_RUNTIME_ERROR("reader lock has already been promoted");
+
+				m_isWriterActive = true;
+
+				// mark a pending write before releasing the reader so that no new readers can be acquired in between
+				m_pLock->m_writerState.fetch_add(1);
+				m_pReaderSlot->NumReaders.fetch_sub(1);
+
+				// wait for exclusive access
+				m_pLock->acquireActiveWriter();
+				return WriterLockGuard(*m_pLock, m_pReaderSlot, &m_isWriterActive);
+			}
+
+		private:
+			BasicScalableReaderWriterLock* m_pLock;
+			ReaderSlot* m_pReaderSlot;
+			bool m_isWriterActive;
+		};
+
+		// endregion
+
+	public:
+		/// Creates an unlocked lock.
+		BasicScalableReaderWriterLock() : m_writerState(0) {
+			for (auto& readerSlot : m_readerSlots)
+				readerSlot.NumReaders = 0;
+		}
+
+	public:
+		/// Returns \c true if there is a pending (or active) writer.
+		inline bool isWriterPending() const {
+			return 0 != (m_writerState & Pending_Writer_Mask);
+		}
+
+		/// Returns \c true if there is an active writer.
+		inline bool isWriterActive() const {
+			return 0 != (m_writerState & Active_Writer_Flag);
+		}
+
+		/// Returns \c true if there is an active reader.
+		inline bool isReaderActive() const {
+			for (const auto& readerSlot : m_readerSlots) {
+				if (0 != readerSlot.NumReaders)
+					return true;
+			}
+
+			return false;
+		}
+
+	public:
+		/// Blocks until a reader lock can be acquired.
+		inline ReaderLockGuard acquireReader() {
+			auto& readerSlot = selectReaderSlot();
+			for (;;) {
+				// wait for any pending writes to complete
+				while (isWriterPending())
+					Yield();
+
+				// optimistically increment the number of readers by one and back off if a write became pending in the meantime
+				// (all operations are sequentially consistent, so either this reader or the writer observes the other)
+				readerSlot.NumReaders.fetch_add(1);
+				if (!isWriterPending())
+					break;
+
+				readerSlot.NumReaders.fetch_sub(1);
+			}
+
+			return ReaderLockGuard(*this, readerSlot);
+		}
+
+		/// Blocks until a writer lock can be acquired.
+		inline WriterLockGuard acquireWriter() {
+			// mark a pending write
+			m_writerState.fetch_add(1);
+
+			// wait for exclusive access
+			acquireActiveWriter();
+			return WriterLockGuard(*this);
+		}
+
+	private:
+		ReaderSlot& selectReaderSlot() {
+			// assign slots to threads round robin so that (up to Num_Reader_Slots) concurrent readers use distinct cache lines
+			static std::atomic<uint32_t> nextSlotIndex(0);
+			thread_local auto slotIndex = nextSlotIndex++ % Num_Reader_Slots;
+			return m_readerSlots[slotIndex];
+		}
+
+		void acquireActiveWriter() {
+			for (;;) {
+				// wait for all readers to drain (no new readers can be acquired because a write is pending)
+				while (isReaderActive())
+					Yield();
+
+				// wait for exclusive access (when there is no active writer)
+				uint32_t expected = m_writerState & Pending_Writer_Mask;
+				if (m_writerState.compare_exchange_strong(expected, expected | Active_Writer_Flag))
+					break;
+
+				Yield();
+			}
+		}
+
+		void releaseWriter(ReaderSlot* pReaderSlot) {
+			// a promoted writer is changed back to a reader before the active writer flag is unset
+			if (pReaderSlot)
+				pReaderSlot->NumReaders.fetch_add(1);
+
+			m_writerState.fetch_sub(Active_Writer_Flag + 1);
+		}
+
+	private:
+		std::atomic<uint32_t> m_writerState;
+		ReaderSlots m_readerSlots;
+	};
+
+	/// Default scalable reader writer lock.
+	using ScalableReaderWriterLock = BasicScalableReaderWriterLock<DefaultReaderNotificationPolicy>;
+}}
@@ -0,0 +1,195 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashSketch.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		using Cell = ShortHashSketch::Cell;
+		constexpr auto Num_Hash_Functions = ShortHashSketch::Num_Hash_Functions;
+
+		uint32_t Mix(uint32_t value) {
+			// murmur3 32-bit finalizer
+			value ^= value >> 16;
+			value *= 0x85EBCA6B;
+			value ^= value >> 13;
+			value *= 0xC2B2AE35;
+			value ^= value >> 16;
+			return value;
+		}
+
+		uint32_t CalculateCheckSum(uint32_t key) {
+			return Mix(key ^ 0x5BD1E995);
+		}
+
+		size_t CalculateIndex(uint32_t key, size_t hashIndex, size_t subtableSize) {
+			// each hash function maps into its own subtable so that a short hash is always mapped to distinct cells
+			auto seed = static_cast<uint32_t>(hashIndex + 1) * 0x9E3779B9;
+			return hashIndex * subtableSize + Mix(key + seed) % subtableSize;
+		}
+
+		// counts can be supplied by remote nodes, so use (wrapping) unsigned arithmetic to avoid signed overflow
+
+		int32_t AddCounts(int32_t lhs, int32_t rhs) {
+			return static_cast<int32_t>(static_cast<uint32_t>(lhs) + static_cast<uint32_t>(rhs));
+		}
+
+		int32_t SubtractCounts(int32_t lhs, int32_t rhs) {
+			return static_cast<int32_t>(static_cast<uint32_t>(lhs) - static_cast<uint32_t>(rhs));
+		}
+
+		void Update(std::vector<Cell>& cells, uint32_t key, int32_t delta) {
+			auto checkSum = CalculateCheckSum(key);
+			auto subtableSize = cells.size() / Num_Hash_Functions;
+			for (auto i = 0u; i < Num_Hash_Functions; ++i) {
+				auto& cell = cells[CalculateIndex(key, i, subtableSize)];
+				cell.Count = AddCounts(cell.Count, delta);
+				cell.KeySum ^= key;
+				cell.CheckSum ^= checkSum;
+			}
+		}
+
+		bool IsPure(const Cell& cell) {
+			return (1 == cell.Count || -1 == cell.Count) && CalculateCheckSum(cell.KeySum) == cell.CheckSum;
+		}
+
+		bool IsPeelable(const std::vector<Cell>& cells, size_t index, size_t subtableSize) {
+			// a pure cell can only be peeled when it is one of the cells its key is mapped to
+			const auto& cell = cells[index];
+			return IsPure(cell) && index == CalculateIndex(cell.KeySum, index / subtableSize, subtableSize);
+		}
+
+		bool IsEmpty(const Cell& cell) {
+			return 0 == cell.Count && 0 == cell.KeySum && 0 == cell.CheckSum;
+		}
+	}
+
+	size_t ShortHashSketch::CalculateRemoteSize(size_t numCells) {
+		size_t subtableSize = 1;
+		while (subtableSize * Num_Hash_Functions < numCells)
+			subtableSize <<= 1;
+
+		return subtableSize * Num_Hash_Functions;
+	}
+
+	ShortHashSketch::ShortHashSketch(size_t numCells)
+			: m_cells((numCells + Num_Hash_Functions - 1) / Num_Hash_Functions * Num_Hash_Functions, Cell())
+	{
+		if (m_cells.empty())
+			CATAPULT_THROW_INVALID_ARGUMENT("sketch must have at least one cell");
+	}
+
+	ShortHashSketch::ShortHashSketch(std::vector<Cell>&& cells) : m_cells(std::move(cells)) {
+		if (m_cells.empty() || 0 != m_cells.size() % Num_Hash_Functions)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("sketch must have a positive multiple of three cells", m_cells.size());
+	}
+
+	size_t ShortHashSketch::size() const {
+		return m_cells.size();
+	}
+
+	const ShortHashSketch::Cell* ShortHashSketch::data() const {
+		return m_cells.data();
+	}
+
+	void ShortHashSketch::insert(ShortHash shortHash) {
+		Update(m_cells, shortHash.unwrap(), 1);
+	}
+
+	void ShortHashSketch::remove(ShortHash shortHash) {
+		Update(m_cells, shortHash.unwrap(), -1);
+	}
+
+	void ShortHashSketch::subtract(const ShortHashSketch& sketch) {
+		if (m_cells.size() != sketch.m_cells.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_2("cannot subtract sketches of different sizes", m_cells.size(), sketch.m_cells.size());
+
+		for (auto i = 0u; i < m_cells.size(); ++i) {
+			const auto& otherCell = sketch.m_cells[i];
+			auto& cell = m_cells[i];
+			cell.Count = SubtractCounts(cell.Count, otherCell.Count);
+			cell.KeySum ^= otherCell.KeySum;
+			cell.CheckSum ^= otherCell.CheckSum;
+		}
+	}
+
+	bool ShortHashSketch::tryDecode(ShortHashesSet& positiveShortHashes, ShortHashesSet& negativeShortHashes) const {
+		auto cells = m_cells;
+		auto subtableSize = cells.size() / Num_Hash_Functions;
+		std::vector<size_t> pureCellIndexes;
+		for (auto i = 0u; i < cells.size(); ++i) {
+			if (IsPeelable(cells, i, subtableSize))
+				pureCellIndexes.push_back(i);
+		}
+
+		ShortHashesSet decodedShortHashes;
+		while (!pureCellIndexes.empty()) {
+			auto index = pureCellIndexes.back();
+			pureCellIndexes.pop_back();
+
+			// cell might have been peeled since it was queued
+			if (!IsPeelable(cells, index, subtableSize))
+				continue;
+
+			// each peel removes one distinct short hash, so a well-formed sketch never needs more peels than it has cells
+			const auto& cell = cells[index];
+			auto key = cell.KeySum;
+			auto count = cell.Count;
+			if (decodedShortHashes.size() == cells.size() || !decodedShortHashes.insert(ShortHash(key)).second)
+				return false;
+
+			(1 == count ? positiveShortHashes : negativeShortHashes).insert(ShortHash(key));
+			Update(cells, key, -count);
+
+			for (auto i = 0u; i < Num_Hash_Functions; ++i) {
+				auto cellIndex = CalculateIndex(key, i, subtableSize);
+				if (IsPeelable(cells, cellIndex, subtableSize))
+					pureCellIndexes.push_back(cellIndex);
+			}
+		}
+
+		return std::all_of(cells.cbegin(), cells.cend(), IsEmpty);
+	}
+
+	ShortHashSketch ShortHashSketch::fold(size_t numCells) const {
+		// short hashes are mapped to `hash % subtableSize` within each subtable, so a subtable can be folded into any smaller
+		// subtable with a size that divides its size
+		auto subtableSize = m_cells.size() / Num_Hash_Functions;
+		auto foldedSubtableSize = numCells / Num_Hash_Functions;
+		if (0 == numCells || 0 != numCells % Num_Hash_Functions || 0 != subtableSize % foldedSubtableSize)
+			CATAPULT_THROW_INVALID_ARGUMENT_2("cannot fold sketch into sketch with incompatible size", m_cells.size(), numCells);
+
+		std::vector<Cell> foldedCells(numCells, Cell());
+		for (auto i = 0u; i < m_cells.size(); ++i) {
+			auto hashIndex = i / subtableSize;
+			auto foldedIndex = hashIndex * foldedSubtableSize + (i % subtableSize) % foldedSubtableSize;
+			const auto& cell = m_cells[i];
+			auto& foldedCell = foldedCells[foldedIndex];
+			foldedCell.Count = AddCounts(foldedCell.Count, cell.Count);
+			foldedCell.KeySum ^= cell.KeySum;
+			foldedCell.CheckSum ^= cell.CheckSum;
+		}
+
+		return ShortHashSketch(std::move(foldedCells));
+	}
+}}
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Invertible bloom lookup table of short hashes.
+	/// \note A sketch can be subtracted from a sketch of another set of short hashes with the same number of cells
+	///       and decoded to recover the symmetric difference of both sets when it is small relative to the number of cells.
+	class ShortHashSketch {
+	public:
+		/// Sketch cell.
+		struct Cell {
+			/// Signed number of short hashes mapped to the cell.
+			/// \note Counts wrap around on overflow.
+			int32_t Count;
+
+			/// Xor of all short hashes mapped to the cell.
+			uint32_t KeySum;
+
+			/// Xor of the checksums of all short hashes mapped to the cell.
+			uint32_t CheckSum;
+		};
+
+		/// Number of cells each short hash is mapped to.
+		static constexpr size_t Num_Hash_Functions = 3;
+
+		/// Maximum number of cells in a sketch exchanged with a remote node (576 KB).
+		static constexpr size_t Max_Remote_Cells = 48 * 1024;
+
+	public:
+		/// Gets the smallest number of cells that is at least \a numCells and is supported for sketches exchanged with remote nodes.
+		/// \note Supported sketches have a power of two number of cells per hash function,
+		///       so that they can be folded from a sketch with Max_Remote_Cells cells.
+		static size_t CalculateRemoteSize(size_t numCells);
+
+	public:
+		/// Creates a sketch with at least \a numCells cells.
+		/// \note The number of cells is rounded up to the nearest multiple of Num_Hash_Functions.
+		explicit ShortHashSketch(size_t numCells);
+
+		/// Creates a sketch around \a cells.
+		explicit ShortHashSketch(std::vector<Cell>&& cells);
+
+	public:
+		/// Gets the number of cells.
+		size_t size() const;
+
+		/// Gets a const pointer to the cells.
+		const Cell* data() const;
+
+	public:
+		/// Inserts \a shortHash into the sketch.
+		void insert(ShortHash shortHash);
+
+		/// Removes (previously inserted) \a shortHash from the sketch.
+		void remove(ShortHash shortHash);
+
+		/// Subtracts \a sketch from this sketch.
+		void subtract(const ShortHashSketch& sketch);
+
+		/// Decodes the sketch into short hashes only present in this sketch (\a positiveShortHashes)
+		/// and short hashes only present in subtracted sketches (\a negativeShortHashes).
+		/// Returns \c true if the sketch was completely decoded.
+		/// \note Decoding is bounded by the number of cells, so it always terminates even for maliciously crafted cells.
+		bool tryDecode(ShortHashesSet& positiveShortHashes, ShortHashesSet& negativeShortHashes) const;
+
+		/// Creates a sketch with \a numCells cells containing the same short hashes as this sketch.
+		/// \note The number of cells per hash function of the folded sketch must divide the number of cells per hash function.
+		ShortHashSketch fold(size_t numCells) const;
+
+	private:
+		std::vector<Cell> m_cells;
+	};
+}}
@@ -30,6 +30,10 @@
 namespace catapult { namespace validators {
 
 	namespace {
+		// number of batches each worker is expected to claim; entity validation costs vary greatly (e.g. aggregates with many
+		// embedded transactions), so entities are claimed in small batches instead of being split evenly upfront
+		constexpr size_t Num_Batches_Per_Worker = 8;
+
 		// region ShortCircuitTraits
 
 		struct ShortCircuitTraits {
@@ -145,8 +149,10 @@ namespace catapult { namespace validators {
 					return pWork->future();
 				};
 
+				auto numWorkers = m_pPool->numWorkerThreads();
+				auto batchSize = pWork->entityInfos().size() / (numWorkers * Num_Batches_Per_Worker);
 				return thread::compose(
-						thread::ParallelFor(m_ioContext, pWork->entityInfos(), m_pPool->numWorkerThreads(), workProcessItemCallback),
+						thread::ParallelForDynamic(m_ioContext, pWork->entityInfos(), numWorkers, batchSize, workProcessItemCallback),
 						workCompleteCallback);
 			}
 
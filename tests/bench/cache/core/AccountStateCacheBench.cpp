@@ -0,0 +1,208 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateCacheSubCachePlugin.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Batch_Size = 1'000u;
+		constexpr auto Currency_Mosaic_Id = MosaicId(1111);
+
+		// region utils
+
+		AccountStateCacheTypes::Options CreateAccountStateCacheOptions() {
+			return {
+				model::NetworkIdentifier::Mijin_Test,
+				359,
+				Amount(10'000'000'000),
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Amount(50'000'000'000),
+				Currency_Mosaic_Id,
+				MosaicId(2222)
+			};
+		}
+
+		Address GenerateRandomAddress() {
+			Address address;
+			bench::FillWithRandomData(address);
+			return address;
+		}
+
+		std::vector<Address> SelectRandomAddresses(const std::vector<Address>& addresses) {
+			std::vector<Address> selectedAddresses;
+			for (auto i = 0u; i < Batch_Size; ++i)
+				selectedAddresses.push_back(addresses[bench::Random() % addresses.size()]);
+
+			return selectedAddresses;
+		}
+
+		std::vector<Address> AddRandomAccounts(AccountStateCacheDelta& delta, size_t count) {
+			std::vector<Address> addresses;
+			for (auto i = 0u; i < count; ++i) {
+				addresses.push_back(GenerateRandomAddress());
+				delta.addAccount(addresses.back(), Height(1));
+				delta.find(addresses.back()).get().Balances.credit(Currency_Mosaic_Id, Amount(bench::Random() % 1'000'000));
+			}
+
+			return addresses;
+		}
+
+		void CreditAccounts(AccountStateCacheDelta& delta, const std::vector<Address>& addresses) {
+			for (const auto& address : addresses)
+				delta.find(address).get().Balances.credit(Currency_Mosaic_Id, Amount(1));
+		}
+
+		std::vector<Address> SeedCache(AccountStateCache& cache, size_t count) {
+			auto delta = cache.createDelta();
+			auto addresses = AddRandomAccounts(*delta, count);
+			cache.commit();
+			return addresses;
+		}
+
+		class TempDirectoryGuard {
+		public:
+			TempDirectoryGuard()
+					: m_directory(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("catapult_bench_%%%%%%%%"))
+			{}
+
+			~TempDirectoryGuard() {
+				boost::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			std::string name() const {
+				return m_directory.generic_string();
+			}
+
+		private:
+			boost::filesystem::path m_directory;
+		};
+
+		// endregion
+
+		// region AccountStateCache
+
+		void BenchmarkAccountStateCacheDeltaFind(benchmark::State& state) {
+			AccountStateCache cache(CacheConfiguration(), CreateAccountStateCacheOptions());
+			auto addresses = SeedCache(cache, static_cast<size_t>(state.range(0)));
+
+			auto delta = cache.createDelta();
+			const auto& constDelta = *delta;
+			auto numFound = 0u;
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto selectedAddresses = SelectRandomAddresses(addresses);
+				state.ResumeTiming();
+
+				for (const auto& address : selectedAddresses) {
+					if (constDelta.find(address).tryGet())
+						++numFound;
+				}
+			}
+
+			benchmark::DoNotOptimize(numFound);
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkAccountStateCacheCommit(benchmark::State& state) {
+			AccountStateCache cache(CacheConfiguration(), CreateAccountStateCacheOptions());
+			auto addresses = SeedCache(cache, static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto delta = cache.createDelta();
+				CreditAccounts(*delta, SelectRandomAddresses(addresses));
+				state.ResumeTiming();
+
+				cache.commit();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		// endregion
+
+		// region CatapultCache (state hash)
+
+		CatapultCache CreateCatapultCache(const std::string& databaseDirectory) {
+			auto cacheConfig = CacheConfiguration(databaseDirectory, utils::FileSize::FromMegabytes(5), PatriciaTreeStorageMode::Enabled);
+
+			CatapultCacheBuilder builder;
+			builder.add(std::make_unique<AccountStateCacheSubCachePlugin>(cacheConfig, CreateAccountStateCacheOptions()));
+			return builder.build();
+		}
+
+		void BenchmarkCalculateStateHash(benchmark::State& state) {
+			TempDirectoryGuard tempDir;
+			auto cache = CreateCatapultCache(tempDir.name());
+
+			std::vector<Address> addresses;
+			{
+				auto delta = cache.createDelta();
+				addresses = AddRandomAccounts(delta.sub<AccountStateCache>(), static_cast<size_t>(state.range(0)));
+				delta.calculateStateHash(Height(1));
+				cache.commit(Height(1));
+			}
+
+			for (auto _ : state) {
+				state.PauseTiming();
+
+				// discard changes (outside of timing) so that every iteration starts from the same state
+				{
+					auto delta = cache.createDelta();
+					CreditAccounts(delta.sub<AccountStateCache>(), SelectRandomAddresses(addresses));
+					state.ResumeTiming();
+
+					benchmark::DoNotOptimize(delta.calculateStateHash(Height(2)));
+					state.PauseTiming();
+				}
+
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.UseRealTime()->RangeMultiplier(10)->Range(10'000, 10'000'000);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_CACHE_BENCHMARK(BENCH_NAME) \
+	catapult::cache::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::cache::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_CACHE_BENCHMARK(BenchmarkAccountStateCacheDeltaFind);
+	CATAPULT_REGISTER_CACHE_BENCHMARK(BenchmarkAccountStateCacheCommit);
+	CATAPULT_REGISTER_CACHE_BENCHMARK(BenchmarkCalculateStateHash);
+}
@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/FileSize.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Batch_Size = 1'000u;
+		constexpr auto Max_Cache_Size = 20'000'000u;
+
+		// region utils
+
+		MemoryCacheOptions CreateCacheOptions() {
+			return MemoryCacheOptions(utils::FileSize::FromMegabytes(20).bytes(), Max_Cache_Size);
+		}
+
+		model::TransactionInfo CreateRandomTransactionInfo() {
+			auto pTransaction = std::make_shared<model::Transaction>();
+			pTransaction->Size = sizeof(model::Transaction);
+			pTransaction->MaxFee = Amount(bench::Random() % 1'000'000);
+			pTransaction->Deadline = Timestamp(bench::Random());
+			bench::FillWithRandomData(pTransaction->SignerPublicKey);
+
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return model::TransactionInfo(std::move(pTransaction), hash);
+		}
+
+		std::vector<model::TransactionInfo> CreateRandomTransactionInfos(size_t count) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				transactionInfos.push_back(CreateRandomTransactionInfo());
+
+			return transactionInfos;
+		}
+
+		std::vector<Hash256> SeedCache(MemoryUtCache& cache, size_t count) {
+			std::vector<Hash256> hashes;
+			auto modifier = cache.modifier();
+			for (const auto& transactionInfo : CreateRandomTransactionInfos(count)) {
+				modifier.add(transactionInfo);
+				hashes.push_back(transactionInfo.EntityHash);
+			}
+
+			return hashes;
+		}
+
+		// endregion
+
+		void BenchmarkUtCacheAdd(benchmark::State& state) {
+			MemoryUtCache cache(CreateCacheOptions());
+			SeedCache(cache, static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto transactionInfos = CreateRandomTransactionInfos(Batch_Size);
+				state.ResumeTiming();
+
+				{
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : transactionInfos)
+						modifier.add(transactionInfo);
+				}
+
+				// remove added transactions so that the size of the cache is unchanged
+				state.PauseTiming();
+				{
+					auto modifier = cache.modifier();
+					for (const auto& transactionInfo : transactionInfos)
+						modifier.remove(transactionInfo.EntityHash);
+				}
+
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkUtCacheRemove(benchmark::State& state) {
+			MemoryUtCache cache(CreateCacheOptions());
+			SeedCache(cache, static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				// add transactions to remove so that the size of the cache is unchanged
+				state.PauseTiming();
+				auto hashes = SeedCache(cache, Batch_Size);
+				state.ResumeTiming();
+
+				auto modifier = cache.modifier();
+				for (const auto& hash : hashes)
+					modifier.remove(hash);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkUtCacheShortHashes(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			MemoryUtCache cache(CreateCacheOptions());
+			SeedCache(cache, count);
+
+			for (auto _ : state)
+				benchmark::DoNotOptimize(cache.view().shortHashes());
+
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.UseRealTime()->RangeMultiplier(10)->Range(10'000, 10'000'000);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_UT_CACHE_BENCHMARK(BENCH_NAME) \
+	catapult::cache::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::cache::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_UT_CACHE_BENCHMARK(BenchmarkUtCacheAdd);
+	CATAPULT_REGISTER_UT_CACHE_BENCHMARK(BenchmarkUtCacheRemove);
+	CATAPULT_REGISTER_UT_CACHE_BENCHMARK(BenchmarkUtCacheShortHashes);
+}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/Sha3MultiBuffer.h"
 #include "tests/bench/nodeps/Random.h"
 #include <benchmark/benchmark.h>
 
@@ -52,6 +53,19 @@ namespace catapult { namespace crypto {
 			static constexpr auto HashFunc = Sha3_256;
 		};
 
+		struct Sha3_256Batch_Traits {
+			static void HashAll(const std::vector<RawBuffer>& dataBuffers, std::vector<Hash256>& hashes) {
+				for (auto i = 0u; i < dataBuffers.size(); ++i)
+					Sha3_256(dataBuffers[i], hashes[i]);
+			}
+		};
+
+		struct Sha3_256Multi_Traits {
+			static void HashAll(const std::vector<RawBuffer>& dataBuffers, std::vector<Hash256>& hashes) {
+				Sha3_256Multi(dataBuffers.data(), hashes.data(), hashes.size());
+			}
+		};
+
 		// endregion
 
 		template<typename TTraits>
@@ -69,10 +83,35 @@ namespace catapult { namespace crypto {
 			state.SetBytesProcessed(static_cast<int64_t>(buffer.size() * state.iterations()));
 		}
 
+		template<typename TTraits>
+		void BenchmarkBatchHasher(benchmark::State& state) {
+			constexpr auto Num_Buffers = 64u;
+			std::vector<std::vector<uint8_t>> buffers(Num_Buffers, std::vector<uint8_t>(static_cast<size_t>(state.range(0))));
+			std::vector<RawBuffer> dataBuffers(buffers.cbegin(), buffers.cend());
+			std::vector<Hash256> hashes(Num_Buffers);
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& buffer : buffers)
+					bench::FillWithRandomData(buffer);
+
+				state.ResumeTiming();
+
+				TTraits::HashAll(dataBuffers, hashes);
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(Num_Buffers * buffers[0].size() * state.iterations()));
+		}
+
 		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		void AddBatchArguments(benchmark::internal::Benchmark& benchmark) {
+			// 64 bytes corresponds to a merkle node, other sizes are typical transaction sizes
+			for (auto arg : { 64, 256, 1024, 4096 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
 	}
 }}
 
@@ -81,6 +120,9 @@ namespace catapult { namespace crypto {
 #define CATAPULT_REGISTER_HASHER_BENCHMARK(TRAITS_NAME) \
 	catapult::crypto::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkHasher<catapult::crypto::TRAITS_NAME>))
 
+#define CATAPULT_REGISTER_BATCH_HASHER_BENCHMARK(TRAITS_NAME) \
+	catapult::crypto::AddBatchArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkBatchHasher<catapult::crypto::TRAITS_NAME>))
+
 void RegisterTests();
 void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Ripemd160_Traits);
@@ -88,4 +130,7 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+
+	CATAPULT_REGISTER_BATCH_HASHER_BENCHMARK(Sha3_256Batch_Traits);
+	CATAPULT_REGISTER_BATCH_HASHER_BENCHMARK(Sha3_256Multi_Traits);
 }
@@ -0,0 +1,190 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/deltaset/BaseSet.h"
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		constexpr auto Batch_Size = 10'000u;
+
+		// region BenchElement
+
+		struct BenchElement {
+		public:
+			BenchElement(uint64_t key, uint64_t value) : Key(key), Value(value)
+			{}
+
+		public:
+			uint64_t Key;
+			uint64_t Value;
+			std::array<uint8_t, 64> Data;
+		};
+
+		struct BenchElementToKeyConverter {
+			static constexpr uint64_t ToKey(const BenchElement& element) {
+				return element.Key;
+			}
+		};
+
+		using BenchSet = BaseSet<
+			MutableTypeTraits<BenchElement>,
+			MapStorageTraits<std::unordered_map<uint64_t, BenchElement>, BenchElementToKeyConverter>>;
+
+		// endregion
+
+		void SeedSet(BenchSet& set, size_t count) {
+			auto pDelta = set.rebase();
+			for (auto i = 0u; i < count; ++i)
+				pDelta->insert(BenchElement(i, i));
+
+			set.commit();
+		}
+
+		std::vector<uint64_t> GenerateRandomKeys(size_t maxKey) {
+			std::vector<uint64_t> keys;
+			for (auto i = 0u; i < Batch_Size; ++i)
+				keys.push_back(bench::Random() % maxKey);
+
+			return keys;
+		}
+
+		void BenchmarkBaseSetDeltaInsert(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			BenchSet set;
+			SeedSet(set, count);
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pDelta = set.rebase();
+				state.ResumeTiming();
+
+				for (auto i = 0u; i < Batch_Size; ++i)
+					pDelta->insert(BenchElement(count + i, i));
+
+				state.PauseTiming();
+				pDelta.reset();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkBaseSetDeltaFind(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			BenchSet set;
+			SeedSet(set, count);
+			auto pDelta = set.rebase();
+			const auto& delta = *pDelta;
+
+			auto numFound = 0u;
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = GenerateRandomKeys(count);
+				state.ResumeTiming();
+
+				for (auto key : keys) {
+					if (delta.find(key).get())
+						++numFound;
+				}
+			}
+
+			benchmark::DoNotOptimize(numFound);
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkBaseSetDeltaFindMutable(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			BenchSet set;
+			SeedSet(set, count);
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = GenerateRandomKeys(count);
+				auto pDelta = set.rebase();
+				state.ResumeTiming();
+
+				// mutable find copies the original element into the delta
+				for (auto key : keys)
+					pDelta->find(key).get()->Value += 1;
+
+				state.PauseTiming();
+				pDelta.reset();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkBaseSetCommit(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			BenchSet set;
+			SeedSet(set, count);
+
+			auto nextKey = count;
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = GenerateRandomKeys(count);
+				auto pDelta = set.rebase();
+
+				// modify, add and remove elements so that the size of the set is roughly unchanged
+				for (auto i = 0u; i < Batch_Size; ++i) {
+					if (0 == i % 2) {
+						auto* pElement = pDelta->find(keys[i]).get();
+						if (pElement)
+							pElement->Value += 1;
+
+						continue;
+					}
+
+					pDelta->insert(BenchElement(nextKey++, i));
+					pDelta->remove(keys[i]);
+				}
+
+				state.ResumeTiming();
+
+				set.commit();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.UseRealTime()->RangeMultiplier(10)->Range(10'000, 10'000'000);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_BASE_SET_BENCHMARK(BENCH_NAME) \
+	catapult::deltaset::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::deltaset::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkBaseSetDeltaInsert);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkBaseSetDeltaFind);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkBaseSetDeltaFindMutable);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkBaseSetCommit);
+}
@@ -0,0 +1,91 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/model/RangeTypes.h"
+#include <benchmark/benchmark.h>
+#include <boost/thread.hpp>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		constexpr auto Num_Elements_Per_Producer = 10'000u;
+
+		auto CreateTransactionRange() {
+			auto pTransaction = std::make_unique<model::Transaction>();
+			pTransaction->Size = sizeof(model::Transaction);
+			return model::TransactionRange::FromEntity(std::move(pTransaction));
+		}
+
+		auto CreateDispatcherOptions() {
+			auto options = ConsumerDispatcherOptions{ "ConsumerDispatcherBench", 16u * 1024 };
+			options.ElementTraceInterval = 0;
+			options.ShouldThrowWhenFull = false;
+			return options;
+		}
+
+		void ProduceAll(ConsumerDispatcher& dispatcher, std::vector<model::TransactionRange>& ranges) {
+			for (auto& range : ranges) {
+				// input is only moved when it is accepted, so retry with the same input when the dispatcher is full
+				auto input = ConsumerInput(model::AnnotatedTransactionRange(std::move(range)), InputSource::Remote_Push);
+				while (0 == dispatcher.processElement(std::move(input)))
+					std::this_thread::yield();
+			}
+		}
+
+		void BenchmarkProcessElementContention(benchmark::State& state) {
+			auto numProducers = static_cast<size_t>(state.range(0));
+			ConsumerDispatcher dispatcher(CreateDispatcherOptions(), { [](const auto&) { return ConsumerResult::Continue(); } });
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				std::vector<std::vector<model::TransactionRange>> producerRanges(numProducers);
+				for (auto& ranges : producerRanges) {
+					for (auto i = 0u; i < Num_Elements_Per_Producer; ++i)
+						ranges.push_back(CreateTransactionRange());
+				}
+
+				state.ResumeTiming();
+
+				boost::thread_group threads;
+				for (auto& ranges : producerRanges)
+					threads.create_thread([&dispatcher, &ranges]() { ProduceAll(dispatcher, ranges); });
+
+				threads.join_all();
+				while (0 != dispatcher.numActiveElements())
+					std::this_thread::yield();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numProducers * Num_Elements_Per_Producer * state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkProcessElementContention", catapult::disruptor::BenchmarkProcessElementContention)
+			->UseRealTime()
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8)
+			->Arg(16)
+			->Arg(64);
+}
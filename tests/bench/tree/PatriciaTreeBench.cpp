@@ -0,0 +1,148 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr auto Batch_Size = 1'000u;
+
+		// region BenchEncoder
+
+		class BenchEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using BenchPatriciaTree = PatriciaTree<BenchEncoder, MemoryDataSource>;
+
+		// endregion
+
+		Hash256 GenerateRandomHash() {
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return hash;
+		}
+
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				bench::FillWithRandomData(hash);
+
+			return hashes;
+		}
+
+		std::vector<Hash256> SeedTree(BenchPatriciaTree& tree, size_t count) {
+			auto keys = GenerateRandomHashes(count);
+			for (const auto& key : keys)
+				tree.set(key, GenerateRandomHash());
+
+			return keys;
+		}
+
+		void BenchmarkPatriciaTreeSetNew(benchmark::State& state) {
+			MemoryDataSource dataSource;
+			BenchPatriciaTree tree(dataSource);
+			SeedTree(tree, static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keys = GenerateRandomHashes(Batch_Size);
+				auto values = GenerateRandomHashes(Batch_Size);
+				state.ResumeTiming();
+
+				for (auto i = 0u; i < Batch_Size; ++i)
+					tree.set(keys[i], values[i]);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkPatriciaTreeSetExisting(benchmark::State& state) {
+			MemoryDataSource dataSource;
+			BenchPatriciaTree tree(dataSource);
+			auto seededKeys = SeedTree(tree, static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				std::vector<Hash256> keys;
+				for (auto i = 0u; i < Batch_Size; ++i)
+					keys.push_back(seededKeys[bench::Random() % seededKeys.size()]);
+
+				auto values = GenerateRandomHashes(Batch_Size);
+				state.ResumeTiming();
+
+				for (auto i = 0u; i < Batch_Size; ++i)
+					tree.set(keys[i], values[i]);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void BenchmarkPatriciaTreeRoot(benchmark::State& state) {
+			MemoryDataSource dataSource;
+			BenchPatriciaTree tree(dataSource);
+			SeedTree(tree, static_cast<size_t>(state.range(0)));
+
+			// branch hashes are recalculated when updated nodes are saved, so measure a single update followed by root retrieval
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto key = GenerateRandomHash();
+				auto value = GenerateRandomHash();
+				state.ResumeTiming();
+
+				tree.set(key, value);
+				benchmark::DoNotOptimize(tree.root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			benchmark.UseRealTime()->RangeMultiplier(10)->Range(10'000, 10'000'000);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_TREE_BENCHMARK(BENCH_NAME) \
+	catapult::tree::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::tree::BENCH_NAME))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_TREE_BENCHMARK(BenchmarkPatriciaTreeSetNew);
+	CATAPULT_REGISTER_TREE_BENCHMARK(BenchmarkPatriciaTreeSetExisting);
+	CATAPULT_REGISTER_TREE_BENCHMARK(BenchmarkPatriciaTreeRoot);
+}
@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ScalableReaderWriterLock.h"
+#include "catapult/utils/SpinReaderWriterLock.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr auto Batch_Size = 10'000u;
+
+		template<typename TLock>
+		struct LockState {
+			static TLock Lock;
+			static uint64_t Value;
+		};
+
+		template<typename TLock>
+		TLock LockState<TLock>::Lock;
+
+		template<typename TLock>
+		uint64_t LockState<TLock>::Value;
+
+		template<typename TLock>
+		void BenchmarkReaderWriterLock(benchmark::State& state) {
+			// every writerInterval-th lock acquisition (when nonzero) is a write and all others are reads
+			auto writerInterval = static_cast<size_t>(state.range(0));
+
+			uint64_t sum = 0;
+			for (auto _ : state) {
+				for (auto i = 1u; i <= Batch_Size; ++i) {
+					if (0 != writerInterval && 0 == i % writerInterval) {
+						auto writeLock = LockState<TLock>::Lock.acquireWriter();
+						++LockState<TLock>::Value;
+					} else {
+						auto readLock = LockState<TLock>::Lock.acquireReader();
+						sum += LockState<TLock>::Value;
+					}
+				}
+			}
+
+			benchmark::DoNotOptimize(sum);
+			state.SetItemsProcessed(static_cast<int64_t>(Batch_Size * state.iterations()));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			// read only and read mostly (1% writes) workloads
+			benchmark.UseRealTime()->Arg(0)->Arg(100)->ThreadRange(1, 16);
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME, LOCK_TYPE) \
+	benchmark::RegisterBenchmark(#BENCH_NAME "<" #LOCK_TYPE ">", BENCH_NAME<catapult::utils::LOCK_TYPE>)
+
+#define CATAPULT_REGISTER_LOCK_BENCHMARK(LOCK_TYPE) \
+	catapult::utils::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::utils::BenchmarkReaderWriterLock, LOCK_TYPE))
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_LOCK_BENCHMARK(SpinReaderWriterLock);
+	CATAPULT_REGISTER_LOCK_BENCHMARK(ScalableReaderWriterLock);
+}
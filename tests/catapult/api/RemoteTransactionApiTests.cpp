@@ -26,6 +26,8 @@
 
 namespace catapult { namespace api {
 
+#define TEST_CLASS RemoteTransactionApiTests
+
 	namespace {
 		using TransactionType = mocks::MockTransaction;
 
@@ -108,6 +110,58 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtSketchTraits {
+			static constexpr uint32_t Request_Data_Header_Size = sizeof(BlockFeeMultiplier);
+			static constexpr uint32_t Request_Data_Size = 6 * sizeof(utils::ShortHashSketch::Cell);
+
+			static utils::ShortHashSketch KnownShortHashesSketch() {
+				utils::ShortHashSketch sketch(6);
+				for (auto shortHash : { 123u, 234u, 345u })
+					sketch.insert(utils::ShortHash(shortHash));
+
+				return sketch;
+			}
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.unconfirmedTransactionsBySketch(BlockFeeMultiplier(17), KnownShortHashesSketch());
+			}
+
+			static auto CreateValidResponsePacket() {
+				// prepend the transactions with the difference size
+				auto pTransactionsPacket = CreatePacketWithTransactions(3);
+				auto transactionsSize = pTransactionsPacket->Size - static_cast<uint32_t>(sizeof(ionet::Packet));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(uint32_t) + transactionsSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+				reinterpret_cast<uint32_t&>(*pResponsePacket->Data()) = 7;
+				std::memcpy(pResponsePacket->Data() + sizeof(uint32_t), pTransactionsPacket->Data(), transactionsSize);
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Transactions_Sketch, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Header_Size + Request_Data_Size, packet.Size);
+				EXPECT_EQ(BlockFeeMultiplier(17), reinterpret_cast<const BlockFeeMultiplier&>(*packet.Data()));
+				EXPECT_EQ_MEMORY(packet.Data() + sizeof(BlockFeeMultiplier), KnownShortHashesSketch().data(), Request_Data_Size);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const UnconfirmedTransactionsSketchResult& result) {
+				EXPECT_TRUE(result.IsDecoded);
+				EXPECT_EQ(7u, result.DifferenceSize);
+
+				auto transactionsSize = response.Size - static_cast<uint32_t>(sizeof(ionet::Packet) + sizeof(uint32_t));
+				auto pTransactionsPacket = ionet::CreateSharedPacket<ionet::Packet>(transactionsSize);
+				std::memcpy(pTransactionsPacket->Data(), response.Data() + sizeof(uint32_t), transactionsSize);
+				UtTraits::ValidateResponse(*pTransactionsPacket, result.Transactions);
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(ionet::PacketIo& packetIo, const model::NodeIdentity& remoteIdentity) {
 				auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -122,4 +176,36 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_BASIC(RemoteTransactionApi, UtSketch)
+
+	namespace {
+		void AssertUtSketchResponse(uint32_t responseDataSize, bool expectedIsDecoded) {
+			// Arrange:
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(responseDataSize);
+			pResponsePacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+			if (0 != responseDataSize)
+				reinterpret_cast<uint32_t&>(*pResponsePacket->Data()) = 7;
+
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemoteTransactionApiTraits::Create(*pPacketIo);
+
+			// Act:
+			auto result = UtSketchTraits::Invoke(*pApi).get();
+
+			// Assert:
+			EXPECT_EQ(expectedIsDecoded, result.IsDecoded);
+			EXPECT_EQ(expectedIsDecoded ? 7u : 0u, result.DifferenceSize);
+			EXPECT_EQ(0u, result.Transactions.size());
+		}
+	}
+
+	TEST(TEST_CLASS, EmptyResponseIndicatesUndecodableSketch_UtSketch) {
+		AssertUtSketchResponse(0, false);
+	}
+
+	TEST(TEST_CLASS, ResponseWithoutTransactionsIsConsideredValid_UtSketch) {
+		AssertUtSketchResponse(sizeof(uint32_t), true);
+	}
 }}
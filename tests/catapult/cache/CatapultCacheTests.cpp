@@ -23,11 +23,14 @@
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/crypto/Hashes.h"
+#include "catapult/ionet/IoTypes.h"
 #include "catapult/state/CatapultState.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/StateTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -120,12 +123,22 @@ namespace catapult { namespace cache {
 				return view.calculateStateHash(Height(123));
 			}
 		};
+
+		struct ParallelDeltaTraits : public DeltaTraits {
+			static auto CalculateStateHash(const CatapultCacheDelta& view) {
+				auto pPool = test::CreateStartedIoThreadPool(2);
+				auto stateHashInfo = view.calculateStateHash(Height(123), *pPool);
+				pPool->join();
+				return stateHashInfo;
+			}
+		};
 	}
 
 #define VIEW_DELTA_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_View) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ViewTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Delta) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DeltaTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_ParallelDelta) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelDeltaTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	VIEW_DELTA_TEST(StateHashIsZeroWhenStateCalculationIsDisabled) {
@@ -230,6 +243,64 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(hashes, subCacheMerkleRoots);
 	}
 
+	TEST(TEST_CLASS, StateHashCalculatedWithPoolMatchesStateHashCalculatedSerially) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		auto pPool = test::CreateStartedIoThreadPool(2);
+
+		// Act: use separate deltas so that each calculation starts from the same (unmodified) merkle roots
+		StateHashInfo serialStateHashInfo;
+		{
+			auto delta = cache.createDelta();
+			serialStateHashInfo = delta.calculateStateHash(Height(77));
+		}
+
+		StateHashInfo parallelStateHashInfo;
+		{
+			auto delta = cache.createDelta();
+			parallelStateHashInfo = delta.calculateStateHash(Height(77), *pPool);
+		}
+
+		pPool->join();
+
+		// Assert: merkle roots were updated
+		EXPECT_NE(cache.createView().calculateStateHash().StateHash, serialStateHashInfo.StateHash);
+
+		EXPECT_EQ(serialStateHashInfo.StateHash, parallelStateHashInfo.StateHash);
+		EXPECT_EQ(serialStateHashInfo.SubCacheMerkleRoots, parallelStateHashInfo.SubCacheMerkleRoots);
+	}
+
+	TEST(TEST_CLASS, StateHashCalculatedWithPoolUpdatesMerkleRootsOnPool) {
+		// Arrange: block the only pool thread until released
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		auto pPool = test::CreateStartedIoThreadPool(1);
+		std::atomic_bool isPoolReleased(false);
+		boost::asio::post(pPool->ioContext(), [&isPoolReleased]() {
+			while (!isPoolReleased)
+				test::Pause();
+		});
+
+		// Act: calculate the state hash on a separate thread
+		std::atomic_bool isCalculated(false);
+		std::thread calculateThread([&cache, &pPool, &isCalculated]() {
+			auto delta = cache.createDelta();
+			delta.calculateStateHash(Height(77), *pPool);
+			isCalculated = true;
+		});
+
+		// - calculation cannot complete while the pool is blocked
+		test::Sleep(50);
+		auto isCalculatedBeforeRelease = static_cast<bool>(isCalculated);
+
+		isPoolReleased = true;
+		calculateThread.join();
+		pPool->join();
+
+		// Assert:
+		EXPECT_FALSE(isCalculatedBeforeRelease);
+		EXPECT_TRUE(isCalculated);
+	}
+
 	// endregion
 
 	// region commit
@@ -48,9 +48,21 @@ namespace catapult { namespace cache {
 				CATAPULT_THROW_RUNTIME_ERROR("count - not supported in mock");
 			}
 
+			std::vector<model::TransactionInfo> transactionInfos() const override {
+				CATAPULT_THROW_RUNTIME_ERROR("transactionInfos - not supported in mock");
+			}
+
 			std::vector<model::TransactionInfo> removeAll() override {
 				CATAPULT_THROW_RUNTIME_ERROR("removeAll - not supported in mock");
 			}
+
+			std::vector<model::TransactionInfo> prune(Timestamp) override {
+				CATAPULT_THROW_RUNTIME_ERROR("prune - not supported in mock");
+			}
+
+			model::TransactionInfo evict(const model::TransactionInfo&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("evict - not supported in mock");
+			}
 		};
 
 		template<typename TUtCacheModifier>
@@ -143,6 +155,53 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region transactionInfos
+
+	namespace {
+		class MockTransactionInfosUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			MockTransactionInfosUtCacheModifier(size_t& numTransactionInfosCalls, std::vector<model::TransactionInfo>&& transactionInfos)
+					: m_numTransactionInfosCalls(numTransactionInfosCalls)
+					, m_transactionInfos(std::move(transactionInfos)) {
+				m_numTransactionInfosCalls = 0;
+			}
+
+		public:
+			std::vector<model::TransactionInfo> transactionInfos() const override {
+				++m_numTransactionInfosCalls;
+				return test::CopyTransactionInfos(m_transactionInfos);
+			}
+
+		private:
+			size_t& m_numTransactionInfosCalls;
+			std::vector<model::TransactionInfo> m_transactionInfos;
+		};
+	}
+
+	TEST(TEST_CLASS, TransactionInfosDelegatesToCacheOnly) {
+		// Arrange:
+		size_t numTransactionInfosCalls;
+		auto utInfos = test::CreateTransactionInfos(5);
+		TestContext<MockTransactionInfosUtCacheModifier> context(numTransactionInfosCalls, test::CopyTransactionInfos(utInfos));
+
+		// Act:
+		auto transactionInfos = context.aggregate().modifier().transactionInfos();
+
+		// Assert:
+		ASSERT_EQ(5u, transactionInfos.size());
+		for (auto i = 0u; i < utInfos.size(); ++i)
+			test::AssertEqual(utInfos[i], transactionInfos[i], "info from transaction infos " + std::to_string(i));
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(1u, numTransactionInfosCalls);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(mocks::UtFlushInfo({ 0u, 0u }), context.subscriber().flushInfos()[0]);
+	}
+
+	// endregion
+
 	// region removeAll
 
 	namespace {
@@ -210,5 +269,141 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(mocks::UtFlushInfo({ 0u, 5u }), context.subscriber().flushInfos()[0]);
 	}
 
+	// endregion
+	// region prune
+
+	namespace {
+		class MockPruneUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			MockPruneUtCacheModifier(std::vector<Timestamp>& pruneTimestamps, std::vector<model::TransactionInfo>&& transactionInfos)
+					: m_pruneTimestamps(pruneTimestamps)
+					, m_transactionInfos(std::move(transactionInfos))
+			{}
+
+		public:
+			std::vector<model::TransactionInfo> prune(Timestamp timestamp) override {
+				m_pruneTimestamps.push_back(timestamp);
+				return std::move(m_transactionInfos);
+			}
+
+		private:
+			std::vector<Timestamp>& m_pruneTimestamps;
+			std::vector<model::TransactionInfo> m_transactionInfos;
+		};
+	}
+
+	TEST(TEST_CLASS, PruneDelegatesToCacheOnlyWhenNothingIsPruned) {
+		// Arrange:
+		std::vector<Timestamp> pruneTimestamps;
+		TestContext<MockPruneUtCacheModifier> context(pruneTimestamps, std::vector<model::TransactionInfo>());
+
+		// Act:
+		auto prunedInfos = context.aggregate().modifier().prune(Timestamp(123));
+
+		// Assert:
+		EXPECT_TRUE(prunedInfos.empty());
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Timestamp>({ Timestamp(123) }), pruneTimestamps);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(mocks::UtFlushInfo({ 0u, 0u }), context.subscriber().flushInfos()[0]);
+	}
+
+	TEST(TEST_CLASS, PruneDelegatesToCacheAndSubscriberWhenTransactionsArePruned) {
+		// Arrange:
+		std::vector<Timestamp> pruneTimestamps;
+		auto utInfos = test::CreateTransactionInfos(3);
+		TestContext<MockPruneUtCacheModifier> context(pruneTimestamps, test::CopyTransactionInfos(utInfos));
+
+		// Act:
+		auto prunedInfos = context.aggregate().modifier().prune(Timestamp(123));
+
+		// Assert:
+		ASSERT_EQ(3u, prunedInfos.size());
+		for (auto i = 0u; i < utInfos.size(); ++i)
+			test::AssertEqual(utInfos[i], prunedInfos[i], "info from prune " + std::to_string(i));
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Timestamp>({ Timestamp(123) }), pruneTimestamps);
+
+		// - check subscriber
+		ASSERT_EQ(3u, context.subscriber().removedInfos().size());
+		test::AssertEquivalent(utInfos, context.subscriber().removedInfos(), "subscriber infos");
+
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(mocks::UtFlushInfo({ 0u, 3u }), context.subscriber().flushInfos()[0]);
+	}
+
+	// endregion
+
+	// region evict
+
+	namespace {
+		class MockEvictUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			MockEvictUtCacheModifier(std::vector<Hash256>& evictHashes, model::TransactionInfo&& transactionInfo)
+					: m_evictHashes(evictHashes)
+					, m_transactionInfo(std::move(transactionInfo))
+			{}
+
+		public:
+			model::TransactionInfo evict(const model::TransactionInfo& transactionInfo) override {
+				m_evictHashes.push_back(transactionInfo.EntityHash);
+				return std::move(m_transactionInfo);
+			}
+
+		private:
+			std::vector<Hash256>& m_evictHashes;
+			model::TransactionInfo m_transactionInfo;
+		};
+	}
+
+	TEST(TEST_CLASS, EvictDelegatesToCacheOnlyWhenNothingIsEvicted) {
+		// Arrange:
+		std::vector<Hash256> evictHashes;
+		auto utInfo = test::CreateRandomTransactionInfo();
+		TestContext<MockEvictUtCacheModifier> context(evictHashes, model::TransactionInfo());
+
+		// Act:
+		auto evictedInfo = context.aggregate().modifier().evict(utInfo);
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Hash256>({ utInfo.EntityHash }), evictHashes);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(mocks::UtFlushInfo({ 0u, 0u }), context.subscriber().flushInfos()[0]);
+	}
+
+	TEST(TEST_CLASS, EvictDelegatesToCacheAndSubscriberWhenTransactionIsEvicted) {
+		// Arrange:
+		std::vector<Hash256> evictHashes;
+		auto utInfo = test::CreateRandomTransactionInfo();
+		auto evictableUtInfos = test::CreateTransactionInfos(1);
+		TestContext<MockEvictUtCacheModifier> context(evictHashes, evictableUtInfos[0].copy());
+
+		// Act:
+		auto evictedInfo = context.aggregate().modifier().evict(utInfo);
+
+		// Assert:
+		ASSERT_TRUE(!!evictedInfo);
+		test::AssertEqual(evictableUtInfos[0], evictedInfo);
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Hash256>({ utInfo.EntityHash }), evictHashes);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().removedInfos().size());
+		test::AssertEquivalent(evictableUtInfos, context.subscriber().removedInfos(), "subscriber infos");
+
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(mocks::UtFlushInfo({ 0u, 1u }), context.subscriber().flushInfos()[0]);
+	}
+
 	// endregion
 }}
@@ -551,6 +551,52 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach
+
+	TEST(TEST_CLASS, ForEachForwardsAllTransactionsWithCosignatures) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		AddAll(cache, transactionInfos);
+
+		auto cosignatures = Sort(test::GenerateRandomDataVector<model::Cosignature>(3));
+		AddAll(cache, transactionInfos[1], cosignatures);
+
+		// Act:
+		std::map<const model::Transaction*, std::vector<model::Cosignature>> forwardedInfos;
+		cache.view().forEach([&forwardedInfos](const auto& transactionInfo) {
+			forwardedInfos.emplace(&transactionInfo.transaction(), transactionInfo.cosignatures());
+			return true;
+		});
+
+		// Assert:
+		ASSERT_EQ(3u, forwardedInfos.size());
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			auto iter = forwardedInfos.find(transactionInfos[i].pEntity.get());
+			ASSERT_NE(forwardedInfos.cend(), iter) << "info at " << i;
+
+			auto expectedCosignatures = 1 == i ? cosignatures : std::vector<model::Cosignature>();
+			test::AssertCosignatures(expectedCosignatures, iter->second, "info at " + std::to_string(i));
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachStopsWhenConsumerReturnsFalse) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto numForwardedInfos = 0u;
+		cache.view().forEach([&numForwardedInfos](const auto&) {
+			return 2 != ++numForwardedInfos;
+		});
+
+		// Assert:
+		EXPECT_EQ(2u, numForwardedInfos);
+	}
+
+	// endregion
+
 	// region shortHashPairs
 
 	namespace {
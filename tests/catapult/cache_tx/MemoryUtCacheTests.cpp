@@ -408,6 +408,29 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region transactionInfos
+
+	TEST(TEST_CLASS, CanGetAllTransactionInfosFromCache) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto cacheTransactionInfos = cache.modifier().transactionInfos();
+
+		// Assert: cache was not changed and all transactions were returned in order
+		AssertCacheSize(cache, 5);
+		test::AssertContainsAll(cache, transactionInfos);
+
+		ASSERT_EQ(5u, cacheTransactionInfos.size());
+		auto i = 0u;
+		for (const auto& transactionInfo : transactionInfos)
+			test::AssertEqual(transactionInfo, cacheTransactionInfos[i++]);
+	}
+
+	// endregion
+
 	// region removeAll
 
 	TEST(TEST_CLASS, CanRemoveAllTransactionsFromCache) {
@@ -435,6 +458,263 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prune
+
+	namespace {
+		auto CreateTransactionInfosWithDeadlines(const std::vector<Timestamp::ValueType>& rawDeadlines) {
+			return test::CreateTransactionInfos(rawDeadlines.size(), [&rawDeadlines](auto i) { return Timestamp(rawDeadlines[i]); });
+		}
+	}
+
+	TEST(TEST_CLASS, PruneHasNoEffectWhenNoTransactionsHaveExpired) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithDeadlines({ 5, 1, 4, 2, 3 }));
+
+		// Act:
+		auto prunedInfos = cache.modifier().prune(Timestamp(1));
+
+		// Assert:
+		EXPECT_TRUE(prunedInfos.empty());
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 5, 1, 4, 2, 3 });
+	}
+
+	TEST(TEST_CLASS, PruneRemovesAllTransactionsWithDeadlinesBeforeTimestamp) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithDeadlines({ 5, 1, 4, 2, 3 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto prunedInfos = cache.modifier().prune(Timestamp(3));
+
+		// Assert: pruned infos are ordered by deadline
+		AssertCacheSize(cache, 3);
+		test::AssertDeadlines(cache, { 5, 4, 3 });
+
+		AssertDeadlines(prunedInfos, { 1, 2 });
+		test::AssertEqual(transactionInfos[1], prunedInfos[0]);
+		test::AssertEqual(transactionInfos[3], prunedInfos[1]);
+		test::AssertContainsNone(cache, prunedInfos);
+	}
+
+	TEST(TEST_CLASS, PruneCanRemoveAllTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithDeadlines({ 5, 1, 4, 2, 3 }));
+
+		// Act:
+		auto prunedInfos = cache.modifier().prune(Timestamp(6));
+
+		// Assert:
+		AssertCacheSize(cache, 0);
+		AssertDeadlines(prunedInfos, { 1, 2, 3, 4, 5 });
+	}
+
+	TEST(TEST_CLASS, PruneIgnoresRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithDeadlines({ 5, 1, 4, 2, 3 });
+		test::AddAll(cache, transactionInfos);
+		cache.modifier().remove(transactionInfos[1].EntityHash);
+
+		// Act:
+		auto prunedInfos = cache.modifier().prune(Timestamp(4));
+
+		// Assert:
+		AssertCacheSize(cache, 2);
+		test::AssertDeadlines(cache, { 5, 4 });
+		AssertDeadlines(prunedInfos, { 2, 3 });
+	}
+
+	TEST(TEST_CLASS, PruneUpdatesCounters) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithDeadlines({ 5, 1, 4, 2, 3 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto modifier = cache.modifier();
+		modifier.prune(Timestamp(3));
+
+		// Assert:
+		for (auto i : { 0u, 2u, 4u })
+			EXPECT_EQ(1u, modifier.count(transactionInfos[i].pEntity->SignerPublicKey)) << i;
+
+		for (auto i : { 1u, 3u })
+			EXPECT_EQ(0u, modifier.count(transactionInfos[i].pEntity->SignerPublicKey)) << i;
+	}
+
+	// endregion
+
+	// region evict
+
+	namespace {
+		auto CreateTransactionInfoWithFeeMultiplier(Timestamp deadline, uint32_t feeMultiplier) {
+			auto transactionInfo = test::CreateTransactionInfoWithDeadline(deadline.unwrap());
+			const_cast<Amount&>(transactionInfo.pEntity->MaxFee) = Amount(transactionInfo.pEntity->Size * feeMultiplier);
+			return transactionInfo;
+		}
+
+		auto CreateTransactionInfosWithFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < feeMultipliers.size(); ++i)
+				transactionInfos.push_back(CreateTransactionInfoWithFeeMultiplier(Timestamp(i + 1), feeMultipliers[i]));
+
+			return transactionInfos;
+		}
+	}
+
+	TEST(TEST_CLASS, EvictHasNoEffectWhenCacheIsNotFull) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 6));
+		test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 }));
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 1, 2, 3, 4, 5 });
+	}
+
+	TEST(TEST_CLASS, EvictHasNoEffectWhenNoTransactionPaysLowerFee) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 }));
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 10));
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 1, 2, 3, 4, 5 });
+	}
+
+	TEST(TEST_CLASS, EvictRemovesTransactionWithLowestFeeWhenCacheIsFull) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 });
+		test::AddAll(cache, transactionInfos);
+		auto transactionInfo = CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 11);
+
+		// Act:
+		auto isAdded = false;
+		model::TransactionInfo evictedInfo;
+		{
+			auto modifier = cache.modifier();
+			evictedInfo = modifier.evict(transactionInfo);
+			isAdded = modifier.add(transactionInfo);
+		}
+
+		// Assert: the cheapest info was replaced
+		ASSERT_TRUE(!!evictedInfo);
+		test::AssertEqual(transactionInfos[3], evictedInfo);
+
+		EXPECT_TRUE(isAdded);
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 1, 2, 3, 5, 1234 });
+	}
+
+	TEST(TEST_CLASS, EvictRemovesNewestTransactionWhenMultipleTransactionsHaveLowestFee) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 10, 20, 10, 10, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+
+		// Assert:
+		ASSERT_TRUE(!!evictedInfo);
+		test::AssertEqual(transactionInfos[3], evictedInfo);
+
+		AssertCacheSize(cache, 4);
+		test::AssertDeadlines(cache, { 1, 2, 3, 5 });
+	}
+
+	TEST(TEST_CLASS, EvictIgnoresRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 4));
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 });
+		test::AddAll(cache, transactionInfos);
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[3].EntityHash);
+			modifier.add(transactionInfos[4]);
+		}
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+
+		// Assert:
+		ASSERT_TRUE(!!evictedInfo);
+		test::AssertEqual(transactionInfos[1], evictedInfo);
+
+		AssertCacheSize(cache, 3);
+		test::AssertDeadlines(cache, { 1, 3, 5 });
+	}
+
+	TEST(TEST_CLASS, EvictedTransactionAddedBackBySameModifierIsRestoredAtOriginalPosition) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto isAdded = false;
+		{
+			auto modifier = cache.modifier();
+			auto evictedInfo = modifier.evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+			modifier.add(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+			modifier.remove(transactionInfos[0].EntityHash);
+			isAdded = modifier.add(evictedInfo);
+		}
+
+		// Assert: the evicted transaction kept its original position
+		EXPECT_TRUE(isAdded);
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 2, 3, 4, 5, 1234 });
+	}
+
+	TEST(TEST_CLASS, EvictedTransactionAddedBackByOtherModifierIsAddedAsNewTransaction) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 });
+		test::AddAll(cache, transactionInfos);
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+
+		// Act:
+		auto isAdded = cache.modifier().add(evictedInfo);
+
+		// Assert:
+		EXPECT_TRUE(isAdded);
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 1, 2, 3, 5, 4 });
+	}
+
+	TEST(TEST_CLASS, EvictUpdatesCounters) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 50, 20, 40, 10, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto modifier = cache.modifier();
+		modifier.evict(CreateTransactionInfoWithFeeMultiplier(Timestamp(1234), 100));
+
+		// Assert:
+		for (auto i : { 0u, 1u, 2u, 4u })
+			EXPECT_EQ(1u, modifier.count(transactionInfos[i].pEntity->SignerPublicKey)) << i;
+
+		EXPECT_EQ(0u, modifier.count(transactionInfos[3].pEntity->SignerPublicKey));
+	}
+
+	// endregion
+
 	// region contains
 
 	TEST(TEST_CLASS, ContainsReturnsTrueWhenTransactionInfoIsContainedInCache) {
@@ -534,6 +814,214 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region shortHashesSketch
+
+	TEST(TEST_CLASS, ShortHashesSketchContainsAllShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(10);
+		utils::ShortHashesSet expectedShortHashes;
+		for (const auto& transactionInfo : transactionInfos)
+			expectedShortHashes.insert(utils::ToShortHash(transactionInfo.EntityHash));
+
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto sketch = cache.view().shortHashesSketch(384);
+
+		// Assert:
+		EXPECT_EQ(384u, sketch.size());
+
+		utils::ShortHashesSet positiveShortHashes;
+		utils::ShortHashesSet negativeShortHashes;
+		EXPECT_TRUE(sketch.tryDecode(positiveShortHashes, negativeShortHashes));
+		EXPECT_EQ(expectedShortHashes, positiveShortHashes);
+		EXPECT_TRUE(negativeShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, ShortHashesSketchNumberOfCellsIsRoundedUpToSupportedSize) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(10));
+
+		// Act:
+		auto sketch = cache.view().shortHashesSketch(300);
+
+		// Assert:
+		EXPECT_EQ(384u, sketch.size());
+	}
+
+	namespace {
+		void AssertShortHashesSketch(const MemoryUtCache& cache, const std::vector<model::TransactionInfo>& expectedTransactionInfos) {
+			utils::ShortHashSketch expectedSketch(96);
+			for (const auto& transactionInfo : expectedTransactionInfos)
+				expectedSketch.insert(utils::ToShortHash(transactionInfo.EntityHash));
+
+			auto sketch = cache.view().shortHashesSketch(96);
+			ASSERT_EQ(96u, sketch.size());
+			EXPECT_EQ_MEMORY(expectedSketch.data(), sketch.data(), 96 * sizeof(utils::ShortHashSketch::Cell));
+		}
+	}
+
+	TEST(TEST_CLASS, ShortHashesSketchIsUpdatedWhenTransactionsAreRemoved) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(10);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[2].EntityHash);
+			modifier.remove(transactionInfos[7].EntityHash);
+		}
+
+		// Assert:
+		transactionInfos.erase(transactionInfos.begin() + 7);
+		transactionInfos.erase(transactionInfos.begin() + 2);
+		AssertShortHashesSketch(cache, transactionInfos);
+	}
+
+	TEST(TEST_CLASS, ShortHashesSketchIsUpdatedWhenTransactionsArePruned) {
+		// Arrange: deadlines are 1, 2, ..., 10
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(10);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		cache.modifier().prune(Timestamp(5));
+
+		// Assert:
+		transactionInfos.erase(transactionInfos.begin(), transactionInfos.begin() + 4);
+		AssertShortHashesSketch(cache, transactionInfos);
+	}
+
+	TEST(TEST_CLASS, ShortHashesSketchIsEmptyWhenAllTransactionsAreRemoved) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(10));
+
+		// Act:
+		cache.modifier().removeAll();
+
+		// Assert:
+		AssertShortHashesSketch(cache, {});
+	}
+
+	// endregion
+
+	// region requestedTransactions
+
+	TEST(TEST_CLASS, RequestedTransactionsReturnsNothingWhenNoShortHashesAreRequested) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto transactions = cache.view().requestedTransactions(BlockFeeMultiplier(0), {});
+
+		// Assert:
+		EXPECT_TRUE(transactions.empty());
+	}
+
+	TEST(TEST_CLASS, RequestedTransactionsReturnsOnlyTransactionsWithRequestedShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet requestedShortHashes;
+		requestedShortHashes.insert(utils::ToShortHash(transactionInfos[1].EntityHash));
+		requestedShortHashes.insert(utils::ToShortHash(transactionInfos[3].EntityHash));
+		requestedShortHashes.insert(utils::ShortHash(123));
+
+		// Act:
+		auto transactions = cache.view().requestedTransactions(BlockFeeMultiplier(0), requestedShortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 4 });
+	}
+
+	TEST(TEST_CLASS, RequestedTransactionsReturnsAllTransactionsWithRequestedShortHashInOrderOfAddition) {
+		// Arrange: first, third and fifth transactions have the same short hash
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		for (auto i : { 2u, 4u })
+			std::memcpy(transactionInfos[i].EntityHash.data(), transactionInfos[0].EntityHash.data(), sizeof(utils::ShortHash));
+
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet requestedShortHashes;
+		requestedShortHashes.insert(utils::ToShortHash(transactionInfos[3].EntityHash));
+		requestedShortHashes.insert(utils::ToShortHash(transactionInfos[0].EntityHash));
+
+		// Act:
+		auto transactions = cache.view().requestedTransactions(BlockFeeMultiplier(0), requestedShortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 1, 3, 4, 5 });
+	}
+
+	TEST(TEST_CLASS, RequestedTransactionsReturnsTransactionsWithRequestedShortHashesWhenTransactionWithSameShortHashIsRemoved) {
+		// Arrange: first and third transactions have the same short hash
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		std::memcpy(transactionInfos[2].EntityHash.data(), transactionInfos[0].EntityHash.data(), sizeof(utils::ShortHash));
+		test::AddAll(cache, transactionInfos);
+		cache.modifier().remove(transactionInfos[0].EntityHash);
+
+		utils::ShortHashesSet requestedShortHashes;
+		requestedShortHashes.insert(utils::ToShortHash(transactionInfos[0].EntityHash));
+
+		// Act:
+		auto transactions = cache.view().requestedTransactions(BlockFeeMultiplier(0), requestedShortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 3 });
+	}
+
+	TEST(TEST_CLASS, RequestedTransactionsRespectsMaxResponseSize) {
+		// Arrange: max response size allows two transactions
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		auto transactionSize = transactionInfos[0].pEntity->Size;
+		MemoryUtCache cache(MemoryCacheOptions(2 * transactionSize + 1, 1'000));
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet requestedShortHashes;
+		for (auto i : { 1u, 2u, 4u })
+			requestedShortHashes.insert(utils::ToShortHash(transactionInfos[i].EntityHash));
+
+		// Act:
+		auto transactions = cache.view().requestedTransactions(BlockFeeMultiplier(0), requestedShortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 3 });
+	}
+
+	TEST(TEST_CLASS, RequestedTransactionsFiltersTransactionsByFeeMultiplier) {
+		// Arrange: only second and fourth transactions pay a nonzero fee
+		auto transactionSize = test::CreateTransactionInfos(1)[0].pEntity->Size;
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		utils::ShortHashesSet requestedShortHashes;
+		auto i = 0u;
+		for (auto& transactionInfo : transactionInfos) {
+			const_cast<Amount&>(transactionInfo.pEntity->MaxFee) = Amount(transactionSize * (0 == i % 2 ? 0 : 20));
+			requestedShortHashes.insert(utils::ToShortHash(transactionInfo.EntityHash));
+			++i;
+		}
+
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto transactions = cache.view().requestedTransactions(BlockFeeMultiplier(20), requestedShortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 4 });
+	}
+
+	// endregion
+
 	// region unknownTransactions
 
 	namespace {
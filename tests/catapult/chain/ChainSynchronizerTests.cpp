@@ -78,6 +78,7 @@ namespace catapult { namespace chain {
 				config.MaxBlocksPerSyncAttempt = 4 * 100;
 				config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512).bytes32();
 				config.MaxRollbackBlocks = 360;
+				config.MaxPendingBlockRangeRequests = 1;
 				return config;
 			}
 
@@ -624,6 +625,117 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region pipelining
+
+	namespace {
+		auto CreateTestContextForPipeliningTests(const std::vector<uint32_t>& numBlocksPerBlocksFromRequest) {
+			auto context = CreateTestContextForUnprocessedElementTests();
+			context.pChainApi->setNumBlocksPerBlocksFromRequest(numBlocksPerBlocksFromRequest);
+			context.Config.MaxBlocksPerSyncAttempt = 2;
+			context.Config.MaxPendingBlockRangeRequests = 3;
+			return context;
+		}
+	}
+
+	TEST(TEST_CLASS, PipeliningDeliversEachRangeUntilPartialRangeIsReturned) {
+		// Arrange:
+		// - three requests are initially outstanding and a new one is issued after each full range is delivered
+		// - third range is partial, so subsequent (speculative) ranges are discarded
+		auto context = CreateTestContextForPipeliningTests({ 2, 2, 1, 2 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 3);
+		AssertRequestHeights(context, {
+			Default_Height, Default_Height + Height(2), Default_Height + Height(4),
+			Default_Height + Height(6), Default_Height + Height(8)
+		});
+	}
+
+	TEST(TEST_CLASS, PipeliningStopsWhenRemoteRunsOutOfBlocks) {
+		// Arrange:
+		auto context = CreateTestContextForPipeliningTests({ 2, 0 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertRequestHeights(context, {
+			Default_Height, Default_Height + Height(2), Default_Height + Height(4), Default_Height + Height(6)
+		});
+	}
+
+	TEST(TEST_CLASS, PipeliningIsNeutralWhenRemoteDoesNotHaveBlocksAtRequestedHeight) {
+		// Arrange:
+		auto context = CreateTestContextForPipeliningTests({ 0 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		context.assertNoCalls();
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2), Default_Height + Height(4) });
+	}
+
+	TEST(TEST_CLASS, PipeliningIsBoundedByMemoryBudget) {
+		// Arrange: the container's max size is set to (3 + 2) * MaxChainBytesPerSyncAttempt = 5 * sizeof(BlockHeader)
+		//          and one MaxChainBytesPerSyncAttempt is reserved for each outstanding request
+		auto context = CreateTestContextForPipeliningTests({ 2 });
+		context.Config.MaxChainBytesPerSyncAttempt = sizeof(BlockHeader);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: only one additional request fits into the budget after the first range is delivered
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 4);
+		AssertRequestHeights(context, {
+			Default_Height, Default_Height + Height(2), Default_Height + Height(4), Default_Height + Height(6)
+		});
+	}
+
+	TEST(TEST_CLASS, PipeliningFailsWhenBlocksFromReturnsException) {
+		// Arrange:
+		auto context = CreateTestContextForPipeliningTests({ 2 });
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		context.assertNoCalls();
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2), Default_Height + Height(4) });
+	}
+
+	TEST(TEST_CLASS, PipeliningIsBypassedWhenResolvingFork) {
+		// Arrange: common block has height 14 = 20 - 9 + 4 - 1 (fork depth 6)
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		context.Config.MaxPendingBlockRangeRequests = 3;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: fork is delivered as a single range
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context, 1);
+		AssertDefaultMultiplePullRequest(*context.pChainApi, { Height(15), Height(17), Height(19) });
+	}
+
+	// endregion
+
 	// region recoverability
 
 	namespace {
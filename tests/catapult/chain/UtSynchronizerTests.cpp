@@ -26,6 +26,8 @@
 
 namespace catapult { namespace chain {
 
+#define TEST_CLASS UtSynchronizerTests
+
 	namespace {
 		using MockRemoteApi = mocks::MockTransactionApi;
 
@@ -92,4 +94,156 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region sketch
+
+	namespace {
+		class SketchTestContext {
+		public:
+			explicit SketchTestContext(uint32_t numTransactions)
+					: m_transactionApi(test::CreateTransactionEntityRange(numTransactions))
+					, m_numShortHashesSupplierCalls(0)
+					, m_numConsumedTransactions(0)
+					, m_synchronizer(CreateUtSynchronizer(
+							BlockFeeMultiplier(17),
+							[this]() {
+								++m_numShortHashesSupplierCalls;
+								return model::ShortHashRange();
+							},
+							[this](auto numCells) {
+								m_sketchSizes.push_back(numCells);
+								return utils::ShortHashSketch(numCells);
+							},
+							[this](auto&& range) {
+								m_numConsumedTransactions += range.Range.size();
+							}))
+			{}
+
+		public:
+			auto& api() {
+				return m_transactionApi;
+			}
+
+			const auto& sketchSizes() const {
+				return m_sketchSizes;
+			}
+
+			auto numShortHashesSupplierCalls() const {
+				return m_numShortHashesSupplierCalls;
+			}
+
+			auto numConsumedTransactions() const {
+				return m_numConsumedTransactions;
+			}
+
+		public:
+			auto synchronize() {
+				return m_synchronizer(m_transactionApi).get();
+			}
+
+		private:
+			MockRemoteApi m_transactionApi;
+			std::vector<size_t> m_sketchSizes;
+			size_t m_numShortHashesSupplierCalls;
+			size_t m_numConsumedTransactions;
+			RemoteNodeSynchronizer<api::RemoteTransactionApi> m_synchronizer;
+		};
+	}
+
+	TEST(TEST_CLASS, SketchSynchronizerRequestsTransactionsBySketch) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.api().setSketchResult(true, 5);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(3u, context.numConsumedTransactions());
+
+		ASSERT_EQ(1u, context.api().utSketchRequests().size());
+		EXPECT_EQ(BlockFeeMultiplier(17), context.api().utSketchRequests()[0].first);
+		EXPECT_EQ(std::vector<size_t>({ 96 }), context.sketchSizes());
+
+		EXPECT_EQ(0u, context.numShortHashesSupplierCalls());
+		EXPECT_EQ(0u, context.api().utRequests().size());
+	}
+
+	TEST(TEST_CLASS, SketchSynchronizerFallsBackToShortHashesWhenSketchCannotBeDecoded) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.api().setSketchResult(false, 0);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(3u, context.numConsumedTransactions());
+
+		EXPECT_EQ(1u, context.api().utSketchRequests().size());
+		EXPECT_EQ(1u, context.numShortHashesSupplierCalls());
+		ASSERT_EQ(1u, context.api().utRequests().size());
+		EXPECT_EQ(BlockFeeMultiplier(17), context.api().utRequests()[0].first);
+	}
+
+	TEST(TEST_CLASS, SketchSynchronizerFailsWhenSketchRequestFails) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.api().setError(MockRemoteApi::EntryPoint::Unconfirmed_Transactions_By_Sketch);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.numConsumedTransactions());
+		EXPECT_EQ(0u, context.numShortHashesSupplierCalls());
+	}
+
+	TEST(TEST_CLASS, SketchSynchronizerAdaptsSketchSizeToPreviousDifference) {
+		// Arrange:
+		SketchTestContext context(3);
+
+		// Act: decoded difference of 100 yields sketch with 300 cells, each undecodable sketch doubles the next sketch
+		context.api().setSketchResult(true, 100);
+		context.synchronize();
+		context.api().setSketchResult(false, 0);
+		context.synchronize();
+		context.synchronize();
+
+		// - decoded difference of zero yields sketch with minimum size
+		context.api().setSketchResult(true, 0);
+		context.synchronize();
+		context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 96, 300, 600, 1200, 96 }), context.sketchSizes());
+		EXPECT_EQ(2u, context.numShortHashesSupplierCalls());
+	}
+
+	TEST(TEST_CLASS, SketchSynchronizerRequestsTransactionsByShortHashesWhenExpectedDifferenceIsTooLarge) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.api().setSketchResult(true, 20'000);
+		context.synchronize();
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert: the second request was made by short hashes
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(std::vector<size_t>({ 96 }), context.sketchSizes());
+		EXPECT_EQ(1u, context.numShortHashesSupplierCalls());
+		EXPECT_EQ(1u, context.api().utRequests().size());
+
+		// Act: the short hashes request returned three transactions, so sketches are used again
+		context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 96, 96 }), context.sketchSizes());
+	}
+
+	// endregion
 }}
@@ -23,6 +23,7 @@
 #include "catapult/cache_tx/AggregateUtCache.h"
 #include "catapult/cache_tx/MemoryUtCache.h"
 #include "catapult/chain/ChainResults.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/FeeUtils.h"
 #include "catapult/model/TransactionStatus.h"
 #include "tests/test/cache/UtTestUtils.h"
@@ -116,18 +117,19 @@ namespace catapult { namespace chain {
 			size_t UtCacheSize;
 		};
 
-		enum class ThrottleMode { Off, Even };
+		enum class ThrottleMode { Off, Even, Full };
 
 		class UpdaterTestContext {
 		public:
 			explicit UpdaterTestContext(
 					ThrottleMode throttleMode = ThrottleMode::Off,
-					BlockFeeMultiplier minFeeMultiplier = BlockFeeMultiplier())
+					BlockFeeMultiplier minFeeMultiplier = BlockFeeMultiplier(),
+					size_t maxCacheSize = 1000)
 					: m_cache(CreateCacheWithDefaultHeight())
 					, m_pUtChangeSubscriber(std::make_unique<mocks::MockUtChangeSubscriber>())
 					, m_utChangeSubscriber(*m_pUtChangeSubscriber)
 					, m_transactionsCache(
-							cache::MemoryCacheOptions(1024, 1000),
+							cache::MemoryCacheOptions(1024, maxCacheSize),
 							cache::CreateAggregateUtCache,
 							std::move(m_pUtChangeSubscriber))
 					, m_updater(
@@ -140,8 +142,11 @@ namespace catapult { namespace chain {
 								// notice that transaction.Deadline is used as transaction marker
 								m_failedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
 							},
-							[this, throttleMode](const auto& transactionInfo, const auto& context) {
+							[this, throttleMode, maxCacheSize](const auto& transactionInfo, const auto& context) {
 								m_throttleParams.emplace_back(transactionInfo, context);
+								if (ThrottleMode::Full == throttleMode)
+									return context.TransactionsCache.size() >= maxCacheSize;
+
 								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
 							})
 			{}
@@ -155,6 +160,10 @@ namespace catapult { namespace chain {
 				return m_updater;
 			}
 
+			void setValidationResult(ValidationResult result, size_t trigger) {
+				m_executionConfig.pValidator->setResult(result, trigger);
+			}
+
 			void setValidationResult(ValidationResult result, const Hash256& hash, size_t id) {
 				m_executionConfig.pValidator->setResult(result, hash, id);
 			}
@@ -163,10 +172,23 @@ namespace catapult { namespace chain {
 				m_partialUndoFailureIndexes = partialUndoFailureIndexes;
 			}
 
+			std::vector<Timestamp::ValueType> extractRawDeadlines() const {
+				std::vector<Timestamp::ValueType> rawDeadlines;
+				m_transactionsCache.view().forEach([&rawDeadlines](const auto& info) {
+					rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+					return true;
+				});
+				return rawDeadlines;
+			}
+
 			void resetSubscriber() {
 				m_utChangeSubscriber.reset();
 			}
 
+			void emulatePublicKeyNotifications() {
+				m_executionConfig.pNotificationPublisher->emulatePublicKeyNotifications();
+			}
+
 		private:
 			bool isRollbackExecution(size_t index) const {
 				// MockExecutionConfiguration is configured to create two notifications for each entity
@@ -227,11 +249,15 @@ namespace catapult { namespace chain {
 			}
 
 			void assertObserverContexts(size_t numInitialCacheStatistics) const {
+				assertObserverContexts(getExpectedNumStatistics(numInitialCacheStatistics));
+			}
+
+			void assertObserverContexts(const std::vector<size_t>& expectedNumStatistics) const {
 				// Assert:
 				CATAPULT_LOG(debug) << "checking observer contexts passed to observer";
 				test::MockExecutionConfiguration::AssertObserverContexts(
 						*m_executionConfig.pObserver,
-						numInitialCacheStatistics,
+						expectedNumStatistics,
 						Default_Height + Height(1),
 						Default_Last_Recalculation_Height,
 						[this](auto i) { return this->isRollbackExecution(i); });
@@ -262,6 +288,16 @@ namespace catapult { namespace chain {
 				assertContexts({ m_throttleParams.size(), expectedTransactionSource }, expectedNumStatistics);
 			}
 
+			void assertContexts(
+					UtUpdater::TransactionSource expectedTransactionSource,
+					const std::vector<size_t>& expectedValidatorNumStatistics,
+					const std::vector<size_t>& expectedObserverNumStatistics) const {
+				// Assert:
+				assertThrottleContexts({ m_throttleParams.size(), expectedTransactionSource });
+				assertValidatorContexts(expectedValidatorNumStatistics);
+				assertObserverContexts(expectedObserverNumStatistics);
+			}
+
 			void assertContexts(UtUpdater::TransactionSource expectedTransactionSource) const {
 				// Assert:
 				assertContexts(expectedTransactionSource, getExpectedNumStatistics(0));
@@ -375,15 +411,32 @@ namespace catapult { namespace chain {
 					const model::WeakEntityInfos& entityInfos,
 					const std::vector<size_t>& publisherIndexes,
 					const IndexResultPairs& failedIndexes = {}) const {
+				// Assert: publisher, validator and observer were all called with same (filtered) entity infos
+				auto validatorObserverIndexes = GetValidatorObserverIndexes(Select(entityInfos, publisherIndexes));
+				assertEntityInfosWithDuplicates(
+						entityInfos,
+						publisherIndexes,
+						validatorObserverIndexes,
+						validatorObserverIndexes,
+						failedIndexes);
+			}
+
+			// this assert should be used iff entities are filtered out or reexecuted after publishing
+			// notice that validator and observer indexes are relative to the published entity infos
+			void assertEntityInfosWithDuplicates(
+					const model::WeakEntityInfos& entityInfos,
+					const std::vector<size_t>& publisherIndexes,
+					const std::vector<size_t>& validatorIndexes,
+					const std::vector<size_t>& observerIndexes,
+					const IndexResultPairs& failedIndexes = {}) const {
 				// Assert: throttle was called with all entity infos (including duplicates)
 				assertThrottleEntityInfos(entityInfos);
 
-				// - publisher, validator and observer were all called with same (filtered) entity infos
+				// - publisher, validator and observer were called with expected (filtered) entity infos
 				auto publisherEntityInfos = Select(entityInfos, publisherIndexes);
-				auto validatorObserverIndexes = GetValidatorObserverIndexes(publisherEntityInfos);
 				assertPublisherEntityInfos(publisherEntityInfos);
-				assertValidatorEntityInfos(publisherEntityInfos, validatorObserverIndexes);
-				assertObserverEntityInfos(publisherEntityInfos, validatorObserverIndexes);
+				assertValidatorEntityInfos(publisherEntityInfos, validatorIndexes);
+				assertObserverEntityInfos(publisherEntityInfos, observerIndexes);
 
 				// - check that transaction failures were raised
 				assertFailedTransactionStatuses(entityInfos, failedIndexes);
@@ -643,6 +696,129 @@ namespace catapult { namespace chain {
 		context.assertSubscriberCalls({ 1, 9 });
 	}
 
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(ThrottledTransactionsEvictCheaperTransactionsFromFullCache) {
+		// Arrange: throttle transactions when the cache is full
+		UpdaterTestContext context(ThrottleMode::Full, BlockFeeMultiplier(), 3);
+		auto transactionData = CreateTransactionData(5);
+
+		// - set fee multiples
+		auto i = 0u;
+		std::array<uint32_t, 5> feeMultiples{ 20, 10, 30, 5, 40 };
+		for (auto& utInfo : transactionData.UtInfos) {
+			auto multiplier = BlockFeeMultiplier(feeMultiples[i++]);
+			const_cast<Amount&>(utInfo.pEntity->MaxFee) = model::CalculateTransactionFee(multiplier, *utInfo.pEntity);
+		}
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert: the cheapest transaction was evicted by the last transaction
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0, 2, 4 }));
+
+		// - changes made by the evicted transaction are removed by rebasing before the last transaction is executed
+		//   E[0] V0,O1,V1,O2; E[1] V2,O3,V3,O4; E[2] V4,O5,V5,O6; (rebase) E[0] V0,O1,V1,O2; E[2] V2,O3,V3,O4; E[4] V4,O5,V5,O6
+		context.assertContexts(TTraits::TransactionSource, { 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5 }, { 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5 });
+
+		auto failedIndexes = IndexResultPairs{
+			{ 3, Failure_Chain_Unconfirmed_Cache_Too_Full },
+			{ 1, Failure_Chain_Unconfirmed_Cache_Evicted }
+		};
+		context.assertEntityInfosWithDuplicates(transactionData.EntityInfos, { 0, 1, 2, 0, 2, 4 }, failedIndexes);
+
+		// - evicted transaction is not a net change
+		context.assertSubscriberCalls({ 0, 4, 16 });
+	}
+
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(ThrottledTransactionFailingValidationDoesNotEvictCheaperTransaction) {
+		// Arrange: throttle transactions when the cache is full
+		UpdaterTestContext context(ThrottleMode::Full, BlockFeeMultiplier(), 3);
+		auto transactionData = CreateTransactionData(4);
+
+		// - set fee multiples
+		auto i = 0u;
+		std::array<uint32_t, 4> feeMultiples{ 20, 10, 30, 40 };
+		for (auto& utInfo : transactionData.UtInfos) {
+			auto multiplier = BlockFeeMultiplier(feeMultiples[i++]);
+			const_cast<Amount&>(utInfo.pEntity->MaxFee) = model::CalculateTransactionFee(multiplier, *utInfo.pEntity);
+		}
+
+		// - fail validation of the most expensive transaction
+		context.setValidationResult(ValidationResult::Failure, transactionData.Hashes[3], 1);
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert: the cheapest transaction was not evicted and kept its original position
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0, 1, 2 }));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 0, 1, 4 }), context.extractRawDeadlines());
+
+		// - observer only gets called for entities that pass validation
+		// - changes made by the restored transaction are reapplied in order by rebasing again
+		//   E[0] V0,O1,V1,O2; E[1] V2,O3,V3,O4; E[2] V4,O5,V5,O6; (rebase) E[0] V0,O1,V1,O2; E[2] V2,O3,V3,O4; E[3] V4;
+		//   (rebase) E[0] V0,O1,V1,O2; E[1] V2,O3,V3,O4; E[2] V4,O5,V5,O6
+		context.assertContexts(
+				TTraits::TransactionSource,
+				{ 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 0, 1, 2, 3, 4, 5 },
+				{ 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5 });
+		context.assertEntityInfosWithDuplicates(
+				transactionData.EntityInfos,
+				{ 0, 1, 2, 0, 2, 3, 0, 1, 2 },
+				{ 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 6, 6, 7, 7, 8, 8 },
+				{ 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 6, 6, 7, 7, 8, 8 },
+				{ { 3, ValidationResult::Failure } });
+
+		// - neither the failed nor the restored transaction is a net change
+		context.assertSubscriberCalls({ 0, 1, 4 });
+	}
+
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(TransactionsInvalidatedByRebaseAreRemovedFromCache) {
+		// Arrange: throttle transactions when the cache is full
+		UpdaterTestContext context(ThrottleMode::Full, BlockFeeMultiplier(), 3);
+		auto transactionData = CreateTransactionData(4);
+
+		// - set fee multiples
+		auto i = 0u;
+		std::array<uint32_t, 4> feeMultiples{ 20, 10, 30, 40 };
+		for (auto& utInfo : transactionData.UtInfos) {
+			auto multiplier = BlockFeeMultiplier(feeMultiples[i++]);
+			const_cast<Amount&>(utInfo.pEntity->MaxFee) = model::CalculateTransactionFee(multiplier, *utInfo.pEntity);
+		}
+
+		// - fail all validations starting with the first validation of the most expensive transaction
+		context.setValidationResult(ValidationResult::Failure, 11);
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert: all transactions failed validation after the evicted transaction was restored
+		EXPECT_EQ(0u, context.transactionsCache().view().size());
+
+		//   E[0] V0,O1,V1,O2; E[1] V2,O3,V3,O4; E[2] V4,O5,V5,O6; (rebase) E[0] V0,O1,V1,O2; E[2] V2,O3,V3,O4; E[3] V4;
+		//   (rebase) E[0] V0; E[1] V0; E[2] V0
+		context.assertContexts(
+				TTraits::TransactionSource,
+				{ 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 0, 0, 0 },
+				{ 0, 1, 2, 3, 4, 5, 0, 1, 2, 3 });
+
+		auto failedIndexes = IndexResultPairs{
+			{ 3, ValidationResult::Failure },
+			{ 0, ValidationResult::Failure },
+			{ 1, ValidationResult::Failure },
+			{ 2, ValidationResult::Failure }
+		};
+		context.assertEntityInfosWithDuplicates(
+				transactionData.EntityInfos,
+				{ 0, 1, 2, 0, 2, 3, 0, 1, 2 },
+				{ 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 6, 7, 8 },
+				{ 0, 0, 1, 1, 2, 2, 3, 3, 4, 4 },
+				failedIndexes);
+
+		// - no transaction is a net change
+		context.assertSubscriberCalls({});
+	}
+
 	// endregion
 
 	// region shared tests - new transactions that fail validation do not get added / are undone
@@ -1063,4 +1239,111 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region address extraction
+
+	namespace {
+		std::map<Hash256, std::shared_ptr<const model::UnresolvedAddressSet>> GetExtractedAddressesMap(
+				const cache::MemoryUtCacheProxy& transactionsCache) {
+			std::map<Hash256, std::shared_ptr<const model::UnresolvedAddressSet>> extractedAddressesMap;
+			transactionsCache.view().forEach([&extractedAddressesMap](const auto& transactionInfo) {
+				extractedAddressesMap.emplace(transactionInfo.EntityHash, transactionInfo.OptionalExtractedAddresses);
+				return true;
+			});
+
+			return extractedAddressesMap;
+		}
+
+		void ClearExtractedAddresses(std::vector<model::TransactionInfo>& transactionInfos) {
+			for (auto& transactionInfo : transactionInfos)
+				transactionInfo.OptionalExtractedAddresses = nullptr;
+		}
+	}
+
+	TEST(TEST_CLASS, AddressesAreNotExtractedWhenAddressExtractionIsDisabled) {
+		// Arrange:
+		UpdaterTestContext context;
+		context.emulatePublicKeyNotifications();
+
+		auto transactionData = CreateTransactionData(4);
+		ClearExtractedAddresses(transactionData.UtInfos);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert:
+		auto extractedAddressesMap = GetExtractedAddressesMap(context.transactionsCache());
+		ASSERT_EQ(4u, extractedAddressesMap.size());
+
+		for (const auto& pair : extractedAddressesMap)
+			EXPECT_FALSE(!!pair.second) << pair.first;
+	}
+
+	TEST(TEST_CLASS, AddressesAreExtractedFromPublishedNotificationsWhenAddressExtractionIsEnabled) {
+		// Arrange:
+		UpdaterTestContext context;
+		context.emulatePublicKeyNotifications();
+		context.updater().enableAddressExtraction();
+
+		auto transactionData = CreateTransactionData(4);
+		ClearExtractedAddresses(transactionData.UtInfos);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert: mock publisher raises a single public key notification with the transaction hash coerced to public key
+		auto extractedAddressesMap = GetExtractedAddressesMap(context.transactionsCache());
+		ASSERT_EQ(4u, extractedAddressesMap.size());
+
+		for (const auto& transactionInfo : transactionData.UtInfos) {
+			const auto& publicKey = reinterpret_cast<const Key&>(transactionInfo.EntityHash);
+			auto expectedAddress = model::PublicKeyToAddress(publicKey, transactionInfo.pEntity->Network);
+			auto expectedAddresses = model::UnresolvedAddressSet{ expectedAddress.copyTo<UnresolvedAddress>() };
+
+			const auto& pExtractedAddresses = extractedAddressesMap[transactionInfo.EntityHash];
+			ASSERT_TRUE(!!pExtractedAddresses) << transactionInfo.EntityHash;
+			EXPECT_EQ(expectedAddresses, *pExtractedAddresses) << transactionInfo.EntityHash;
+		}
+	}
+
+	TEST(TEST_CLASS, PreviouslyExtractedAddressesAreReusedWhenAddressExtractionIsEnabled) {
+		// Arrange:
+		UpdaterTestContext context;
+		context.emulatePublicKeyNotifications();
+		context.updater().enableAddressExtraction();
+
+		auto transactionData = CreateTransactionData(4);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert: original address sets were not replaced
+		auto extractedAddressesMap = GetExtractedAddressesMap(context.transactionsCache());
+		ASSERT_EQ(4u, extractedAddressesMap.size());
+
+		for (const auto& transactionInfo : transactionData.UtInfos)
+			EXPECT_EQ(transactionInfo.OptionalExtractedAddresses, extractedAddressesMap[transactionInfo.EntityHash]);
+	}
+
+	TEST(TEST_CLASS, ExtractedAddressesAreReusedWhenExistingTransactionsAreReapplied) {
+		// Arrange: add transactions with address extraction enabled
+		UpdaterTestContext context;
+		context.emulatePublicKeyNotifications();
+		context.updater().enableAddressExtraction();
+
+		auto transactionData = CreateTransactionData(4);
+		ClearExtractedAddresses(transactionData.UtInfos);
+		context.updater().update(transactionData.UtInfos);
+		auto originalExtractedAddressesMap = GetExtractedAddressesMap(context.transactionsCache());
+
+		// Act: reapply all transactions
+		context.updater().update({}, {});
+
+		// Assert: address sets extracted when the transactions were first applied were reused
+		auto extractedAddressesMap = GetExtractedAddressesMap(context.transactionsCache());
+		ASSERT_EQ(4u, extractedAddressesMap.size());
+		EXPECT_EQ(originalExtractedAddressesMap, extractedAddressesMap);
+	}
+
+	// endregion
 }}
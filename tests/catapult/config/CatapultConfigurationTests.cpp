@@ -104,12 +104,15 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.EnableSingleThreadPool);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
+			EXPECT_FALSE(config.EnableTransactionsCacheSnapshot);
+			EXPECT_FALSE(config.EnableTransactionsSetReconciliation);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(3u, config.MaxPendingBlockRangeRequests);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -132,6 +135,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
 			EXPECT_EQ(16384u, config.TransactionDisruptorSize);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(1000u, config.TransactionBatchSize);
 
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
@@ -139,6 +143,10 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
+			EXPECT_EQ(100u, config.MaxBlocksPerRecoveryCommit);
+			EXPECT_EQ(Height(), config.TrustedCheckpointHeight);
+			EXPECT_EQ(Hash256(), config.TrustedCheckpointHash);
+
 			EXPECT_EQ("/dev/urandom", config.BatchVerificationRandomSource);
 
 			EXPECT_TRUE(config.TrustedHosts.empty());
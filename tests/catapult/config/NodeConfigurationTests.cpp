@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/config/NodeConfiguration.h"
+#include "catapult/utils/HexParser.h"
 #include "tests/test/nodeps/ConfigurationTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -42,12 +43,15 @@ namespace catapult { namespace config {
 							{ "enableSingleThreadPool", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
+							{ "enableTransactionsCacheSnapshot", "true" },
+							{ "enableTransactionsSetReconciliation", "true" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxPendingBlockRangeRequests", "6" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -70,6 +74,7 @@ namespace catapult { namespace config {
 							{ "blockElementTraceInterval", "34" },
 							{ "transactionDisruptorSize", "9876" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "transactionBatchSize", "765" },
 
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
@@ -77,6 +82,10 @@ namespace catapult { namespace config {
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
 							{ "maxTrackedNodes", "222" },
 
+							{ "maxBlocksPerRecoveryCommit", "87" },
+							{ "trustedCheckpointHeight", "12'345" },
+							{ "trustedCheckpointHash", "7FF1C15B1EAA3F3F0E8CF2B6E52C7A0C6C6E4A3D8A3E0C6E0B9F4D2A8C71E63A" },
+
 							{ "batchVerificationRandomSource", "/dev/random" },
 
 							{ "trustedHosts", "foo,BAR" },
@@ -140,12 +149,15 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableSingleThreadPool);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
+				EXPECT_FALSE(config.EnableTransactionsCacheSnapshot);
+				EXPECT_FALSE(config.EnableTransactionsSetReconciliation);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxPendingBlockRangeRequests);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -168,6 +180,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
 				EXPECT_EQ(0u, config.TransactionDisruptorSize);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(0u, config.TransactionBatchSize);
 
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
@@ -175,6 +188,10 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
+				EXPECT_EQ(0u, config.MaxBlocksPerRecoveryCommit);
+				EXPECT_EQ(Height(), config.TrustedCheckpointHeight);
+				EXPECT_EQ(Hash256(), config.TrustedCheckpointHash);
+
 				EXPECT_EQ("", config.BatchVerificationRandomSource);
 
 				EXPECT_TRUE(config.TrustedHosts.empty());
@@ -215,12 +232,15 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableSingleThreadPool);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
+				EXPECT_TRUE(config.EnableTransactionsCacheSnapshot);
+				EXPECT_TRUE(config.EnableTransactionsSetReconciliation);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(6u, config.MaxPendingBlockRangeRequests);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -243,6 +263,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
 				EXPECT_EQ(9876u, config.TransactionDisruptorSize);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(765u, config.TransactionBatchSize);
 
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
@@ -250,6 +271,10 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
+				EXPECT_EQ(87u, config.MaxBlocksPerRecoveryCommit);
+				EXPECT_EQ(Height(12'345), config.TrustedCheckpointHeight);
+				EXPECT_EQ(utils::ParseByteArray<Hash256>("7FF1C15B1EAA3F3F0E8CF2B6E52C7A0C6C6E4A3D8A3E0C6E0B9F4D2A8C71E63A"), config.TrustedCheckpointHash);
+
 				EXPECT_EQ("/dev/random", config.BatchVerificationRandomSource);
 
 				EXPECT_EQ(std::unordered_set<std::string>({ "foo", "BAR" }), config.TrustedHosts);
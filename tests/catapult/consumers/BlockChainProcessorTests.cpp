@@ -19,18 +19,26 @@
 **/
 
 #include "catapult/consumers/BlockChainProcessor.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockStatisticCache.h"
 #include "catapult/chain/ChainResults.h"
 #include "catapult/consumers/InputUtils.h"
+#include "catapult/ionet/IoTypes.h"
+#include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/utils/MemoryUtils.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 using namespace catapult::validators;
 using catapult::disruptor::BlockElements;
@@ -204,16 +212,19 @@ namespace catapult { namespace consumers {
 
 		struct ProcessorTestContext {
 		public:
-			explicit ProcessorTestContext(ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled)
+			explicit ProcessorTestContext(
+					ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled,
+					const std::shared_ptr<thread::IoThreadPool>& pPool = nullptr)
 					: BlockHitPredicateFactory(BlockHitPredicate) {
-				Processor = CreateBlockChainProcessor(
-						[this](const auto& cache) {
-							return BlockHitPredicateFactory(cache);
-						},
-						[this](auto height, auto timestamp, const auto& entities, auto& state) {
-							return BatchEntityProcessor(height, timestamp, entities, state);
-						},
-						receiptValidationMode);
+				consumers::BlockHitPredicateFactory blockHitPredicateFactory = [this](const auto& cache) {
+					return BlockHitPredicateFactory(cache);
+				};
+				chain::BatchEntityProcessor batchEntityProcessor = [this](auto height, auto timestamp, const auto& entities, auto& state) {
+					return BatchEntityProcessor(height, timestamp, entities, state);
+				};
+				Processor = pPool
+						? CreateBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, pPool)
+						: CreateBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
 			}
 
 		public:
@@ -221,13 +232,16 @@ namespace catapult { namespace consumers {
 			MockBlockHitPredicateFactory BlockHitPredicateFactory;
 			MockBatchEntityProcessor BatchEntityProcessor;
 			BlockChainProcessor Processor;
+			bool IsVerifiableStateEnabled = false;
 
 		public:
 			ValidationResult Process(
 					const model::BlockElement& parentBlockElement,
 					BlockElements& elements,
 					const std::function<PrepareAccountMode (Height)>& lookupPrepareAccountMode) {
-				auto cache = test::CreateCatapultCacheWithMarkerAccount();
+				auto cache = IsVerifiableStateEnabled
+						? CreateCatapultCacheWithMerkleSubCaches()
+						: test::CreateCatapultCacheWithMarkerAccount();
 				auto cacheDelta = cache.createDelta();
 
 				// set vrf keys for all block signers
@@ -243,6 +257,15 @@ namespace catapult { namespace consumers {
 					previousGenerationHash = model::CalculateGenerationHash(element.Block.GenerationHashProof.Gamma);
 				}
 
+				// set expected state hashes calculated serially
+				// (merkle roots only depend on height because the batch entity processor does not modify merkle sub caches)
+				if (IsVerifiableStateEnabled) {
+					for (auto& element : elements) {
+						auto& block = const_cast<model::Block&>(element.Block);
+						block.StateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
+					}
+				}
+
 				cacheDelta.dependentState().LastRecalculationHeight = Default_Last_Recalculation_Height;
 				auto observerState = observers::ObserverState(cacheDelta);
 
@@ -267,6 +290,30 @@ namespace catapult { namespace consumers {
 			}
 
 		private:
+			template<size_t CacheId>
+			static void AddMerkleSubCache(cache::CatapultCacheBuilder& builder) {
+				auto pSubCache = std::make_unique<test::SimpleCacheT<CacheId>>(test::SimpleCacheViewMode::Merkle_Root);
+				builder.add<test::SimpleCacheStorageTraits>(std::move(pSubCache));
+			}
+
+			static cache::CatapultCache CreateCatapultCacheWithMerkleSubCaches() {
+				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(2);
+				test::CoreSystemCacheFactory::CreateSubCaches(model::BlockChainConfiguration::Uninitialized(), subCaches);
+
+				// add multiple sub caches supporting merkle roots so that merkle roots can be updated in parallel
+				cache::CatapultCacheBuilder builder;
+				for (auto& pSubCache : subCaches)
+					builder.add(std::move(pSubCache));
+
+				AddMerkleSubCache<2>(builder);
+				AddMerkleSubCache<3>(builder);
+				AddMerkleSubCache<4>(builder);
+
+				auto cache = builder.build();
+				test::AddMarkerAccount(cache);
+				return cache;
+			}
+
 			static crypto::KeyPair PrepareAccount(
 					cache::AccountStateCacheDelta& accountStateCacheDelta,
 					const Key& signerPublicKey,
@@ -525,6 +572,81 @@ namespace catapult { namespace consumers {
 		AssertCanProcessValidBlocksWithRemoteHarvester(3, 1); // block 2/3 has remote harvester
 	}
 
+	namespace {
+		void AssertCanProcessBlockChainWithVerifiableState(const std::shared_ptr<thread::IoThreadPool>& pPool) {
+			// Arrange:
+			ProcessorTestContext context(ReceiptValidationMode::Disabled, pPool);
+			context.IsVerifiableStateEnabled = true;
+			auto pParentBlock = test::GenerateEmptyRandomBlock();
+			auto pBlock1 = test::GenerateBlockWithTransactions(3, Height(12));
+			auto pBlock2 = test::GenerateBlockWithTransactions(2, Height(13));
+			auto elements = test::CreateBlockElements({ pBlock1.get(), pBlock2.get() });
+			PrepareChain(Height(11), *pParentBlock, elements);
+
+			// Act:
+			auto result = context.Process(*pParentBlock, elements);
+
+			// Assert: state hashes are nonzero and distinct, so a mismatch with the serially calculated state hashes would fail
+			EXPECT_EQ(ValidationResult::Success, result);
+			EXPECT_NE(Hash256(), elements[0].Block.StateHash);
+			EXPECT_NE(elements[0].Block.StateHash, elements[1].Block.StateHash);
+			EXPECT_EQ(2u, context.BlockHitPredicate.params().size());
+			EXPECT_EQ(2u, context.BatchEntityProcessor.params().size());
+			context.assertBlockHitPredicateCalls(*pParentBlock, elements);
+			context.assertBatchEntityProcessorCalls(elements);
+		}
+	}
+
+	TEST(TEST_CLASS, CanProcessBlockChainWithVerifiableState) {
+		AssertCanProcessBlockChainWithVerifiableState(nullptr);
+	}
+
+	TEST(TEST_CLASS, CanProcessBlockChainWithVerifiableStateWhenStateHashIsCalculatedWithPool) {
+		// Arrange:
+		auto pPool = utils::UniqueToShared(test::CreateStartedIoThreadPool());
+
+		// Act + Assert: state hashes calculated with pool match state hashes calculated serially
+		AssertCanProcessBlockChainWithVerifiableState(pPool);
+		pPool->join();
+	}
+
+	TEST(TEST_CLASS, StateHashIsCalculatedWithPoolWhenPoolIsProvided) {
+		// Arrange: block the only pool thread until released
+		auto pPool = utils::UniqueToShared(test::CreateStartedIoThreadPool(1));
+		std::atomic_bool isPoolReleased(false);
+		boost::asio::post(pPool->ioContext(), [&isPoolReleased]() {
+			while (!isPoolReleased)
+				test::Pause();
+		});
+
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, pPool);
+		context.IsVerifiableStateEnabled = true;
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(1);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// Act: process on a separate thread
+		std::atomic_bool isProcessed(false);
+		auto result = ValidationResult::Failure;
+		std::thread processThread([&context, &pParentBlock, &elements, &isProcessed, &result]() {
+			result = context.Process(*pParentBlock, elements);
+			isProcessed = true;
+		});
+
+		// - processing cannot complete while the pool is blocked
+		test::Sleep(50);
+		auto isProcessedBeforeRelease = static_cast<bool>(isProcessed);
+
+		isPoolReleased = true;
+		processThread.join();
+		pPool->join();
+
+		// Assert:
+		EXPECT_FALSE(isProcessedBeforeRelease);
+		EXPECT_TRUE(isProcessed);
+		EXPECT_EQ(ValidationResult::Success, result);
+	}
+
 	// endregion
 
 	// region invalid - unlinked
@@ -28,6 +28,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/test/nodeps/TestConstants.h"
@@ -150,14 +151,25 @@ namespace catapult { namespace consumers {
 			EXPECT_EQ(numExpectedTransactions, numTransactions);
 		}
 
-		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+		disruptor::BlockConsumer CreateConsumer(
+				const model::TransactionRegistry& registry,
+				const std::shared_ptr<thread::IoThreadPool>& pPool) {
+			return pPool
+					? CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, pPool)
+					: CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry);
+		}
+
+		void AssertBlockHashesAreCalculatedCorrectly(
+				uint32_t numBlocks,
+				uint32_t numTransactionsPerBlock,
+				const std::shared_ptr<thread::IoThreadPool>& pPool = nullptr) {
 			// Arrange:
 			auto registry = CustomBuffersTraits::CreateTransactionRegistry();
 			auto input = CreateBlockConsumerInput(registry, numBlocks, numTransactionsPerBlock);
 			auto& blockElements = input.blocks();
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry)(blockElements);
+			auto result = CreateConsumer(registry, pPool)(blockElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -226,7 +238,8 @@ namespace catapult { namespace consumers {
 		void AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(
 				uint32_t numBlocks,
 				uint32_t numTransactionsPerBlock,
-				uint32_t mismatchedIndex) {
+				uint32_t mismatchedIndex,
+				const std::shared_ptr<thread::IoThreadPool>& pPool = nullptr) {
 			// Arrange: corrupt the block transactions hash
 			auto registry = mocks::CreateDefaultTransactionRegistry();
 			auto input = CreateBlockConsumerInput(numBlocks, numTransactionsPerBlock);
@@ -234,7 +247,7 @@ namespace catapult { namespace consumers {
 			const_cast<model::Block&>(blockElements[mismatchedIndex].Block).TransactionsHash[0] ^= 0xFF;
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry)(blockElements);
+			auto result = CreateConsumer(registry, pPool)(blockElements);
 
 			// Assert: the elements were skipped because a block transactions hash didn't match
 			test::AssertAborted(result, Failure_Consumer_Block_Transactions_Hash_Mismatch, disruptor::ConsumerResultSeverity::Failure);
@@ -253,6 +266,44 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region BlockHashCalculatorConsumer - parallel
+
+	TEST(BLOCK_TEST_CLASS, CanProcessSmallEntitiesWithPool) {
+		// Arrange: too few transactions to partition
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+
+		// Assert:
+		AssertBlockHashesAreCalculatedCorrectly(3, 4, pPool);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithPartitionedTransactions) {
+		// Arrange: transactions are partitioned across blocks
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+
+		// Assert:
+		AssertBlockHashesAreCalculatedCorrectly(5, 101, pPool);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessLargeEntityWithParallelMerkleTree) {
+		// Arrange: odd number of transactions above parallel merkle layer threshold
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+
+		// Assert:
+		AssertBlockHashesAreCalculatedCorrectly(1, 2345, pPool);
+	}
+
+	TEST(BLOCK_TEST_CLASS, EntitiesAreSkippedWhenAnyBlockTransactionsHashDoesNotMatchWithPool) {
+		// Arrange:
+		std::shared_ptr<thread::IoThreadPool> pPool = test::CreateStartedIoThreadPool(4);
+
+		// Assert:
+		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(3, 4, 1, pPool);
+		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(3, 101, 2, pPool);
+		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(2, 1500, 0, pPool);
+	}
+
+	// endregion
+
 	// region TransactionHashCalculatorConsumer
 
 	namespace {
@@ -287,6 +287,54 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region final - layer hasher
+
+	namespace {
+		std::pair<Hash256, std::vector<size_t>> CalculateMerkleHashWithCapturingLayerHasher(const Hashes& hashes) {
+			// Arrange:
+			MerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			// Act: delegate to sha3 so that the merkle hash is unchanged
+			Hash256 merkleHash;
+			std::vector<size_t> layerSizes;
+			builder.final(merkleHash, [&layerSizes](const auto& layerBuffers, auto& layerHashes) {
+				layerSizes.push_back(layerBuffers.size());
+				for (auto i = 0u; i < layerHashes.size(); ++i) {
+					Sha3_256_Builder pairHashBuilder;
+					pairHashBuilder.update({ layerBuffers[2 * i], layerBuffers[2 * i + 1] });
+					pairHashBuilder.final(layerHashes[i]);
+				}
+			});
+
+			return std::make_pair(merkleHash, layerSizes);
+		}
+	}
+
+	TEST(TEST_CLASS, LayerHasherIsNotCalledForZeroHashes) {
+		// Act:
+		auto resultPair = CalculateMerkleHashWithCapturingLayerHasher({});
+
+		// Assert:
+		EXPECT_EQ(Hash256(), resultPair.first);
+		EXPECT_TRUE(resultPair.second.empty());
+	}
+
+	TEST(TEST_CLASS, LayerHasherIsCalledForEachLayer) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(5);
+
+		// Act:
+		auto resultPair = CalculateMerkleHashWithCapturingLayerHasher(seedHashes);
+
+		// Assert: odd layers are padded
+		EXPECT_EQ(CalculateMerkleResult<MerkleHashTraits>(seedHashes), resultPair.first);
+		EXPECT_EQ(std::vector<size_t>({ 6, 4, 2 }), resultPair.second);
+	}
+
+	// endregion
+
 	// region treeSize
 
 	TEST(TEST_CLASS, TreeSizeReturnsExpectedValue) {
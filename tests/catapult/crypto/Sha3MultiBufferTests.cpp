@@ -0,0 +1,174 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/Sha3MultiBuffer.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/utils/HexParser.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS Sha3MultiBufferTests
+
+	namespace {
+		std::vector<std::vector<uint8_t>> GenerateRandomBuffers(const std::vector<size_t>& sizes) {
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto size : sizes)
+				buffers.push_back(test::GenerateRandomVector(size));
+
+			return buffers;
+		}
+
+		std::vector<Hash256> CalculateExpectedHashes(const std::vector<std::vector<uint8_t>>& buffers) {
+			std::vector<Hash256> hashes(buffers.size());
+			for (auto i = 0u; i < buffers.size(); ++i)
+				Sha3_256(buffers[i], hashes[i]);
+
+			return hashes;
+		}
+
+		void AssertMultiHashesMatchSingleHashes(const std::vector<size_t>& sizes) {
+			// Arrange:
+			auto buffers = GenerateRandomBuffers(sizes);
+			std::vector<RawBuffer> dataBuffers(buffers.cbegin(), buffers.cend());
+
+			// Act:
+			std::vector<Hash256> hashes(buffers.size());
+			Sha3_256Multi(dataBuffers.data(), hashes.data(), hashes.size());
+
+			// Assert:
+			EXPECT_EQ(CalculateExpectedHashes(buffers), hashes);
+		}
+	}
+
+	// region Sha3_256MultiLaneCount
+
+	TEST(TEST_CLASS, LaneCountIsFourOrEight) {
+		// Act:
+		auto laneCount = Sha3_256MultiLaneCount();
+
+		// Assert:
+		EXPECT_TRUE(4u == laneCount || 8u == laneCount) << laneCount;
+	}
+
+	// endregion
+
+	// region Sha3_256Multi
+
+	TEST(TEST_CLASS, CanHashZeroBuffers) {
+		// Arrange:
+		Hash256 hash{};
+
+		// Act:
+		Sha3_256Multi(nullptr, &hash, 0);
+
+		// Assert: output is unchanged
+		EXPECT_EQ(Hash256(), hash);
+	}
+
+	TEST(TEST_CLASS, CanHashEmptyBuffers) {
+		// Arrange:
+		std::vector<RawBuffer> dataBuffers(5);
+
+		// Act:
+		std::vector<Hash256> hashes(dataBuffers.size());
+		Sha3_256Multi(dataBuffers.data(), hashes.data(), hashes.size());
+
+		// Assert:
+		auto expectedHash = utils::ParseByteArray<Hash256>("A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A");
+		for (const auto& hash : hashes)
+			EXPECT_EQ(expectedHash, hash);
+	}
+
+	TEST(TEST_CLASS, CanHashSingleBuffer) {
+		AssertMultiHashesMatchSingleHashes({ 123 });
+	}
+
+	TEST(TEST_CLASS, CanHashFewerBuffersThanLanes) {
+		AssertMultiHashesMatchSingleHashes({ 17, 64 });
+	}
+
+	TEST(TEST_CLASS, CanHashBuffersWithSizesAroundRate) {
+		AssertMultiHashesMatchSingleHashes({ 135, 136, 137, 271, 272, 273, 0, 1 });
+	}
+
+	TEST(TEST_CLASS, CanHashMoreBuffersThanLanesWithEqualSizes) {
+		AssertMultiHashesMatchSingleHashes(std::vector<size_t>(25, 64));
+	}
+
+	TEST(TEST_CLASS, CanHashMoreBuffersThanLanesWithDifferentSizes) {
+		// Arrange: mix short and long buffers so that lanes finish at different times
+		std::vector<size_t> sizes;
+		for (auto i = 0u; i < 37; ++i)
+			sizes.push_back(0 == i % 5 ? 1000 + i : i * 11);
+
+		// Assert:
+		AssertMultiHashesMatchSingleHashes(sizes);
+	}
+
+	// endregion
+
+	// region Sha3_256MultiPart
+
+	TEST(TEST_CLASS, MultiPartHashesAreEqualToHashesOfConcatenatedParts) {
+		// Arrange: three parts per message, including empty parts and parts that span block boundaries
+		constexpr auto Num_Parts = 3u;
+		std::vector<size_t> sizes{ 32, 64, 0, 200, 0, 90, 0, 0, 0, 1, 135, 1, 64, 32, 500, 7, 8, 9 };
+		auto buffers = GenerateRandomBuffers(sizes);
+		std::vector<RawBuffer> dataBuffers(buffers.cbegin(), buffers.cend());
+
+		std::vector<std::vector<uint8_t>> concatenatedBuffers;
+		for (auto i = 0u; i < buffers.size(); i += Num_Parts) {
+			concatenatedBuffers.emplace_back();
+			for (auto j = 0u; j < Num_Parts; ++j)
+				concatenatedBuffers.back().insert(concatenatedBuffers.back().end(), buffers[i + j].cbegin(), buffers[i + j].cend());
+		}
+
+		// Act:
+		std::vector<Hash256> hashes(concatenatedBuffers.size());
+		Sha3_256MultiPart(dataBuffers.data(), Num_Parts, hashes.data(), hashes.size());
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedHashes(concatenatedBuffers), hashes);
+	}
+
+	TEST(TEST_CLASS, MultiPartCanHashSingleMessage) {
+		// Arrange:
+		auto buffers = GenerateRandomBuffers({ 64, 32, 150 });
+		std::vector<RawBuffer> dataBuffers(buffers.cbegin(), buffers.cend());
+
+		Sha3_256_Builder builder;
+		for (const auto& buffer : buffers)
+			builder.update(buffer);
+
+		Hash256 expectedHash;
+		builder.final(expectedHash);
+
+		// Act:
+		Hash256 hash;
+		Sha3_256MultiPart(dataBuffers.data(), dataBuffers.size(), &hash, 1);
+
+		// Assert:
+		EXPECT_EQ(expectedHash, hash);
+	}
+
+	// endregion
+}}
@@ -62,4 +62,63 @@ namespace catapult { namespace deltaset {
 
 	DEFINE_UPDATE_SET_TESTS(MemoryStorageTraits)
 	DEFINE_MEMORY_ONLY_UPDATE_SET_TESTS(MemoryStorageTraits)
+
+	TEST(TEST_CLASS, DeltaCopiesAreAppliedToOriginalElementsInPlace) {
+		// Arrange:
+		MemoryStorageTraits::TestContext context;
+		MemoryStorageTraits::AddElement(context.Copied, "aaa", 1, 10);
+		MemoryStorageTraits::AddElement(context.Copied, "ccc", 3, 11);
+
+		const auto* pOriginalElementAaa = &context.Set.find(std::make_pair("aaa", 1u))->second;
+		const auto* pOriginalElementCcc = &context.Set.find(std::make_pair("ccc", 3u))->second;
+
+		// Act:
+		MemoryStorageTraits::CommitPolicy::Update(context.Set, context.deltas());
+
+		// Assert: copied values were assigned to the existing elements
+		EXPECT_EQ(3u, context.Set.size());
+		EXPECT_EQ(pOriginalElementAaa, &context.Set.find(std::make_pair("aaa", 1u))->second);
+		EXPECT_EQ(pOriginalElementCcc, &context.Set.find(std::make_pair("ccc", 3u))->second);
+		EXPECT_EQ(10u, pOriginalElementAaa->Dummy);
+		EXPECT_EQ(11u, pOriginalElementCcc->Dummy);
+	}
+
+	namespace {
+		size_t CommitAddedElementsToUnorderedStorage(Types::MemoryMapType& set, size_t numAddedElements) {
+			test::DeltaElementsTestUtils::Wrapper<Types::MemoryMapType> deltaWrapper;
+			for (auto i = 0u; i < numAddedElements; ++i)
+				MemoryStorageTraits::AddElement(deltaWrapper.Added, "added", static_cast<unsigned int>(set.size() + i));
+
+			UpdateSet<Types::StorageTraits::KeyTraits>(set, deltaWrapper.deltas());
+			return set.bucket_count();
+		}
+	}
+
+	TEST(TEST_CLASS, AddingElementsToUnorderedStorageDoesNotShrinkBuckets) {
+		// Arrange: reserve many more buckets than are needed
+		Types::MemoryMapType set;
+		set.reserve(1000);
+		auto numBuckets = set.bucket_count();
+
+		// Act:
+		auto numBucketsAfterCommit = CommitAddedElementsToUnorderedStorage(set, 3);
+
+		// Assert:
+		EXPECT_EQ(3u, set.size());
+		EXPECT_EQ(numBuckets, numBucketsAfterCommit);
+	}
+
+	TEST(TEST_CLASS, AddingElementsToUnorderedStorageGrowsBucketsWhenNeeded) {
+		// Arrange:
+		Types::MemoryMapType set;
+		auto numBuckets = set.bucket_count();
+
+		// Act:
+		auto numBucketsAfterCommit = CommitAddedElementsToUnorderedStorage(set, 1000);
+
+		// Assert:
+		EXPECT_EQ(1000u, set.size());
+		EXPECT_LT(numBuckets, numBucketsAfterCommit);
+		EXPECT_LE(1000.f, static_cast<float>(numBucketsAfterCommit) * set.max_load_factor());
+	}
 }}
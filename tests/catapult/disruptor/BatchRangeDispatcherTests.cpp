@@ -290,4 +290,100 @@ namespace catapult { namespace disruptor {
 	}
 
 	// endregion
+
+	// region max batch size
+
+	namespace {
+		void QueueRangesFromDifferentSources(BatchBlockRangeDispatcher& batchDispatcher) {
+			batchDispatcher.queue(CreateBlockEntityRange(3, Height(6)), InputSource::Local);
+			batchDispatcher.queue(CreateBlockEntityRange(2, Height(10)), InputSource::Remote_Push);
+			batchDispatcher.queue(CreateBlockEntityRange(4, Height(7)), InputSource::Local);
+		}
+	}
+
+	TEST(TEST_CLASS, QueueDoesNotDispatchWhenMaxBatchSizeIsZero) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto& inputs) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, Default_Equality_Strategy, 0);
+
+			// Act:
+			for (auto i = 0u; i < 10; ++i)
+				QueueRangesFromDifferentSources(batchDispatcher);
+
+			// Assert:
+			EXPECT_FALSE(batchDispatcher.empty());
+			EXPECT_EQ(0u, dispatcher.numAddedElements());
+			EXPECT_EQ(0u, inputs.size());
+		});
+	}
+
+	TEST(TEST_CLASS, QueueDoesNotDispatchWhenMaxBatchSizeIsNotReached) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto& inputs) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, Default_Equality_Strategy, 10);
+
+			// Act: queue 9 blocks
+			QueueRangesFromDifferentSources(batchDispatcher);
+
+			// Assert:
+			EXPECT_FALSE(batchDispatcher.empty());
+			EXPECT_EQ(0u, dispatcher.numAddedElements());
+			EXPECT_EQ(0u, inputs.size());
+		});
+	}
+
+	TEST(TEST_CLASS, QueueDispatchesAllQueuedRangesWhenMaxBatchSizeIsReached) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto& inputs) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, Default_Equality_Strategy, 10);
+			QueueRangesFromDifferentSources(batchDispatcher);
+
+			// Act: queue 10th block
+			batchDispatcher.queue(CreateBlockEntityRange(1, Height(50)), InputSource::Remote_Pull);
+
+			// Assert: ranges are still grouped by source
+			AssertNumForwardedInputs(dispatcher, batchDispatcher, inputs, 3);
+
+			AssertDispatchedInput(inputs, InputSource::Local, { 6, 7, 8, 7, 8, 9, 10 });
+			AssertDispatchedInput(inputs, InputSource::Remote_Pull, { 50 });
+			AssertDispatchedInput(inputs, InputSource::Remote_Push, { 10, 11 });
+		});
+	}
+
+	TEST(TEST_CLASS, QueueDispatchesAllQueuedRangesWhenMaxBatchSizeIsExceeded) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto& inputs) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, Default_Equality_Strategy, 10);
+			QueueRangesFromDifferentSources(batchDispatcher);
+
+			// Act: queue 10th - 12th blocks
+			batchDispatcher.queue(CreateBlockEntityRange(3, Height(50)), InputSource::Local);
+
+			// Assert:
+			AssertNumForwardedInputs(dispatcher, batchDispatcher, inputs, 2);
+
+			AssertDispatchedInput(inputs, InputSource::Local, { 6, 7, 8, 7, 8, 9, 10, 50, 51, 52 });
+			AssertDispatchedInput(inputs, InputSource::Remote_Push, { 10, 11 });
+		});
+	}
+
+	TEST(TEST_CLASS, QueueRestartsBatchAfterDispatch) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto& inputs) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, Default_Equality_Strategy, 10);
+			QueueRangesFromDifferentSources(batchDispatcher);
+			batchDispatcher.queue(CreateBlockEntityRange(1, Height(50)), InputSource::Remote_Pull);
+			WAIT_FOR_VALUE_EXPR(3u, inputs.size());
+
+			// Act: queue 9 more blocks
+			QueueRangesFromDifferentSources(batchDispatcher);
+
+			// Assert: no additional elements were dispatched
+			EXPECT_FALSE(batchDispatcher.empty());
+			EXPECT_EQ(3u, dispatcher.numAddedElements());
+			EXPECT_EQ(3u, inputs.size());
+		});
+	}
+
+	// endregion
 }}
@@ -25,6 +25,8 @@
 #include "tests/test/nodeps/Functional.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <set>
 
 namespace catapult { namespace disruptor {
 
@@ -455,6 +457,54 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsFromMultipleProducers) {
+		// Arrange:
+		constexpr auto Num_Producers = 8u;
+		constexpr auto Num_Elements_Per_Producer = 50u;
+		CollectedHeights collectedHeights[2];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act: push elements from multiple threads concurrently
+		std::vector<std::vector<DisruptorElementId>> ids(Num_Producers);
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.create_thread([&dispatcher, &producerIds = ids[i]]() {
+				auto ranges = test::PrepareRanges(Num_Elements_Per_Producer);
+				for (auto& range : ranges)
+					producerIds.push_back(dispatcher.processElement(ConsumerInput(std::move(range))));
+			});
+		}
+
+		threads.join_all();
+		WAIT_FOR_VALUE_EXPR(Num_Producers * Num_Elements_Per_Producer, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all ids are unique and consecutive
+		std::set<DisruptorElementId> allIds;
+		for (const auto& producerIds : ids) {
+			EXPECT_TRUE(std::is_sorted(producerIds.cbegin(), producerIds.cend()));
+			allIds.insert(producerIds.cbegin(), producerIds.cend());
+		}
+
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, allIds.size());
+		EXPECT_EQ(1u, *allIds.cbegin());
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, *allIds.crbegin());
+
+		// - all consumers and the inspector observed elements in the same order
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, dispatcher.numAddedElements());
+		EXPECT_EQ(inspectedHeights.get(), collectedHeights[0].get());
+		EXPECT_EQ(inspectedHeights.get(), collectedHeights[1].get());
+		EXPECT_EQ(
+				std::vector<CompletionStatus>(Num_Producers * Num_Elements_Per_Producer, CompletionStatus::Normal),
+				inspectedStatuses);
+	}
+
 	// endregion
 
 	// region element marking
@@ -206,4 +206,128 @@ namespace catapult { namespace disruptor {
 				EXPECT_TRUE(disruptor.isSkipped(i));
 		}
 	}
+
+	// region tryClaim / publish
+
+	TEST(TEST_CLASS, TryClaimReturnsConsecutiveIdsWhenDisruptorHasSpace) {
+		// Arrange:
+		Disruptor disruptor(16);
+
+		// Act:
+		auto id1 = disruptor.tryClaim(0);
+		auto id2 = disruptor.tryClaim(0);
+		auto id3 = disruptor.tryClaim(0);
+
+		// Assert: claimed elements are added but not published
+		EXPECT_EQ(1u, id1);
+		EXPECT_EQ(2u, id2);
+		EXPECT_EQ(3u, id3);
+		EXPECT_EQ(3u, disruptor.added());
+		EXPECT_EQ(0u, disruptor.published());
+		EXPECT_EQ(0u, disruptor.size());
+	}
+
+	TEST(TEST_CLASS, TryClaimFailsWhenDisruptorIsFull) {
+		// Arrange: claim all but one slot (one slot is always kept free)
+		Disruptor disruptor(16);
+		for (auto i = 0u; i < 15; ++i)
+			disruptor.tryClaim(0);
+
+		// Act:
+		auto id = disruptor.tryClaim(0);
+
+		// Assert:
+		EXPECT_EQ(0u, id);
+		EXPECT_EQ(15u, disruptor.added());
+	}
+
+	TEST(TEST_CLASS, TryClaimSucceedsWhenMinPositionAdvances) {
+		// Arrange:
+		Disruptor disruptor(16);
+		for (auto i = 0u; i < 15; ++i)
+			disruptor.tryClaim(0);
+
+		// Act:
+		auto id = disruptor.tryClaim(1);
+
+		// Assert:
+		EXPECT_EQ(16u, id);
+		EXPECT_EQ(16u, disruptor.added());
+	}
+
+	TEST(TEST_CLASS, CanPublishClaimedElement) {
+		// Arrange:
+		Disruptor disruptor(16);
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		pBlock->Height = Height(123);
+		auto id = disruptor.tryClaim(0);
+
+		// Act:
+		disruptor.publish(id, ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock))), [](auto, auto) {});
+
+		// Assert:
+		EXPECT_EQ(1u, disruptor.added());
+		EXPECT_EQ(1u, disruptor.published());
+		EXPECT_EQ(1u, disruptor.size());
+		EXPECT_EQ(1u, disruptor.elementAt(0).id());
+		EXPECT_EQ(Height(123), disruptor.elementAt(0).input().blocks()[0].Block.Height);
+	}
+
+	TEST(TEST_CLASS, PublishWaitsForElementsWithLowerIds) {
+		// Arrange:
+		Disruptor disruptor(16);
+		auto id1 = disruptor.tryClaim(0);
+		auto id2 = disruptor.tryClaim(0);
+
+		// Act: publish second element first
+		std::atomic_bool isPublished2(false);
+		boost::thread thread([&disruptor, &isPublished2, id2]() {
+			disruptor.publish(id2, ConsumerInput(test::CreateBlockEntityRange(1)), [](auto, auto) {});
+			isPublished2 = true;
+		});
+
+		test::Pause();
+
+		// Sanity: second element is not published because first element is not published
+		EXPECT_FALSE(isPublished2);
+		EXPECT_EQ(0u, disruptor.published());
+
+		// Act: publish first element
+		disruptor.publish(id1, ConsumerInput(test::CreateBlockEntityRange(1)), [](auto, auto) {});
+		thread.join();
+
+		// Assert:
+		EXPECT_TRUE(isPublished2);
+		EXPECT_EQ(2u, disruptor.published());
+		EXPECT_EQ(1u, disruptor.elementAt(0).id());
+		EXPECT_EQ(2u, disruptor.elementAt(1).id());
+	}
+
+	TEST(TEST_CLASS, CanClaimAndPublishFromMultipleThreads) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Elements_Per_Thread = 100u;
+		Disruptor disruptor(Num_Threads * Num_Elements_Per_Thread + 2);
+
+		// Act:
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.create_thread([&disruptor]() {
+				for (auto j = 0u; j < Num_Elements_Per_Thread; ++j) {
+					auto id = disruptor.tryClaim(0);
+					disruptor.publish(id, ConsumerInput(test::CreateBlockEntityRange(1)), [](auto, auto) {});
+				}
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: every slot contains the element with the matching id
+		EXPECT_EQ(Num_Threads * Num_Elements_Per_Thread, disruptor.added());
+		EXPECT_EQ(Num_Threads * Num_Elements_Per_Thread, disruptor.published());
+		for (auto i = 0u; i < Num_Threads * Num_Elements_Per_Thread; ++i)
+			EXPECT_EQ(i + 1, disruptor.elementAt(i).id()) << "at " << i;
+	}
+
+	// endregion
 }}
@@ -0,0 +1,182 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/extensions/TransactionsSnapshotStorage.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS TransactionsSnapshotStorageTests
+
+	namespace {
+		constexpr auto Snapshot_Filename = "transactions.dat";
+
+		std::vector<std::shared_ptr<const model::Transaction>> GenerateTransactions(size_t count) {
+			std::vector<std::shared_ptr<const model::Transaction>> transactions;
+			for (auto i = 0u; i < count; ++i)
+				transactions.push_back(test::GenerateRandomTransactionWithSize(sizeof(model::Transaction) + 10 * i));
+
+			return transactions;
+		}
+
+		void AssertTransactions(
+				const std::vector<std::shared_ptr<const model::Transaction>>& expectedTransactions,
+				const model::TransactionRange& transactions) {
+			ASSERT_EQ(expectedTransactions.size(), transactions.size());
+
+			auto i = 0u;
+			for (const auto& transaction : transactions) {
+				EXPECT_EQ(*expectedTransactions[i], transaction) << "transaction at " << i;
+				++i;
+			}
+		}
+
+		void AssertCanRoundtripTransactions(size_t numTransactions) {
+			// Arrange:
+			test::TempFileGuard fileGuard(Snapshot_Filename);
+			auto transactions = GenerateTransactions(numTransactions);
+			SaveTransactionsSnapshot(fileGuard.name(), Height(123), transactions);
+
+			// Act:
+			auto loadedTransactions = LoadTransactionsSnapshot(fileGuard.name(), Height(123));
+
+			// Assert:
+			AssertTransactions(transactions, loadedTransactions);
+			EXPECT_FALSE(boost::filesystem::exists(fileGuard.name()));
+		}
+	}
+
+	TEST(TEST_CLASS, LoadReturnsEmptyRangeWhenSnapshotDoesNotExist) {
+		// Arrange:
+		test::TempFileGuard fileGuard(Snapshot_Filename);
+
+		// Act:
+		auto transactions = LoadTransactionsSnapshot(fileGuard.name(), Height(123));
+
+		// Assert:
+		EXPECT_TRUE(transactions.empty());
+	}
+
+	TEST(TEST_CLASS, CanRoundtripZeroTransactions) {
+		AssertCanRoundtripTransactions(0);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripSingleTransaction) {
+		AssertCanRoundtripTransactions(1);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripMultipleTransactions) {
+		AssertCanRoundtripTransactions(5);
+	}
+
+	TEST(TEST_CLASS, SaveOverwritesExistingSnapshot) {
+		// Arrange:
+		test::TempFileGuard fileGuard(Snapshot_Filename);
+		SaveTransactionsSnapshot(fileGuard.name(), Height(100), GenerateTransactions(7));
+
+		auto transactions = GenerateTransactions(3);
+		SaveTransactionsSnapshot(fileGuard.name(), Height(123), transactions);
+
+		// Act:
+		auto loadedTransactions = LoadTransactionsSnapshot(fileGuard.name(), Height(123));
+
+		// Assert:
+		AssertTransactions(transactions, loadedTransactions);
+	}
+
+	TEST(TEST_CLASS, LoadIgnoresAndRemovesSnapshotSavedAtDifferentHeight) {
+		// Arrange:
+		test::TempFileGuard fileGuard(Snapshot_Filename);
+		SaveTransactionsSnapshot(fileGuard.name(), Height(122), GenerateTransactions(5));
+
+		// Act:
+		auto transactions = LoadTransactionsSnapshot(fileGuard.name(), Height(123));
+
+		// Assert:
+		EXPECT_TRUE(transactions.empty());
+		EXPECT_FALSE(boost::filesystem::exists(fileGuard.name()));
+	}
+
+	TEST(TEST_CLASS, SaveDoesNotLeaveTemporaryFile) {
+		// Arrange:
+		test::TempFileGuard fileGuard(Snapshot_Filename);
+
+		// Act:
+		SaveTransactionsSnapshot(fileGuard.name(), Height(123), GenerateTransactions(3));
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::exists(fileGuard.name()));
+		EXPECT_FALSE(boost::filesystem::exists(fileGuard.name() + ".tmp"));
+	}
+
+	namespace {
+		void AssertLoadRecoversFromCorruptSnapshot(uint32_t transactionSize, size_t numPayloadBytes) {
+			// Arrange: write a snapshot containing a single (corrupt) transaction
+			test::TempFileGuard fileGuard(Snapshot_Filename);
+			{
+				io::RawFile file(fileGuard.name(), io::OpenMode::Read_Write);
+				io::Write(file, Height(123));
+				io::Write32(file, 1);
+				io::Write32(file, transactionSize);
+				file.write(std::vector<uint8_t>(numPayloadBytes));
+			}
+
+			// Act:
+			auto transactions = LoadTransactionsSnapshot(fileGuard.name(), Height(123));
+
+			// Assert:
+			EXPECT_TRUE(transactions.empty());
+			EXPECT_FALSE(boost::filesystem::exists(fileGuard.name()));
+		}
+	}
+
+	TEST(TEST_CLASS, LoadRecoversFromSnapshotContainingTransactionWithInvalidSize) {
+		AssertLoadRecoversFromCorruptSnapshot(static_cast<uint32_t>(sizeof(model::Transaction) - 1), 0);
+	}
+
+	TEST(TEST_CLASS, LoadRecoversFromSnapshotContainingTruncatedTransaction) {
+		AssertLoadRecoversFromCorruptSnapshot(static_cast<uint32_t>(sizeof(model::Transaction) + 10), sizeof(model::Transaction));
+	}
+
+	TEST(TEST_CLASS, LoadRecoversFromSnapshotContainingTransactionWithHugeSize) {
+		AssertLoadRecoversFromCorruptSnapshot(std::numeric_limits<uint32_t>::max(), sizeof(model::Transaction));
+	}
+
+	TEST(TEST_CLASS, LoadRecoversFromTruncatedSnapshotHeader) {
+		// Arrange:
+		test::TempFileGuard fileGuard(Snapshot_Filename);
+		{
+			io::RawFile file(fileGuard.name(), io::OpenMode::Read_Write);
+			io::Write(file, Height(123));
+		}
+
+		// Act:
+		auto transactions = LoadTransactionsSnapshot(fileGuard.name(), Height(123));
+
+		// Assert:
+		EXPECT_TRUE(transactions.empty());
+		EXPECT_FALSE(boost::filesystem::exists(fileGuard.name()));
+	}
+}}
@@ -179,4 +179,180 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_REQUEST_RESPONSE_TESTS(TEST_CLASS, AssertPullResponseIsSetWhenPacketIsValid)
 
 	// endregion
+
+	// region PullTransactionsSketchHandler
+
+	namespace {
+		using Cell = utils::ShortHashSketch::Cell;
+
+		utils::ShortHashSketch CreateSketch(const std::vector<uint32_t>& shortHashes) {
+			utils::ShortHashSketch sketch(48);
+			for (auto shortHash : shortHashes)
+				sketch.insert(utils::ShortHash(shortHash));
+
+			return sketch;
+		}
+
+		std::shared_ptr<ionet::Packet> CreatePullTransactionsSketchPacket(
+				BlockFeeMultiplier minFeeMultiplier,
+				const Cell* pCells,
+				size_t numCells) {
+			auto cellsSize = static_cast<uint32_t>(numCells * sizeof(Cell));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(BlockFeeMultiplier) + cellsSize);
+			pPacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+			reinterpret_cast<BlockFeeMultiplier&>(*pPacket->Data()) = minFeeMultiplier;
+			if (0 != numCells)
+				std::memcpy(pPacket->Data() + sizeof(BlockFeeMultiplier), pCells, cellsSize);
+
+			return pPacket;
+		}
+
+		std::shared_ptr<ionet::Packet> CreatePullTransactionsSketchPacket(BlockFeeMultiplier minFeeMultiplier, size_t numCells) {
+			std::vector<Cell> cells(numCells);
+			return CreatePullTransactionsSketchPacket(minFeeMultiplier, cells.data(), cells.size());
+		}
+
+		struct PullTransactionsSketchHandlerContext {
+		public:
+			explicit PullTransactionsSketchHandlerContext(const std::vector<uint32_t>& localShortHashes)
+					: NumSketchSupplierCalls(0)
+					, NumRetrieverCalls(0) {
+				RegisterPullTransactionsSketchHandler(
+						Handlers,
+						[this, localShortHashes](auto numCells) {
+							++NumSketchSupplierCalls;
+							auto sketch = utils::ShortHashSketch(numCells);
+							for (auto shortHash : localShortHashes)
+								sketch.insert(utils::ShortHash(shortHash));
+
+							return sketch;
+						},
+						[this](auto minFeeMultiplier, const auto& requestedShortHashes) {
+							++NumRetrieverCalls;
+							MinFeeMultiplier = minFeeMultiplier;
+							RequestedShortHashes = requestedShortHashes;
+							return Transactions;
+						});
+			}
+
+		public:
+			ionet::ServerPacketHandlers Handlers;
+			size_t NumSketchSupplierCalls;
+			size_t NumRetrieverCalls;
+			BlockFeeMultiplier MinFeeMultiplier;
+			utils::ShortHashesSet RequestedShortHashes;
+			UnconfirmedTransactions Transactions;
+		};
+
+		void AssertPullTransactionsSketchPacketIsRejected(const ionet::Packet& packet) {
+			// Arrange:
+			PullTransactionsSketchHandlerContext context({ 1, 2, 3 });
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(context.Handlers.process(packet, handlerContext));
+
+			// Assert:
+			EXPECT_FALSE(handlerContext.hasResponse());
+			EXPECT_EQ(0u, context.NumSketchSupplierCalls);
+			EXPECT_EQ(0u, context.NumRetrieverCalls);
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_TooSmallPacketIsRejected) {
+		// Arrange:
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(BlockFeeMultiplier) - 1);
+		pPacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+
+		// Act + Assert:
+		AssertPullTransactionsSketchPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithoutCellsIsRejected) {
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 0));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithPartialCellIsRejected) {
+		// Arrange:
+		auto pPacket = CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 3);
+		--pPacket->Size;
+
+		// Act + Assert:
+		AssertPullTransactionsSketchPacketIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithNumCellsNotMultipleOfNumHashFunctionsIsRejected) {
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 4));
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 8));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithNumCellsNotPowerOfTwoPerHashFunctionIsRejected) {
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 9));
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 30));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithTooManyCellsIsRejected) {
+		auto maxCells = utils::ShortHashSketch::Max_Remote_Cells;
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), maxCells + 3));
+		AssertPullTransactionsSketchPacketIsRejected(*CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), 2 * maxCells));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_EmptyResponseIsSetWhenDifferenceCannotBeDecoded) {
+		// Arrange: 100 local short hashes cannot be decoded from 48 cells
+		std::vector<uint32_t> localShortHashes;
+		for (auto i = 0u; i < 100; ++i)
+			localShortHashes.push_back(i * 0x0101'0101);
+
+		PullTransactionsSketchHandlerContext context(localShortHashes);
+		auto remoteSketch = CreateSketch({});
+		auto pPacket = CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), remoteSketch.data(), remoteSketch.size());
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(context.Handlers.process(*pPacket, handlerContext));
+
+		// Assert:
+		EXPECT_EQ(1u, context.NumSketchSupplierCalls);
+		EXPECT_EQ(0u, context.NumRetrieverCalls);
+
+		ASSERT_TRUE(handlerContext.hasResponse());
+		auto payload = handlerContext.response();
+		test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader), ionet::PacketType::Pull_Transactions_Sketch);
+		EXPECT_TRUE(payload.buffers().empty());
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_ResponseIsSetWhenDifferenceIsDecoded) {
+		// Arrange: local short hashes { 1, 2, 3, 4 }, remote short hashes { 3, 4, 5 }
+		PullTransactionsSketchHandlerContext context({ 0x1111'1111, 0x2222'2222, 0x3333'3333, 0x4444'4444 });
+		for (uint16_t i = 0u; i < 2; ++i)
+			context.Transactions.push_back(mocks::CreateMockTransaction(i + 1));
+
+		auto remoteSketch = CreateSketch({ 0x3333'3333, 0x4444'4444, 0x5555'5555 });
+		auto pPacket = CreatePullTransactionsSketchPacket(BlockFeeMultiplier(17), remoteSketch.data(), remoteSketch.size());
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(context.Handlers.process(*pPacket, handlerContext));
+
+		// Assert: only locally known short hashes were requested
+		EXPECT_EQ(1u, context.NumSketchSupplierCalls);
+		EXPECT_EQ(1u, context.NumRetrieverCalls);
+		EXPECT_EQ(BlockFeeMultiplier(17), context.MinFeeMultiplier);
+		EXPECT_EQ(utils::ShortHashesSet({ utils::ShortHash(0x1111'1111), utils::ShortHash(0x2222'2222) }), context.RequestedShortHashes);
+
+		// - response is composed of difference size followed by transactions
+		ASSERT_TRUE(handlerContext.hasResponse());
+		auto payload = handlerContext.response();
+		auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(uint32_t) + test::TotalSize(context.Transactions);
+		test::AssertPacketHeader(payload, expectedSize, ionet::PacketType::Pull_Transactions_Sketch);
+		ASSERT_EQ(3u, payload.buffers().size());
+
+		EXPECT_EQ(3u, reinterpret_cast<const uint32_t&>(*payload.buffers()[0].pData));
+		for (auto i = 0u; i < 2; ++i) {
+			const auto& transaction = reinterpret_cast<const mocks::MockTransaction&>(*payload.buffers()[1 + i].pData);
+			EXPECT_EQ(*context.Transactions[i], transaction) << "transaction at " << i;
+		}
+	}
+
+	// endregion
 }}
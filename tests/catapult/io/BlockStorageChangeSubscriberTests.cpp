@@ -44,6 +44,20 @@ namespace catapult { namespace io {
 			}
 		};
 
+		class MockBatchSavingBlockStorage : public mocks::MockSavingBlockStorage {
+		public:
+			using mocks::MockSavingBlockStorage::MockSavingBlockStorage;
+
+		public:
+			std::vector<size_t> BatchSizes;
+
+		public:
+			void saveBlocks(const std::vector<model::BlockElement>& blockElements) override {
+				BatchSizes.push_back(blockElements.size());
+				mocks::MockSavingBlockStorage::saveBlocks(blockElements);
+			}
+		};
+
 		// endregion
 
 		template<typename TTransactionStorage>
@@ -88,6 +102,32 @@ namespace catapult { namespace io {
 		test::AssertEqual(blockElement, savedBlockElements[0]);
 	}
 
+	TEST(TEST_CLASS, NotifyBlocksForwardsToStorage) {
+		// Arrange:
+		TestContext<MockBatchSavingBlockStorage> context(Height(200));
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		for (auto i = 0u; i < 3; ++i) {
+			blocks.push_back(test::GenerateEmptyRandomBlock());
+			blocks.back()->Height = Height(987 + i);
+		}
+
+		for (const auto& pBlock : blocks)
+			blockElements.push_back(test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>()));
+
+		// Act:
+		context.subscriber().notifyBlocks(blockElements);
+
+		// Assert: blocks were saved in a single batch
+		EXPECT_EQ(std::vector<size_t>{ 3 }, context.storage().BatchSizes);
+
+		const auto& savedBlockElements = context.storage().savedBlockElements();
+		ASSERT_EQ(3u, savedBlockElements.size());
+		for (auto i = 0u; i < 3; ++i)
+			test::AssertEqual(blockElements[i], savedBlockElements[i]);
+	}
+
 	TEST(TEST_CLASS, NotifyDropBlocksAfterForwardsToStorage) {
 		// Arrange:
 		TestContext<MockDroppingBlockStorage> context(Height(200));
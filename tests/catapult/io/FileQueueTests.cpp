@@ -636,6 +636,143 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region FileQueueReader - read multiple
+
+	namespace {
+		template<typename TTraits>
+		std::vector<std::vector<uint8_t>> WriteMessages(ReaderTestContext<TTraits>& context, uint64_t startId, size_t count) {
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto id = startId; id < startId + count; ++id) {
+				std::ostringstream out;
+				out << utils::HexFormat(id) << ".dat";
+				buffers.push_back(test::GenerateRandomVector(15 + id % 10));
+				context.write(out.str(), buffers.back());
+			}
+
+			return buffers;
+		}
+
+		template<typename TTraits>
+		void AssertCanReadMultiple(size_t maxMessages, size_t expectedNumMessages) {
+			// Arrange:
+			ReaderTestContext<TTraits> context;
+			context.setIndexes(120, 116);
+			auto buffers = WriteMessages(context, 116, 4);
+
+			// Act:
+			std::vector<std::vector<uint8_t>> readBuffers;
+			auto numMessages = context.reader().tryReadNextMessages(maxMessages, [&readBuffers](const auto& buffer) {
+				readBuffers.push_back(buffer);
+			});
+
+			// Assert: each message is forwarded to consumer in a separate call
+			EXPECT_EQ(expectedNumMessages, numMessages);
+			buffers.resize(expectedNumMessages);
+			EXPECT_EQ(buffers, readBuffers);
+
+			// - processed data files should have been deleted
+			EXPECT_EQ(2u + 4 - expectedNumMessages, context.countFiles());
+			AssertIndexFiles(context, 120, 116 + expectedNumMessages);
+		}
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotReadMultipleWhenReaderIndexIsEqualToWriterIndex) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 120);
+
+		// Act:
+		auto numMessages = context.reader().tryReadNextMessages(10, ReadNever);
+
+		// Assert:
+		EXPECT_EQ(0u, numMessages);
+
+		EXPECT_EQ(2u, context.countFiles());
+		AssertIndexFiles(context, 120, 120);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotReadMultipleWhenMaxMessagesIsZero) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+		WriteMessages(context, 118, 2);
+
+		// Act:
+		auto numMessages = context.reader().tryReadNextMessages(0, ReadNever);
+
+		// Assert:
+		EXPECT_EQ(0u, numMessages);
+
+		EXPECT_EQ(4u, context.countFiles());
+		AssertIndexFiles(context, 120, 118);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadAtMostMaxMessages) {
+		AssertCanReadMultiple<TTraits>(1, 1);
+		AssertCanReadMultiple<TTraits>(3, 3);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanReadAllPendingMessagesWhenMaxMessagesExceedsPending) {
+		AssertCanReadMultiple<TTraits>(4, 4);
+		AssertCanReadMultiple<TTraits>(100, 4);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotReadMultipleWhenAnyMessageDoesNotExist) {
+		// Arrange: only write first of two messages
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+		auto buffers = WriteMessages(context, 118, 1);
+
+		// Act:
+		std::vector<std::vector<uint8_t>> readBuffers;
+		EXPECT_THROW(context.reader().tryReadNextMessages(10, [&readBuffers](const auto& buffer) {
+			readBuffers.push_back(buffer);
+		}), catapult_runtime_error);
+
+		// Assert: reader index should only have been incremented for the message that was processed
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(2u, context.countFiles());
+		AssertIndexFiles(context, 120, 119);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadMultipleDoesNotRemoveUnsuccessfullyProcessedDataFiles) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+		WriteMessages(context, 118, 2);
+
+		// Act: trigger a consumer exception
+		EXPECT_THROW(context.reader().tryReadNextMessages(10, ReadNever), catapult_invalid_argument);
+
+		// Assert: data files should not have been deleted because they were not successfully processed
+		EXPECT_EQ(4u, context.countFiles());
+		AssertIndexFiles(context, 120, 118);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReadMultipleRemovesSuccessfullyProcessedDataFilesPrecedingFailure) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 116);
+		auto buffers = WriteMessages(context, 116, 4);
+
+		// Act: trigger a consumer exception when processing the third message
+		std::vector<std::vector<uint8_t>> readBuffers;
+		EXPECT_THROW(context.reader().tryReadNextMessages(10, [&readBuffers](const auto& buffer) {
+			if (2 == readBuffers.size())
+				ReadNever(buffer);
+
+			readBuffers.push_back(buffer);
+		}), catapult_invalid_argument);
+
+		// Assert: only data files of successfully processed messages should have been deleted
+		buffers.resize(2);
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(4u, context.countFiles());
+		AssertIndexFiles(context, 120, 118);
+	}
+
+	// endregion
+
 	// region FileQueueReader - skip
 
 	namespace {
@@ -161,24 +161,56 @@ namespace catapult { namespace local {
 
 		public:
 			void setStorageChainHeight(Height chainHeight) {
+				setStorageChainHeight(chainHeight, Height());
+			}
+
+			void setStorageChainHeight(Height chainHeight, Height invalidStateHashHeight) {
 				auto storage = m_state.ref().Storage.modifier();
 
 				for (auto height = Height(2); height <= chainHeight; height = height + Height(1)) {
 					auto pBlock = test::GenerateBlockWithTransactions(0, height, Timestamp(height.unwrap() * 3000));
 					pBlock->Difficulty = Difficulty(Difficulty().unwrap() + height.unwrap());
+
+					// test cache does not have any merkle roots, so its state hash is zero
+					pBlock->StateHash = invalidStateHashHeight == height ? test::GenerateRandomByteArray<Hash256>() : Hash256();
 					storage.saveBlock(test::BlockToBlockElement(*pBlock));
 				}
 
 				storage.commit();
 			}
 
+			Height cacheHeight() {
+				return m_state.ref().Cache.createView().height();
+			}
+
+		public:
 			model::ChainScore load(Height startHeight) {
-				auto observerFactory = [this](const auto& block) {
+				return LoadBlockChain(createObserverFactory(), m_pluginManager, m_state.ref(), startHeight);
+			}
+
+			model::ChainScore load(Height startHeight, uint32_t maxBlocksPerCommit) {
+				return LoadBlockChain(createObserverFactory(), m_pluginManager, m_state.ref(), startHeight, maxBlocksPerCommit);
+			}
+
+			model::ChainScore load(
+					Height startHeight,
+					uint32_t maxBlocksPerCommit,
+					extensions::StateHashVerification stateHashVerification) {
+				return LoadBlockChain(
+						createObserverFactory(),
+						m_pluginManager,
+						m_state.ref(),
+						startHeight,
+						maxBlocksPerCommit,
+						stateHashVerification);
+			}
+
+		private:
+			BlockDependentNotificationObserverFactory createObserverFactory() {
+				return [this](const auto& block) {
 					this->m_factoryHeights.push_back(block.Height);
 					return std::make_unique<mocks::MockBlockHeightCapturingNotificationObserver>(this->m_observerBlockHeights);
 				};
-
-				return LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight);
 			}
 
 		private:
@@ -262,6 +294,87 @@ namespace catapult { namespace local {
 		EXPECT_EQ(expectedHeights, context.factoryHeights());
 	}
 
+	namespace {
+		void AssertCanLoadMultipleBlocksWithMaxBlocksPerCommit(uint32_t maxBlocksPerCommit) {
+			// Arrange:
+			LoadBlockChainTestContext context;
+			context.setStorageChainHeight(Height(7));
+
+			// Act:
+			auto score = context.load(Height(2), maxBlocksPerCommit);
+
+			// Assert:
+			auto expectedHeights = std::vector<Height>{ Height(2), Height(3), Height(4), Height(5), Height(6), Height(7) };
+			EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7)), score);
+			EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+			EXPECT_EQ(expectedHeights, context.factoryHeights());
+			EXPECT_EQ(Height(7), context.cacheHeight());
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenMaxBlocksPerCommitIsZero) {
+		AssertCanLoadMultipleBlocksWithMaxBlocksPerCommit(0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenMaxBlocksPerCommitIsLessThanNumBlocks) {
+		AssertCanLoadMultipleBlocksWithMaxBlocksPerCommit(4);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenMaxBlocksPerCommitIsGreaterThanNumBlocks) {
+		AssertCanLoadMultipleBlocksWithMaxBlocksPerCommit(10);
+	}
+
+	// endregion
+
+	// region LoadBlockChain - state hash verification
+
+	namespace {
+		void AssertCanLoadBlocksWithInvalidStateHash(
+				Height invalidStateHashHeight,
+				extensions::StateHashVerification stateHashVerification) {
+			// Arrange: blocks are committed at heights 4 and 7
+			LoadBlockChainTestContext context;
+			context.setStorageChainHeight(Height(7), invalidStateHashHeight);
+
+			// Act:
+			auto score = context.load(Height(2), 3, stateHashVerification);
+
+			// Assert:
+			EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7)), score);
+			EXPECT_EQ(Height(7), context.cacheHeight());
+		}
+
+		void AssertCannotLoadBlocksWithInvalidStateHash(Height invalidStateHashHeight, Height expectedCacheHeight) {
+			// Arrange: blocks are committed at heights 4 and 7
+			LoadBlockChainTestContext context;
+			context.setStorageChainHeight(Height(7), invalidStateHashHeight);
+
+			// Act + Assert: blocks preceding the failed commit are committed
+			EXPECT_THROW(context.load(Height(2), 3, extensions::StateHashVerification::Enabled), catapult_runtime_error);
+			EXPECT_EQ(expectedCacheHeight, context.cacheHeight());
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainSucceedsWhenAllStateHashesMatch_StateHashVerificationEnabled) {
+		AssertCanLoadBlocksWithInvalidStateHash(Height(), extensions::StateHashVerification::Enabled);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainSucceedsWhenIntermediateStateHashDoesNotMatch_StateHashVerificationEnabled) {
+		AssertCanLoadBlocksWithInvalidStateHash(Height(5), extensions::StateHashVerification::Enabled);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainSucceedsWhenCommitStateHashDoesNotMatch_StateHashVerificationDisabled) {
+		AssertCanLoadBlocksWithInvalidStateHash(Height(4), extensions::StateHashVerification::Disabled);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenFirstCommitStateHashDoesNotMatch_StateHashVerificationEnabled) {
+		AssertCannotLoadBlocksWithInvalidStateHash(Height(4), Height(0));
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenLastCommitStateHashDoesNotMatch_StateHashVerificationEnabled) {
+		AssertCannotLoadBlocksWithInvalidStateHash(Height(7), Height(4));
+	}
+
 	// endregion
 
 	// region LoadBlockChain - state enabled
@@ -299,7 +412,7 @@ namespace catapult { namespace local {
 		}
 
 		template<typename TAction>
-		void ExecuteWithStorage(io::BlockStorageCache& storage, TAction action) {
+		void ExecuteWithStorage(io::BlockStorageCache& storage, uint32_t maxBlocksPerCommit, TAction action) {
 			// Arrange:
 			test::TempDirectoryGuard tempDataDirectory;
 			auto config = test::CreateStateHashEnabledCatapultConfiguration(tempDataDirectory.name());
@@ -315,18 +428,18 @@ namespace catapult { namespace local {
 			ExecuteNemesis(stateRef, *pPluginManager);
 
 			// Act:
-			LoadBlockChain(observerFactory, *pPluginManager, stateRef, Height(2));
+			LoadBlockChain(observerFactory, *pPluginManager, stateRef, Height(2), maxBlocksPerCommit);
 
 			action(stateRef.Cache, *pPluginManager);
 		}
 
-		void RunLoadBlockChainTest(io::BlockStorageCache& storage, size_t maxHeight) {
+		void RunLoadBlockChainTest(io::BlockStorageCache& storage, size_t maxHeight, uint32_t maxBlocksPerCommit) {
 			// Arrange: create one additional block to simplify test, blocks[0].height = 2
 			auto blocks = CreateBlocks(maxHeight + 1);
 
 			// - calculate expected state hash after loading first two blocks (1, 2)
 			Hash256 expectedHash;
-			ExecuteWithStorage(storage, [&expectedHash, &block = *blocks[0] ](auto& cache, const auto& pluginManager) {
+			ExecuteWithStorage(storage, maxBlocksPerCommit, [&expectedHash, &block = *blocks[0] ](auto& cache, const auto& pluginManager) {
 				auto cacheDetachableDelta = cache.createDetachableDelta();
 				auto cacheDetachedDelta = cacheDetachableDelta.detach();
 				auto pCacheDelta = cacheDetachedDelta.tryLock();
@@ -348,7 +461,7 @@ namespace catapult { namespace local {
 
 				// - load whole chain and verify hash
 				const auto& nextBlock = *blocks[height - 1];
-				ExecuteWithStorage(storage, [&expectedHash, &nextBlock](auto& cache, const auto& pluginManager) {
+				ExecuteWithStorage(storage, maxBlocksPerCommit, [&expectedHash, &nextBlock](auto& cache, const auto& pluginManager) {
 					// Assert:
 					// - retrieve state hash calculated when loading chain
 					auto hashInfo = cache.createView().calculateStateHash();
@@ -373,7 +486,17 @@ namespace catapult { namespace local {
 				std::make_unique<mocks::MockMemoryBlockStorage>());
 
 		// Act + Assert:
-		RunLoadBlockChainTest(storage, 7);
+		RunLoadBlockChainTest(storage, 7, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWithMultipleBlocksPerCommit_StateHashEnabled) {
+		// Arrange:
+		io::BlockStorageCache storage(
+				std::make_unique<mocks::MockMemoryBlockStorage>(),
+				std::make_unique<mocks::MockMemoryBlockStorage>());
+
+		// Act + Assert: state hash must be independent of commit frequency
+		RunLoadBlockChainTest(storage, 7, 3);
 	}
 
 	// endregion
@@ -0,0 +1,297 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/local/recovery/TrustedBlockImport.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/model/EntityHasher.h"
+#include "tests/test/core/BlockStatementTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockMemoryBlockStorage.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/nodeps/Nemesis.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS TrustedBlockImportTests
+
+	namespace {
+		constexpr auto Num_Source_Blocks = 10u;
+		constexpr auto Num_Destination_Blocks = 4u;
+
+		enum class Corruption { None, Broken_Link, Invalid_Transactions_Hash, Invalid_Receipts_Hash, Local_Fork };
+
+		std::vector<model::TransactionElement> CalculateTransactionElements(
+				const model::Block& block,
+				const model::TransactionRegistry& transactionRegistry) {
+			std::vector<model::TransactionElement> transactionElements;
+			for (const auto& transaction : block.Transactions()) {
+				transactionElements.emplace_back(transaction);
+				model::UpdateHashes(transactionRegistry, test::GetDefaultGenerationHashSeed(), transactionElements.back());
+			}
+
+			return transactionElements;
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(Corruption corruption = Corruption::None, Height corruptionHeight = Height(6))
+					: m_transactionRegistry(mocks::CreateDefaultTransactionRegistry()) {
+				auto previousBlockHash = model::CalculateHash(test::GetNemesisBlock());
+				for (auto i = 2u; i <= Num_Source_Blocks; ++i) {
+					auto height = Height(i);
+					auto pBlock = createBlock(height, previousBlockHash);
+
+					// only blocks at even heights have statements
+					std::shared_ptr<model::BlockStatement> pBlockStatement;
+					if (0 == i % 2) {
+						pBlockStatement = test::GenerateRandomStatements({ 1, 2, 1 });
+						pBlock->ReceiptsHash = model::CalculateMerkleHash(*pBlockStatement);
+					}
+
+					if (corruptionHeight == height) {
+						if (Corruption::Broken_Link == corruption)
+							test::FillWithRandomData(pBlock->PreviousBlockHash);
+						else if (Corruption::Invalid_Transactions_Hash == corruption)
+							test::FillWithRandomData(pBlock->TransactionsHash);
+						else if (Corruption::Invalid_Receipts_Hash == corruption)
+							test::FillWithRandomData(pBlock->ReceiptsHash);
+					}
+
+					previousBlockHash = model::CalculateHash(*pBlock);
+					auto blockElement = test::BlockToBlockElement(*pBlock);
+					blockElement.OptionalStatement = pBlockStatement;
+					m_sourceStorage.saveBlock(blockElement);
+
+					if (i <= Num_Destination_Blocks) {
+						auto pDestinationBlock = Corruption::Local_Fork == corruption && corruptionHeight == height
+								? createBlock(height, pBlock->PreviousBlockHash)
+								: std::move(pBlock);
+						m_destinationStorage.saveBlock(test::BlockToBlockElement(*pDestinationBlock));
+					}
+				}
+			}
+
+		public:
+			const auto& sourceStorage() const {
+				return m_sourceStorage;
+			}
+
+			const auto& destinationStorage() const {
+				return m_destinationStorage;
+			}
+
+			const auto& transactionRegistry() const {
+				return m_transactionRegistry;
+			}
+
+			TrustedCheckpoint checkpointAt(Height height) const {
+				return { height, model::CalculateHash(*m_sourceStorage.loadBlock(height)) };
+			}
+
+		public:
+			size_t import(const TrustedCheckpoint& checkpoint) {
+				return ImportTrustedBlocks(
+						m_sourceStorage,
+						m_destinationStorage,
+						checkpoint,
+						m_transactionRegistry,
+						test::GetDefaultGenerationHashSeed());
+			}
+
+		private:
+			std::unique_ptr<model::Block> createBlock(Height height, const Hash256& previousBlockHash) const {
+				test::MutableTransactions transactions;
+				for (auto i = 0u; i < height.unwrap() % 3; ++i)
+					transactions.push_back(mocks::CreateMockTransaction(static_cast<uint16_t>(10 + i)));
+
+				auto pBlock = test::GenerateBlockWithTransactions(transactions);
+				pBlock->Height = height;
+				pBlock->PreviousBlockHash = previousBlockHash;
+				pBlock->ReceiptsHash = Hash256();
+
+				auto merkleTree = model::CalculateMerkleTree(CalculateTransactionElements(*pBlock, m_transactionRegistry));
+				pBlock->TransactionsHash = merkleTree.empty() ? Hash256() : merkleTree.back();
+				return pBlock;
+			}
+
+		private:
+			model::TransactionRegistry m_transactionRegistry;
+			mocks::MockMemoryBlockStorage m_sourceStorage;
+			mocks::MockMemoryBlockStorage m_destinationStorage;
+		};
+
+		void AssertImportedBlocks(const TestContext& context, Height startHeight, Height endHeight) {
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+				auto message = "at height " + std::to_string(height.unwrap());
+				auto pSourceBlockElement = context.sourceStorage().loadBlockElement(height);
+				auto pBlockElement = context.destinationStorage().loadBlockElement(height);
+
+				const auto& block = pSourceBlockElement->Block;
+				EXPECT_EQ(block, pBlockElement->Block) << message;
+				EXPECT_EQ(model::CalculateHash(block), pBlockElement->EntityHash) << message;
+				EXPECT_EQ(model::CalculateGenerationHash(block.GenerationHashProof.Gamma), pBlockElement->GenerationHash) << message;
+				EXPECT_EQ(pSourceBlockElement->SubCacheMerkleRoots, pBlockElement->SubCacheMerkleRoots) << message;
+				auto expectedBlockStatementPair = context.sourceStorage().loadBlockStatementData(height);
+				EXPECT_EQ(expectedBlockStatementPair, context.destinationStorage().loadBlockStatementData(height)) << message;
+
+				// transaction hashes are recalculated with the transaction registry
+				auto expectedTransactionElements = CalculateTransactionElements(block, context.transactionRegistry());
+				ASSERT_EQ(expectedTransactionElements.size(), pBlockElement->Transactions.size()) << message;
+				for (auto i = 0u; i < expectedTransactionElements.size(); ++i) {
+					const auto& transactionElement = pBlockElement->Transactions[i];
+					EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElement.EntityHash) << message << " tx " << i;
+					EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElement.MerkleComponentHash)
+							<< message << " tx " << i;
+				}
+			}
+		}
+	}
+
+	// region no-op
+
+	TEST(TEST_CLASS, NoBlocksAreImportedWhenCheckpointHeightIsLessThanDestinationHeight) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto numImportedBlocks = context.import(context.checkpointAt(Height(3)));
+
+		// Assert:
+		EXPECT_EQ(0u, numImportedBlocks);
+		EXPECT_EQ(Height(Num_Destination_Blocks), context.destinationStorage().chainHeight());
+	}
+
+	TEST(TEST_CLASS, NoBlocksAreImportedWhenCheckpointHeightIsEqualToDestinationHeight) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto numImportedBlocks = context.import(context.checkpointAt(Height(Num_Destination_Blocks)));
+
+		// Assert:
+		EXPECT_EQ(0u, numImportedBlocks);
+		EXPECT_EQ(Height(Num_Destination_Blocks), context.destinationStorage().chainHeight());
+	}
+
+	// endregion
+
+	// region success
+
+	TEST(TEST_CLASS, CanImportBlocksUpToCheckpointBelowSourceChainHeight) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto numImportedBlocks = context.import(context.checkpointAt(Height(8)));
+
+		// Assert:
+		EXPECT_EQ(4u, numImportedBlocks);
+		EXPECT_EQ(Height(8), context.destinationStorage().chainHeight());
+		AssertImportedBlocks(context, Height(Num_Destination_Blocks + 1), Height(8));
+	}
+
+	TEST(TEST_CLASS, CanImportBlocksUpToCheckpointAtSourceChainHeight) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto numImportedBlocks = context.import(context.checkpointAt(Height(Num_Source_Blocks)));
+
+		// Assert:
+		EXPECT_EQ(6u, numImportedBlocks);
+		EXPECT_EQ(Height(Num_Source_Blocks), context.destinationStorage().chainHeight());
+		AssertImportedBlocks(context, Height(Num_Destination_Blocks + 1), Height(Num_Source_Blocks));
+	}
+
+	// endregion
+
+	// region failure
+
+	namespace {
+		void AssertImportFailure(TestContext& context, const TrustedCheckpoint& checkpoint, Height expectedDestinationHeight) {
+			// Act + Assert:
+			EXPECT_THROW(context.import(checkpoint), catapult_runtime_error);
+			EXPECT_EQ(expectedDestinationHeight, context.destinationStorage().chainHeight());
+		}
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenSourceIsMissingBlocks) {
+		// Arrange:
+		TestContext context;
+		auto checkpoint = context.checkpointAt(Height(Num_Source_Blocks));
+		checkpoint.Height = Height(Num_Source_Blocks + 1);
+
+		// Act + Assert:
+		AssertImportFailure(context, checkpoint, Height(Num_Destination_Blocks));
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenCheckpointHashDoesNotMatch) {
+		// Arrange:
+		TestContext context;
+		auto checkpoint = context.checkpointAt(Height(8));
+		checkpoint.BlockHash[0] ^= 0xFF;
+
+		// Act + Assert:
+		AssertImportFailure(context, checkpoint, Height(Num_Destination_Blocks));
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenIntermediateBlockDoesNotLinkToCheckpoint) {
+		// Arrange: block 6 does not link to block 5
+		TestContext context(Corruption::Broken_Link, Height(6));
+
+		// Act + Assert: no blocks should be saved because hash chain is verified before import
+		AssertImportFailure(context, context.checkpointAt(Height(8)), Height(Num_Destination_Blocks));
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenBlocksDoNotLinkToLocalChain) {
+		// Arrange: destination block 4 differs from source block 4
+		TestContext context(Corruption::Local_Fork, Height(Num_Destination_Blocks));
+
+		// Act + Assert:
+		AssertImportFailure(context, context.checkpointAt(Height(8)), Height(Num_Destination_Blocks));
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenBlockHasInvalidTransactionsHash) {
+		// Arrange: block 7 has a transactions hash that is consistent with the hash chain but not with its transactions
+		TestContext context(Corruption::Invalid_Transactions_Hash, Height(7));
+
+		// Act + Assert: all (authenticated) blocks preceding the invalid block are imported
+		AssertImportFailure(context, context.checkpointAt(Height(8)), Height(6));
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenBlockWithStatementHasInvalidReceiptsHash) {
+		// Arrange: block 6 has a receipts hash that is consistent with the hash chain but not with its statement
+		TestContext context(Corruption::Invalid_Receipts_Hash, Height(6));
+
+		// Act + Assert: all (authenticated) blocks preceding the invalid block are imported
+		AssertImportFailure(context, context.checkpointAt(Height(8)), Height(5));
+	}
+
+	TEST(TEST_CLASS, CannotImportWhenBlockWithoutStatementHasNonzeroReceiptsHash) {
+		// Arrange: block 7 has a receipts hash that is consistent with the hash chain but it has no statement
+		TestContext context(Corruption::Invalid_Receipts_Hash, Height(7));
+
+		// Act + Assert: all (authenticated) blocks preceding the invalid block are imported
+		AssertImportFailure(context, context.checkpointAt(Height(8)), Height(6));
+	}
+
+	// endregion
+}}
@@ -254,6 +254,57 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region CalculateHashes
+
+	namespace {
+		struct TransactionsWithRegistry {
+			TransactionRegistry Registry;
+			std::vector<std::unique_ptr<Transaction>> Transactions;
+		};
+
+		TransactionsWithRegistry GenerateTransactionsWithRegistry(size_t count) {
+			TransactionsWithRegistry result;
+			result.Registry.registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(
+					mocks::OffsetRange{ 6, 10 },
+					std::vector<mocks::OffsetRange>{ { 7, 11 }, { 12, 20 } }));
+
+			for (auto i = 0u; i < count; ++i)
+				result.Transactions.push_back(test::GenerateRandomTransaction());
+
+			return result;
+		}
+	}
+
+	TEST(TEST_CLASS, CalculateHashes_CanCalculateZeroHashes) {
+		// Arrange:
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		// Act + Assert: no exception
+		CalculateHashes(TransactionRegistry(), generationHashSeed, nullptr, nullptr, 0);
+	}
+
+	TEST(TEST_CLASS, CalculateHashes_ReturnsSameHashesAsCalculateHash) {
+		// Arrange:
+		auto data = GenerateTransactionsWithRegistry(11);
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		std::vector<const Transaction*> transactions;
+		std::vector<Hash256> expectedHashes;
+		for (const auto& pTransaction : data.Transactions) {
+			transactions.push_back(pTransaction.get());
+			expectedHashes.push_back(CalculateHash(*pTransaction, generationHashSeed, mocks::ExtractBuffer({ 6, 10 }, pTransaction.get())));
+		}
+
+		// Act:
+		std::vector<Hash256> hashes(transactions.size());
+		CalculateHashes(data.Registry, generationHashSeed, transactions.data(), hashes.data(), hashes.size());
+
+		// Assert:
+		EXPECT_EQ(expectedHashes, hashes);
+	}
+
+	// endregion
+
 	// region CalculateMerkleComponentHash (transaction)
 
 	TEST(TEST_CLASS, CalculateMerkleComponentHash_ReturnsTransactionHashWhenThereAreNoSupplementaryBuffers) {
@@ -410,4 +461,40 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region UpdateHashes (transaction elements)
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateZeroTransactionElements) {
+		// Arrange:
+		std::vector<TransactionElement> transactionElements;
+
+		// Act + Assert: no exception
+		UpdateHashes(TransactionRegistry(), test::GenerateRandomByteArray<GenerationHashSeed>(), transactionElements);
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_UpdatesAllTransactionElementsSameAsSingleUpdate) {
+		// Arrange:
+		auto data = GenerateTransactionsWithRegistry(11);
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		std::vector<TransactionElement> transactionElements;
+		std::vector<TransactionElement> expectedTransactionElements;
+		for (const auto& pTransaction : data.Transactions) {
+			transactionElements.emplace_back(*pTransaction);
+			expectedTransactionElements.emplace_back(*pTransaction);
+			UpdateHashes(data.Registry, generationHashSeed, expectedTransactionElements.back());
+		}
+
+		// Act:
+		UpdateHashes(data.Registry, generationHashSeed, transactionElements);
+
+		// Assert:
+		for (auto i = 0u; i < transactionElements.size(); ++i) {
+			EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << i;
+			EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash) << i;
+			EXPECT_NE(transactionElements[i].EntityHash, transactionElements[i].MerkleComponentHash) << i;
+		}
+	}
+
+	// endregion
 }}
@@ -230,6 +230,16 @@ namespace catapult { namespace model {
 		EXPECT_EQ(3u * sizeof(uint32_t), range.totalSize());
 	}
 
+	TEST(TEST_CLASS, UninitializedMemoryIsZeroed) {
+		// Act:
+		uint8_t* pRangeData;
+		auto range = EntityRange<uint32_t>::PrepareFixed(3, &pRangeData);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>(3 * sizeof(uint32_t)), std::vector<uint8_t>(pRangeData, pRangeData + 3 * sizeof(uint32_t)));
+		AssertRange(range, { 0, 0, 0 });
+	}
+
 	TEST(TEST_CLASS, CanWriteToUnderlyingRangeMemoryUsingDataPointer) {
 		// Arrange:
 		uint8_t* pRangeData;
@@ -330,6 +340,62 @@ namespace catapult { namespace model {
 		AssertEntities(GetExpectedMultiEntityBufferValues(), entities);
 	}
 
+	TEST(TEST_CLASS, EntitiesExtractedFromMultipleEntityBufferRangeShareOwnershipOfBuffer) {
+		// Arrange:
+		auto range = EntityRange<uint32_t>::CopyVariable(Multi_Entity_Buffer.data(), Multi_Entity_Buffer.size(), { 0, 4, 8 });
+		const auto* pRangeData = reinterpret_cast<const uint8_t*>(range.data());
+
+		// Act:
+		auto entities = EntityRange<uint32_t>::ExtractEntitiesFromRange(std::move(range));
+
+		// Assert: all entities point into the original range buffer and share a single owner
+		ASSERT_EQ(3u, entities.size());
+		for (auto i = 0u; i < entities.size(); ++i) {
+			EXPECT_EQ(pRangeData + i * sizeof(uint32_t), reinterpret_cast<const uint8_t*>(entities[i].get())) << "entity at " << i;
+			EXPECT_EQ(3, entities[i].use_count()) << "entity at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, EntityExtractedFromMultipleEntityBufferRangeKeepsBufferAlive) {
+		// Arrange:
+		auto range = EntityRange<uint32_t>::CopyVariable(Multi_Entity_Buffer.data(), Multi_Entity_Buffer.size(), { 0, 4, 8 });
+		auto entities = EntityRange<uint32_t>::ExtractEntitiesFromRange(std::move(range));
+
+		// Act: release all but the last entity
+		auto pEntity = entities.back();
+		entities.clear();
+
+		// Assert:
+		EXPECT_EQ(1, pEntity.use_count());
+		EXPECT_EQ(0x34129876u, *pEntity);
+	}
+
+	TEST(TEST_CLASS, EntitiesExtractedFromLargeMultipleEntityBufferRangeAreNotCopied) {
+		// Arrange: create a range with a large buffer
+		constexpr auto Num_Entities = 64u * 1024 / sizeof(uint32_t);
+		std::vector<uint32_t> values(Num_Entities);
+		std::vector<size_t> offsets(Num_Entities);
+		for (auto i = 0u; i < Num_Entities; ++i) {
+			values[i] = i * i;
+			offsets[i] = i * sizeof(uint32_t);
+		}
+
+		const auto* pValuesData = reinterpret_cast<const uint8_t*>(values.data());
+		auto range = EntityRange<uint32_t>::CopyVariable(pValuesData, values.size() * sizeof(uint32_t), offsets);
+		const auto* pRangeData = reinterpret_cast<const uint8_t*>(range.data());
+
+		// Act:
+		auto entities = EntityRange<uint32_t>::ExtractEntitiesFromRange(std::move(range));
+
+		// Assert: all entities point into the original range buffer and share a single owner
+		ASSERT_EQ(Num_Entities, entities.size());
+		for (auto i = 0u; i < entities.size(); ++i) {
+			EXPECT_EQ(pRangeData + i * sizeof(uint32_t), reinterpret_cast<const uint8_t*>(entities[i].get())) << "entity at " << i;
+			EXPECT_EQ(static_cast<long>(Num_Entities), entities[i].use_count()) << "entity at " << i;
+			EXPECT_EQ(i * i, *entities[i]) << "entity at " << i;
+		}
+	}
+
 	// endregion
 
 	// region overlay (variable) buffer
@@ -411,9 +477,9 @@ namespace catapult { namespace model {
 		// Assert: 0 1234 5 PPP 6789 AB PP CDEF 0 (3 partial + 5 padding + 1 trailing)
 		AssertRange(range, GetExpectedMultiEntityCustomAlignmentBufferValues(), 9);
 
-		// - partial data is copied over (padding bytes are uninitialized)
-		EXPECT_EQ(0x000000DDu, range.data()[1] & 0x000000FF);
-		EXPECT_EQ(0x00003412u, range.data()[3] & 0x0000FFFF);
+		// - partial data is copied over (padding bytes are zeroed)
+		EXPECT_EQ(0x000000DDu, range.data()[1]);
+		EXPECT_EQ(0x00003412u, range.data()[3]);
 	}
 
 	TEST(TEST_CLASS, CanCopyRangeAroundMultipleEntityBufferWithCustomAlignment) {
@@ -426,9 +492,9 @@ namespace catapult { namespace model {
 		AssertRange(range, GetExpectedMultiEntityCustomAlignmentBufferValues(), 9);
 		AssertDifferentBackingMemory(original, range);
 
-		// - partial data is copied over (padding bytes are uninitialized)
-		EXPECT_EQ(0x000000DDu, range.data()[1] & 0x000000FF);
-		EXPECT_EQ(0x00003412u, range.data()[3] & 0x0000FFFF);
+		// - partial data is copied over (padding bytes are zeroed)
+		EXPECT_EQ(0x000000DDu, range.data()[1]);
+		EXPECT_EQ(0x00003412u, range.data()[3]);
 	}
 
 	TEST(TEST_CLASS, CanExtractEntitiesFromMultipleEntityBufferRangeWithCustomAlignment) {
@@ -162,6 +162,25 @@ namespace catapult { namespace state {
 		AssertCanAssignAccountBalances(MosaicId());
 	}
 
+	TEST(TEST_CLASS, CanAssignAccountBalancesToNonEmptyAccountBalances) {
+		// Arrange:
+		auto balances = CreateBalancesForConstructionTests(Test_Mosaic_Id2);
+		AccountBalances balancesCopy;
+		balancesCopy.optimize(Test_Mosaic_Id1);
+		balancesCopy.credit(Test_Mosaic_Id1, Amount(123));
+		balancesCopy.credit(Test_Mosaic_Id2, Amount(456));
+		balancesCopy.credit(Test_Mosaic_Id3, Amount(789));
+
+		// Act:
+		balancesCopy = balances;
+		balancesCopy.credit(Test_Mosaic_Id1, Amount(500));
+
+		// Assert: previous balances are replaced
+		AssertCopied(balances, balancesCopy, Test_Mosaic_Id2);
+		EXPECT_EQ(2u, balancesCopy.size());
+		EXPECT_EQ(Amount(0), balancesCopy.get(Test_Mosaic_Id3));
+	}
+
 	TEST(TEST_CLASS, CanMoveAssignAccountBalances) {
 		AssertCanMoveAssignAccountBalances(Test_Mosaic_Id2);
 	}
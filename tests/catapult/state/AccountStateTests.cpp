@@ -63,6 +63,41 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region copy
+
+	TEST(TEST_CLASS, CopyingAccountStateDoesNotCopyHistoryUntilModified) {
+		// Arrange:
+		AccountState accountState(test::GenerateRandomAddress(), Height(123));
+		accountState.ImportanceSnapshots.set(Importance(12), model::ImportanceHeight(100));
+		accountState.ActivityBuckets.update(model::ImportanceHeight(100), [](auto& bucket) { bucket.BeneficiaryCount = 3; });
+
+		// Act: only change balance of copy
+		auto accountStateCopy = accountState;
+		accountStateCopy.Balances.credit(MosaicId(1111), Amount(50));
+
+		// Assert: history is shared
+		EXPECT_EQ(accountState.ImportanceSnapshots.begin(), accountStateCopy.ImportanceSnapshots.begin());
+		EXPECT_EQ(accountState.ActivityBuckets.begin(), accountStateCopy.ActivityBuckets.begin());
+
+		// Act: change history of copy
+		accountStateCopy.ImportanceSnapshots.set(Importance(15), model::ImportanceHeight(200));
+		accountStateCopy.ActivityBuckets.update(model::ImportanceHeight(100), [](auto& bucket) { bucket.BeneficiaryCount = 5; });
+
+		// Assert: history is no longer shared and original is unchanged
+		EXPECT_NE(accountState.ImportanceSnapshots.begin(), accountStateCopy.ImportanceSnapshots.begin());
+		EXPECT_NE(accountState.ActivityBuckets.begin(), accountStateCopy.ActivityBuckets.begin());
+
+		EXPECT_EQ(Importance(12), accountState.ImportanceSnapshots.current());
+		EXPECT_EQ(3u, accountState.ActivityBuckets.get(model::ImportanceHeight(100)).BeneficiaryCount);
+		EXPECT_EQ(Amount(), accountState.Balances.get(MosaicId(1111)));
+
+		EXPECT_EQ(Importance(15), accountStateCopy.ImportanceSnapshots.current());
+		EXPECT_EQ(5u, accountStateCopy.ActivityBuckets.get(model::ImportanceHeight(100)).BeneficiaryCount);
+		EXPECT_EQ(Amount(50), accountStateCopy.Balances.get(MosaicId(1111)));
+	}
+
+	// endregion
+
 	// region IsRemote
 
 	TEST(TEST_CLASS, IsRemoteReturnsTrueForRemoteAccountTypes) {
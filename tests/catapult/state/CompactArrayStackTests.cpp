@@ -354,6 +354,84 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region copy on write
+
+	namespace {
+		ValuePairStack CreateStackWithTwoValues() {
+			ValuePairStack stack;
+			stack.push({ 111, 222 });
+			stack.push({ 333, 444 });
+			return stack;
+		}
+
+		template<typename TAction>
+		void AssertCopyIsDetachedByModification(TAction action) {
+			// Arrange:
+			auto stack = CreateStackWithTwoValues();
+			ValuePairStack stackCopy(stack);
+
+			// Sanity: memory is shared
+			EXPECT_EQ(stack.begin(), stackCopy.begin());
+
+			// Act:
+			action(stackCopy);
+
+			// Assert: memory is no longer shared and the original is unchanged
+			EXPECT_NE(stack.begin(), stackCopy.begin());
+
+			EXPECT_EQ(2u, stack.size());
+			AssertHistoricalValues(stack, { { std::make_pair(333, 444), std::make_pair(111, 222), std::make_pair(0, 0) } });
+		}
+	}
+
+	TEST(TEST_CLASS, CopySharesMemoryWithOriginal) {
+		// Arrange:
+		auto stack = CreateStackWithTwoValues();
+
+		// Act:
+		ValuePairStack stackCopy(stack);
+		ValuePairStack stackAssigned;
+		stackAssigned = stack;
+
+		// Assert:
+		EXPECT_EQ(stack.begin(), stackCopy.begin());
+		EXPECT_EQ(stack.begin(), stackAssigned.begin());
+	}
+
+	TEST(TEST_CLASS, PushDetachesCopy) {
+		AssertCopyIsDetachedByModification([](auto& stack) {
+			stack.push({ 555, 666 });
+		});
+	}
+
+	TEST(TEST_CLASS, PopDetachesCopy) {
+		AssertCopyIsDetachedByModification([](auto& stack) {
+			stack.pop();
+		});
+	}
+
+	TEST(TEST_CLASS, MutablePeekDetachesCopy) {
+		AssertCopyIsDetachedByModification([](auto& stack) {
+			stack.peek().Value1 = 999;
+		});
+	}
+
+	TEST(TEST_CLASS, ModificationDoesNotDetachUnsharedStack) {
+		// Arrange:
+		auto stack = CreateStackWithTwoValues();
+		auto begin = stack.begin();
+
+		// Act:
+		stack.peek().Value1 = 999;
+		stack.push({ 555, 666 });
+
+		// Assert: memory was modified in place
+		EXPECT_EQ(begin, stack.begin());
+		AssertHistoricalValues(stack, { { std::make_pair(555, 666), std::make_pair(999, 444), std::make_pair(111, 222) } });
+	}
+
+	// endregion
+
 	// region iterators
 
 	TEST(TEST_CLASS, CanAdvanceIteratorsPostfixOperator) {
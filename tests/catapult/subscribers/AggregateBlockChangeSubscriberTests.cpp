@@ -59,6 +59,30 @@ namespace catapult { namespace subscribers {
 		}
 	}
 
+	TEST(TEST_CLASS, NotifyBlocksForwardsToAllSubscribers) {
+		// Arrange:
+		TestContext<mocks::MockBlockChangeSubscriber> context;
+		auto pBlock1 = test::GenerateEmptyRandomBlock();
+		auto pBlock2 = test::GenerateEmptyRandomBlock();
+		std::vector<model::BlockElement> blockElements{ model::BlockElement(*pBlock1), model::BlockElement(*pBlock2) };
+
+		// Sanity:
+		EXPECT_EQ(3u, context.subscribers().size());
+
+		// Act:
+		context.aggregate().notifyBlocks(blockElements);
+
+		// Assert: each subscriber received a single batch
+		auto i = 0u;
+		for (const auto* pSubscriber : context.subscribers()) {
+			auto message = "subscriber at " + std::to_string(i++);
+			EXPECT_EQ(std::vector<size_t>{ 2 }, pSubscriber->blockBatchSizes()) << message;
+			ASSERT_EQ(2u, pSubscriber->blockElements().size()) << message;
+			EXPECT_EQ(&blockElements[0], pSubscriber->blockElements()[0]) << message;
+			EXPECT_EQ(&blockElements[1], pSubscriber->blockElements()[1]) << message;
+		}
+	}
+
 	TEST(TEST_CLASS, NotifyDropBlocksAfterForwardsToAllSubscribers) {
 		// Arrange:
 		TestContext<mocks::MockBlockChangeSubscriber> context;
@@ -103,4 +103,134 @@ namespace catapult { namespace subscribers {
 		// Act + Assert:
 		EXPECT_THROW(ReadNextBlockChange(stream, subscriber), catapult_invalid_argument);
 	}
+
+	// region ReadAllBlockChanges
+
+	namespace {
+		class BlockChangesBuilder {
+		public:
+			BlockChangesBuilder& addBlock(Height height) {
+				m_blocks.push_back(test::GenerateEmptyRandomBlock());
+				m_blocks.back()->Height = height;
+				return append(CreateSerializedDataBuffer(*m_blocks.back(), 0 == height.unwrap() % 2));
+			}
+
+			BlockChangesBuilder& addDropBlocksAfter(Height height) {
+				return append(CreateSerializedDataBuffer(BlockChangeOperationType::Drop_Blocks_After, height));
+			}
+
+		public:
+			const auto& blocks() const {
+				return m_blocks;
+			}
+
+			auto& buffer() {
+				return m_buffer;
+			}
+
+		private:
+			BlockChangesBuilder& append(const std::vector<uint8_t>& buffer) {
+				m_buffer.insert(m_buffer.end(), buffer.cbegin(), buffer.cend());
+				return *this;
+			}
+
+		private:
+			std::vector<std::unique_ptr<model::Block>> m_blocks;
+			std::vector<uint8_t> m_buffer;
+		};
+
+		void AssertBlocks(const BlockChangesBuilder& builder, const mocks::MockBlockChangeSubscriber& subscriber) {
+			const auto& blocks = builder.blocks();
+			ASSERT_EQ(blocks.size(), subscriber.copiedBlockElements().size());
+			for (auto i = 0u; i < blocks.size(); ++i) {
+				const auto& readBlockElement = *subscriber.copiedBlockElements()[i];
+				EXPECT_EQ(*blocks[i], readBlockElement.Block) << "block at " << i;
+				EXPECT_EQ(0 == blocks[i]->Height.unwrap() % 2, !!readBlockElement.OptionalStatement) << "block at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ReadAllBlockChanges_CanReadZero) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream(buffer);
+		mocks::MockBlockChangeSubscriber subscriber;
+
+		// Act:
+		ReadAllBlockChanges(stream, subscriber);
+
+		// Assert:
+		EXPECT_EQ(0u, subscriber.blockElements().size());
+		EXPECT_EQ(0u, subscriber.blockBatchSizes().size());
+		EXPECT_EQ(0u, subscriber.dropBlocksAfterHeights().size());
+	}
+
+	TEST(TEST_CLASS, ReadAllBlockChanges_ForwardsConsecutiveBlocksInSingleBatch) {
+		// Arrange:
+		BlockChangesBuilder builder;
+		builder.addBlock(Height(10)).addBlock(Height(11)).addBlock(Height(12)).addBlock(Height(13));
+
+		mocks::MockMemoryStream stream(builder.buffer());
+		mocks::MockBlockChangeSubscriber subscriber;
+
+		// Act:
+		ReadAllBlockChanges(stream, subscriber);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 4 }), subscriber.blockBatchSizes());
+		EXPECT_EQ(0u, subscriber.dropBlocksAfterHeights().size());
+		AssertBlocks(builder, subscriber);
+	}
+
+	TEST(TEST_CLASS, ReadAllBlockChanges_SplitsBatchesAtNonConsecutiveBlocks) {
+		// Arrange:
+		BlockChangesBuilder builder;
+		builder.addBlock(Height(10)).addBlock(Height(11)).addBlock(Height(15)).addBlock(Height(16)).addBlock(Height(16));
+
+		mocks::MockMemoryStream stream(builder.buffer());
+		mocks::MockBlockChangeSubscriber subscriber;
+
+		// Act:
+		ReadAllBlockChanges(stream, subscriber);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 2, 2, 1 }), subscriber.blockBatchSizes());
+		EXPECT_EQ(0u, subscriber.dropBlocksAfterHeights().size());
+		AssertBlocks(builder, subscriber);
+	}
+
+	TEST(TEST_CLASS, ReadAllBlockChanges_SplitsBatchesAtDropBlocksAfterChanges) {
+		// Arrange:
+		BlockChangesBuilder builder;
+		builder.addBlock(Height(10)).addBlock(Height(11)).addBlock(Height(12));
+		builder.addDropBlocksAfter(Height(10)).addDropBlocksAfter(Height(9));
+		builder.addBlock(Height(10)).addBlock(Height(11));
+
+		mocks::MockMemoryStream stream(builder.buffer());
+		mocks::MockBlockChangeSubscriber subscriber;
+
+		// Act:
+		ReadAllBlockChanges(stream, subscriber);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 3, 2 }), subscriber.blockBatchSizes());
+		EXPECT_EQ(std::vector<Height>({ Height(10), Height(9) }), subscriber.dropBlocksAfterHeights());
+		AssertBlocks(builder, subscriber);
+	}
+
+	TEST(TEST_CLASS, ReadAllBlockChanges_CannotReadUnknownOperationType) {
+		// Arrange:
+		BlockChangesBuilder builder;
+		builder.addBlock(Height(10)).addBlock(Height(11));
+		auto invalidBuffer = CreateSerializedDataBuffer(static_cast<BlockChangeOperationType>(123), Height(987));
+		builder.buffer().insert(builder.buffer().end(), invalidBuffer.cbegin(), invalidBuffer.cend());
+
+		mocks::MockMemoryStream stream(builder.buffer());
+		mocks::MockBlockChangeSubscriber subscriber;
+
+		// Act + Assert:
+		EXPECT_THROW(ReadAllBlockChanges(stream, subscriber), catapult_invalid_argument);
+	}
+
+	// endregion
 }}
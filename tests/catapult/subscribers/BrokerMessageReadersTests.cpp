@@ -342,4 +342,118 @@ namespace catapult { namespace subscribers {
 	}
 
 	// endregion
+
+	// region ReadAll (FileQueue / MessageQueueDescriptor) - batched
+
+	namespace {
+		struct ReadAllBatchedFileQueueTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, size_t maxBatchSize, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				return subscribers::ReadAll(context.reader(), maxBatchSize, subscriber, readNextMessage);
+			}
+		};
+
+		struct ReadAllBatchedMessageQueueDescriptorTraits {
+			template<typename TSubscriber, typename TMessageReader>
+			static void ReadAll(QueueTestContext& context, size_t maxBatchSize, TSubscriber& subscriber, TMessageReader readNextMessage) {
+				MessageQueueDescriptor descriptor{ context.queuePath(), "index_r.dat", "index.dat" };
+				return subscribers::ReadAll(descriptor, maxBatchSize, subscriber, readNextMessage);
+			}
+		};
+	}
+
+#define READ_ALL_BATCHED_FILE_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_FileQueue) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedFileQueueTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_MessageQueueDescriptor) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ReadAllBatchedMessageQueueDescriptorTraits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllFileQueueBatched_CanReadZero) {
+		// Arrange:
+		QueueTestContext context;
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		TTraits::ReadAll(context, 10, subscriber, ReadNextBuffer);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Breadcrumb>(), subscriber.breadcrumbs());
+		EXPECT_TRUE(subscriber.notifications().empty());
+	}
+
+	namespace {
+		template<typename TTraits>
+		void AssertCanReadMultipleBatched(size_t maxBatchSize) {
+			// Arrange:
+			std::vector<std::vector<uint8_t>> notificationBuffers;
+			for (auto size : { 141u, 132u, 144u, 141u, 129u, 146u })
+				notificationBuffers.push_back(test::GenerateRandomVector(size));
+
+			QueueTestContext context;
+			context.write({ notificationBuffers[0], notificationBuffers[1] });
+			context.write(notificationBuffers[2]);
+			context.write({ notificationBuffers[3], notificationBuffers[4], notificationBuffers[5] });
+
+			MockBufferSubscriber subscriber;
+
+			// Act:
+			TTraits::ReadAll(context, maxBatchSize, subscriber, ReadNextBuffer);
+
+			// Assert: subscriber is flushed once per message independent of batch size
+			std::vector<Breadcrumb> expectedBreadcrumbs{
+				Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+				Breadcrumb::Notify, Breadcrumb::Flush,
+				Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush
+			};
+			EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs()) << "max batch size " << maxBatchSize;
+			EXPECT_EQ(notificationBuffers, subscriber.notifications()) << "max batch size " << maxBatchSize;
+		}
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllFileQueueBatched_FlushesOncePerMessage) {
+		for (auto maxBatchSize : { 1u, 2u, 3u, 10u })
+			AssertCanReadMultipleBatched<TTraits>(maxBatchSize);
+	}
+
+	READ_ALL_BATCHED_FILE_BASED_TEST(ReadAllFileQueueBatched_FailureDoesNotReplayPreviouslyProcessedMessagesInBatch) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> notificationBuffers;
+		for (auto size : { 141u, 132u, 144u })
+			notificationBuffers.push_back(test::GenerateRandomVector(size));
+
+		QueueTestContext context;
+		for (const auto& notificationBuffer : notificationBuffers)
+			context.write(notificationBuffer);
+
+		MockBufferSubscriber subscriber;
+
+		// - fail the first attempt to read the second message
+		auto numReads = 0u;
+		auto readNextMessage = [&numReads](auto& inputStream, auto& bufferSubscriber) {
+			if (1 == numReads++)
+				CATAPULT_THROW_RUNTIME_ERROR("second message could not be read");
+
+			ReadNextBuffer(inputStream, bufferSubscriber);
+		};
+
+		// Act:
+		EXPECT_THROW(TTraits::ReadAll(context, 10, subscriber, readNextMessage), catapult_runtime_error);
+		TTraits::ReadAll(context, 10, subscriber, readNextMessage);
+
+		// Assert: only the failed message was read again
+		EXPECT_EQ(4u, numReads);
+
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(notificationBuffers, subscriber.notifications());
+	}
+
+	// endregion
 }}
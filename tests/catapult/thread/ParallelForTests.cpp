@@ -425,4 +425,116 @@ namespace catapult { namespace thread {
 	}
 
 	// endregion
+
+	// region ParallelForDynamic
+
+	TEST(TEST_CLASS, Dynamic_CanProcessMultipleItemsConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+		auto items = std::vector<ItemType>();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		ParallelForDynamic(context.pPool->ioContext(), items, context.NumThreads, 3, [&counter](auto, auto) {
+			++counter;
+			return true;
+		}).get();
+
+		// Assert: the item callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	TEST(TEST_CLASS, Dynamic_CanProcessMultipleItemsConcurrently_OneItem) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+		auto items = std::vector<ItemType>{ 7 };
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(1, 0);
+		ParallelForDynamic(context.pPool->ioContext(), items, context.NumThreads, 3, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert: the callback was only called once (since there is only one item)
+		EXPECT_EQ(7u, sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), indexFlags);
+	}
+
+	namespace {
+		void AssertCanProcessMultipleItemsConcurrentlyDynamic(size_t batchSize) {
+			// Arrange:
+			BasicTestContext<std::vector<ItemType>> context(1);
+
+			// Act:
+			std::atomic<size_t> sum(0);
+			std::vector<uint8_t> indexFlags(context.NumItems, 0);
+			auto aggregate = CreateItemAggregate(sum, indexFlags);
+			ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, batchSize, aggregate).get();
+
+			// Assert:
+			EXPECT_EQ(context.ItemsSum, sum) << "batchSize " << batchSize;
+			EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags) << "batchSize " << batchSize;
+		}
+	}
+
+	TEST(TEST_CLASS, Dynamic_CanProcessMultipleItemsConcurrently) {
+		for (auto batchSize : { 0u, 1u, 3u, 1000u })
+			AssertCanProcessMultipleItemsConcurrentlyDynamic(batchSize);
+	}
+
+	TEST(TEST_CLASS, Dynamic_CanShortCircuitItemProcessing) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+
+		// Act: fail the first item
+		std::atomic<size_t> counter(0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, 1, 1, [&counter](auto, auto) {
+			++counter;
+			return false;
+		}).get();
+
+		// Assert: no batch was claimed after the failure
+		EXPECT_EQ(1u, counter);
+	}
+
+	TEST(TEST_CLASS, Dynamic_CorrectIndexesAreAssociatedWithItems) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+
+		// Act: capture all values by their index
+		std::vector<uint32_t> capturedValues(context.NumItems, 0);
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, context.NumThreads, 2, [&capturedValues](auto value, auto index) {
+			// Sanity: fail if any index is too large
+			EXPECT_GT(capturedValues.size(), index) << "unexpected index " << index;
+			if (capturedValues.size() <= index)
+				return false;
+
+			capturedValues[index] = value;
+			return true;
+		}).get();
+
+		// Assert: values start at 1
+		for (auto i = 0u; i < capturedValues.size(); ++i)
+			EXPECT_EQ(i + 1, capturedValues[i]) << "i " << i;
+	}
+
+	TEST(TEST_CLASS, Dynamic_SlowItemDoesNotDelayProcessingOfOtherItems) {
+		// Arrange:
+		BasicTestContext<std::vector<ItemType>> context;
+
+		// Act: block processing of the first item until all other items have been processed by other workers
+		std::atomic<size_t> numItemsProcessed(0);
+		auto numItems = context.NumItems;
+		ParallelForDynamic(context.pPool->ioContext(), context.Items, 2, 1, [&numItemsProcessed, numItems](auto, auto index) {
+			if (0 == index)
+				WAIT_FOR_VALUE_EXPR(numItems - 1, numItemsProcessed.load());
+
+			++numItemsProcessed;
+			return true;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(numItems, numItemsProcessed);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,483 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ShortHashSketch.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <limits>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ShortHashSketchTests
+
+	namespace {
+		ShortHashesSet GenerateRandomShortHashes(size_t count) {
+			ShortHashesSet shortHashes;
+			while (shortHashes.size() < count)
+				shortHashes.insert(ShortHash(static_cast<uint32_t>(test::Random())));
+
+			return shortHashes;
+		}
+
+		ShortHashSketch CreateSketch(size_t numCells, const ShortHashesSet& shortHashes) {
+			ShortHashSketch sketch(numCells);
+			for (auto shortHash : shortHashes)
+				sketch.insert(shortHash);
+
+			return sketch;
+		}
+
+		void AssertEmpty(const ShortHashSketch& sketch) {
+			for (auto i = 0u; i < sketch.size(); ++i) {
+				const auto& cell = sketch.data()[i];
+				EXPECT_EQ(0, cell.Count) << "cell at " << i;
+				EXPECT_EQ(0u, cell.KeySum) << "cell at " << i;
+				EXPECT_EQ(0u, cell.CheckSum) << "cell at " << i;
+			}
+		}
+	}
+
+	// region CalculateRemoteSize
+
+	TEST(TEST_CLASS, CalculateRemoteSizeRoundsUpToPowerOfTwoCellsPerHashFunction) {
+		EXPECT_EQ(3u, ShortHashSketch::CalculateRemoteSize(0));
+		EXPECT_EQ(3u, ShortHashSketch::CalculateRemoteSize(1));
+		EXPECT_EQ(3u, ShortHashSketch::CalculateRemoteSize(3));
+		EXPECT_EQ(6u, ShortHashSketch::CalculateRemoteSize(4));
+		EXPECT_EQ(12u, ShortHashSketch::CalculateRemoteSize(9));
+		EXPECT_EQ(96u, ShortHashSketch::CalculateRemoteSize(96));
+		EXPECT_EQ(192u, ShortHashSketch::CalculateRemoteSize(97));
+	}
+
+	TEST(TEST_CLASS, CalculateRemoteSizeReturnsMaxRemoteCellsForMaxRemoteCells) {
+		EXPECT_EQ(ShortHashSketch::Max_Remote_Cells, ShortHashSketch::CalculateRemoteSize(ShortHashSketch::Max_Remote_Cells));
+		EXPECT_EQ(ShortHashSketch::Max_Remote_Cells, ShortHashSketch::CalculateRemoteSize(ShortHashSketch::Max_Remote_Cells - 1));
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptySketch) {
+		// Act:
+		ShortHashSketch sketch(12);
+
+		// Assert:
+		EXPECT_EQ(12u, sketch.size());
+		AssertEmpty(sketch);
+	}
+
+	TEST(TEST_CLASS, NumberOfCellsIsRoundedUpToMultipleOfNumHashFunctions) {
+		EXPECT_EQ(3u, ShortHashSketch(1).size());
+		EXPECT_EQ(3u, ShortHashSketch(3).size());
+		EXPECT_EQ(6u, ShortHashSketch(4).size());
+		EXPECT_EQ(99u, ShortHashSketch(98).size());
+	}
+
+	TEST(TEST_CLASS, CannotCreateSketchWithZeroCells) {
+		EXPECT_THROW(ShortHashSketch(0), catapult_invalid_argument);
+		EXPECT_THROW(ShortHashSketch(std::vector<ShortHashSketch::Cell>()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateSketchAroundCellsThatAreNotMultipleOfNumHashFunctions) {
+		EXPECT_THROW(ShortHashSketch(std::vector<ShortHashSketch::Cell>(4)), catapult_invalid_argument);
+		EXPECT_THROW(ShortHashSketch(std::vector<ShortHashSketch::Cell>(8)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateSketchAroundCells) {
+		// Arrange:
+		auto sketch = CreateSketch(30, GenerateRandomShortHashes(5));
+		std::vector<ShortHashSketch::Cell> cells(sketch.data(), sketch.data() + sketch.size());
+
+		// Act:
+		ShortHashSketch sketchCopy(std::move(cells));
+
+		// Assert:
+		ASSERT_EQ(30u, sketchCopy.size());
+		EXPECT_EQ_MEMORY(sketch.data(), sketchCopy.data(), 30 * sizeof(ShortHashSketch::Cell));
+	}
+
+	// endregion
+
+	// region insert
+
+	TEST(TEST_CLASS, InsertUpdatesOneCellPerHashFunction) {
+		// Act:
+		ShortHashSketch sketch(30);
+		sketch.insert(ShortHash(0x12345678));
+
+		// Assert:
+		auto numNonEmptyCells = 0u;
+		for (auto i = 0u; i < sketch.size(); ++i) {
+			const auto& cell = sketch.data()[i];
+			if (0 == cell.Count)
+				continue;
+
+			++numNonEmptyCells;
+			EXPECT_EQ(1, cell.Count);
+			EXPECT_EQ(0x12345678u, cell.KeySum);
+		}
+
+		EXPECT_EQ(ShortHashSketch::Num_Hash_Functions, numNonEmptyCells);
+	}
+
+	TEST(TEST_CLASS, InsertIsOrderIndependent) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(20);
+		std::vector<ShortHash> reversedShortHashes(shortHashes.cbegin(), shortHashes.cend());
+		std::reverse(reversedShortHashes.begin(), reversedShortHashes.end());
+
+		// Act:
+		auto sketch1 = CreateSketch(30, shortHashes);
+		ShortHashSketch sketch2(30);
+		for (auto shortHash : reversedShortHashes)
+			sketch2.insert(shortHash);
+
+		// Assert:
+		EXPECT_EQ_MEMORY(sketch1.data(), sketch2.data(), 30 * sizeof(ShortHashSketch::Cell));
+	}
+
+	// endregion
+
+	// region remove
+
+	TEST(TEST_CLASS, RemoveUndoesInsert) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(20);
+		auto sketch = CreateSketch(30, shortHashes);
+
+		// Act:
+		for (auto shortHash : shortHashes)
+			sketch.remove(shortHash);
+
+		// Assert:
+		AssertEmpty(sketch);
+	}
+
+	TEST(TEST_CLASS, RemoveOnlyRemovesSpecifiedShortHash) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(20);
+		auto sketch = CreateSketch(30, shortHashes);
+		auto removedShortHash = *shortHashes.cbegin();
+		shortHashes.erase(removedShortHash);
+
+		// Act:
+		sketch.remove(removedShortHash);
+
+		// Assert:
+		auto expectedSketch = CreateSketch(30, shortHashes);
+		EXPECT_EQ_MEMORY(expectedSketch.data(), sketch.data(), 30 * sizeof(ShortHashSketch::Cell));
+	}
+
+	// endregion
+
+	// region subtract
+
+	TEST(TEST_CLASS, CannotSubtractSketchesWithDifferentSizes) {
+		// Arrange:
+		ShortHashSketch sketch1(30);
+		ShortHashSketch sketch2(33);
+
+		// Act + Assert:
+		EXPECT_THROW(sketch1.subtract(sketch2), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, SubtractingSketchOfSameShortHashesYieldsEmptySketch) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(100);
+		auto sketch1 = CreateSketch(30, shortHashes);
+		auto sketch2 = CreateSketch(30, shortHashes);
+
+		// Act:
+		sketch1.subtract(sketch2);
+
+		// Assert:
+		AssertEmpty(sketch1);
+	}
+
+	TEST(TEST_CLASS, SubtractWrapsAroundOnCountOverflow) {
+		// Arrange:
+		std::vector<ShortHashSketch::Cell> cells1{ { std::numeric_limits<int32_t>::min(), 0, 0 }, { 5, 0, 0 }, { 0, 0, 0 } };
+		std::vector<ShortHashSketch::Cell> cells2{ { 1, 0, 0 }, { std::numeric_limits<int32_t>::min(), 0, 0 }, { 0, 0, 0 } };
+		ShortHashSketch sketch1(std::move(cells1));
+		ShortHashSketch sketch2(std::move(cells2));
+
+		// Act:
+		sketch1.subtract(sketch2);
+
+		// Assert:
+		EXPECT_EQ(std::numeric_limits<int32_t>::max(), sketch1.data()[0].Count);
+		EXPECT_EQ(std::numeric_limits<int32_t>::min() + 5, sketch1.data()[1].Count);
+		EXPECT_EQ(0, sketch1.data()[2].Count);
+	}
+
+	// endregion
+
+	// region tryDecode
+
+	TEST(TEST_CLASS, CanDecodeEmptySketch) {
+		// Arrange:
+		ShortHashSketch sketch(30);
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+
+		// Act:
+		auto isDecoded = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_TRUE(positiveShortHashes.empty());
+		EXPECT_TRUE(negativeShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeSketchOfFewShortHashes) {
+		// Arrange:
+		auto shortHashes = ShortHashesSet{
+			ShortHash(0x1234'5678), ShortHash(0x2345'6789), ShortHash(0x3456'789A), ShortHash(0x4567'89AB), ShortHash(0x5678'9ABC)
+		};
+		auto sketch = CreateSketch(30, shortHashes);
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+
+		// Act:
+		auto isDecoded = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_EQ(shortHashes, positiveShortHashes);
+		EXPECT_TRUE(negativeShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeSymmetricDifferenceOfSubtractedSketches) {
+		// Arrange: large sets with small symmetric difference
+		//         (use deterministic extra short hashes because decoding can fail with small probability)
+		auto commonShortHashes = GenerateRandomShortHashes(10'000);
+		ShortHashesSet shortHashes1 = commonShortHashes;
+		ShortHashesSet shortHashes2 = commonShortHashes;
+		ShortHashesSet expectedPositiveShortHashes;
+		ShortHashesSet expectedNegativeShortHashes;
+		for (auto i = 0u; i < 20; ++i) {
+			auto shortHash = ShortHash(0x1357'0000 + i * 0x0123);
+			shortHashes1.erase(shortHash);
+			shortHashes2.erase(shortHash);
+
+			auto isPositive = 0 == i % 2;
+			(isPositive ? shortHashes1 : shortHashes2).insert(shortHash);
+			(isPositive ? expectedPositiveShortHashes : expectedNegativeShortHashes).insert(shortHash);
+		}
+
+		auto sketch = CreateSketch(60, shortHashes1);
+		sketch.subtract(CreateSketch(60, shortHashes2));
+
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+
+		// Act:
+		auto isDecoded = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_EQ(expectedPositiveShortHashes, positiveShortHashes);
+		EXPECT_EQ(expectedNegativeShortHashes, negativeShortHashes);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSketchWithTooManyShortHashes) {
+		// Arrange:
+		auto sketch = CreateSketch(30, GenerateRandomShortHashes(100));
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+
+		// Act:
+		auto isDecoded = sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_FALSE(isDecoded);
+	}
+
+	TEST(TEST_CLASS, TryDecodeDoesNotModifySketch) {
+		// Arrange:
+		auto sketch = CreateSketch(30, GenerateRandomShortHashes(5));
+		std::vector<ShortHashSketch::Cell> originalCells(sketch.data(), sketch.data() + sketch.size());
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+
+		// Act:
+		sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_EQ_MEMORY(originalCells.data(), sketch.data(), 30 * sizeof(ShortHashSketch::Cell));
+	}
+
+	// endregion
+
+	// region fold
+
+	TEST(TEST_CLASS, FoldedSketchIsEqualToSketchCreatedWithFoldedSize) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(100);
+		auto sketch = CreateSketch(96, shortHashes);
+
+		for (auto numCells : { 3u, 6u, 24u, 48u, 96u }) {
+			// Act:
+			auto foldedSketch = sketch.fold(numCells);
+
+			// Assert:
+			auto expectedSketch = CreateSketch(numCells, shortHashes);
+			ASSERT_EQ(numCells, foldedSketch.size()) << numCells;
+			EXPECT_EQ_MEMORY(expectedSketch.data(), foldedSketch.data(), numCells * sizeof(ShortHashSketch::Cell)) << numCells;
+		}
+	}
+
+	TEST(TEST_CLASS, CanDecodeFoldedSketch) {
+		// Arrange:
+		auto shortHashes = GenerateRandomShortHashes(5);
+		auto sketch = CreateSketch(ShortHashSketch::Max_Remote_Cells, shortHashes);
+		ShortHashesSet positiveShortHashes;
+		ShortHashesSet negativeShortHashes;
+
+		// Act:
+		auto isDecoded = sketch.fold(96).tryDecode(positiveShortHashes, negativeShortHashes);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_EQ(shortHashes, positiveShortHashes);
+		EXPECT_TRUE(negativeShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CannotFoldSketchIntoIncompatibleSize) {
+		// Arrange:
+		ShortHashSketch sketch(96);
+
+		// Act + Assert:
+		for (auto numCells : { 0u, 4u, 9u, 30u, 192u })
+			EXPECT_THROW(sketch.fold(numCells), catapult_invalid_argument) << numCells;
+	}
+
+	// endregion
+
+	// region tryDecode - adversarial
+
+	namespace {
+		using Cell = ShortHashSketch::Cell;
+
+		uint32_t GetCheckSum(size_t numCells, ShortHash shortHash) {
+			auto sketch = CreateSketch(numCells, { shortHash });
+			for (auto i = 0u; i < sketch.size(); ++i) {
+				if (0 != sketch.data()[i].Count)
+					return sketch.data()[i].CheckSum;
+			}
+
+			return 0;
+		}
+
+		std::vector<size_t> GetMappedCellIndexes(size_t numCells, ShortHash shortHash) {
+			auto sketch = CreateSketch(numCells, { shortHash });
+			std::vector<size_t> indexes;
+			for (auto i = 0u; i < sketch.size(); ++i) {
+				if (0 != sketch.data()[i].Count)
+					indexes.push_back(i);
+			}
+
+			return indexes;
+		}
+
+		bool TryDecode(const ShortHashSketch& sketch) {
+			ShortHashesSet positiveShortHashes;
+			ShortHashesSet negativeShortHashes;
+			return sketch.tryDecode(positiveShortHashes, negativeShortHashes);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSubtractedSketchWithPureCellsOutsideOfMappedCells) {
+		// Arrange: remote cells with pure looking cells that are not mapped to their key (previously never terminated)
+		auto checkSum = GetCheckSum(6, ShortHash(5));
+		std::vector<Cell> remoteCells{ { 0, 0, 0 }, { 2, 0, 0 }, { 1, 5, checkSum }, { 0, 0, 0 }, { 1, 5, checkSum }, { 0, 0, 0 } };
+
+		ShortHashSketch sketch(6);
+		sketch.subtract(ShortHashSketch(std::move(remoteCells)));
+
+		// Act + Assert:
+		EXPECT_FALSE(TryDecode(sketch));
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSketchWithPureCellOutsideOfMappedCells) {
+		// Arrange: place a pure cell for short hash in every cell it is not mapped to
+		auto shortHash = ShortHash(0x1234'5678);
+		auto checkSum = GetCheckSum(30, shortHash);
+		auto mappedIndexes = GetMappedCellIndexes(30, shortHash);
+
+		// Sanity:
+		ASSERT_EQ(ShortHashSketch::Num_Hash_Functions, mappedIndexes.size());
+
+		for (auto i = 0u; i < 30; ++i) {
+			if (mappedIndexes.cend() != std::find(mappedIndexes.cbegin(), mappedIndexes.cend(), i))
+				continue;
+
+			std::vector<Cell> cells(30, Cell());
+			cells[i] = { 1, shortHash.unwrap(), checkSum };
+
+			// Act + Assert:
+			EXPECT_FALSE(TryDecode(ShortHashSketch(std::move(cells)))) << "cell at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSketchThatYieldsSameShortHashMultipleTimes) {
+		// Arrange: change second mapped cell so that it becomes pure after the short hash is peeled from first mapped cell
+		auto shortHash = ShortHash(0x1234'5678);
+		auto sketch = CreateSketch(30, { shortHash });
+		std::vector<Cell> cells(sketch.data(), sketch.data() + sketch.size());
+		auto mappedIndexes = GetMappedCellIndexes(30, shortHash);
+		for (auto i = 1u; i < mappedIndexes.size(); ++i)
+			cells[mappedIndexes[i]] = { 2, 0, 0 };
+
+		// Act + Assert:
+		EXPECT_FALSE(TryDecode(ShortHashSketch(std::move(cells))));
+	}
+
+	TEST(TEST_CLASS, TryDecodeTerminatesForRandomCells) {
+		// Arrange:
+		for (auto i = 0u; i < 1000; ++i) {
+			// - use small key space so that many cells collide
+			std::vector<Cell> cells(6);
+			for (auto& cell : cells) {
+				auto key = static_cast<uint32_t>(test::Random() % 4);
+				cell = { static_cast<int32_t>(test::Random() % 5) - 2, key, GetCheckSum(6, ShortHash(key)) };
+			}
+
+			// Act + Assert: no hang
+			TryDecode(ShortHashSketch(std::move(cells)));
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSketchWithExtremeCounts) {
+		// Arrange: pure cell for short hash with all other mapped cells at extreme counts
+		auto shortHash = ShortHash(0x1234'5678);
+		auto sketch = CreateSketch(30, { shortHash });
+		std::vector<Cell> cells(sketch.data(), sketch.data() + sketch.size());
+		auto mappedIndexes = GetMappedCellIndexes(30, shortHash);
+		cells[mappedIndexes[1]].Count = std::numeric_limits<int32_t>::min();
+		cells[mappedIndexes[2]].Count = std::numeric_limits<int32_t>::max();
+
+		// Act + Assert: counts wrap around when short hash is peeled
+		EXPECT_FALSE(TryDecode(ShortHashSketch(std::move(cells))));
+	}
+
+	// endregion
+}}
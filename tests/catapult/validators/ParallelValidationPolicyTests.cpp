@@ -427,22 +427,20 @@ namespace catapult { namespace validators {
 		}
 
 		template<typename TTraits>
-		void AssertCanDistributeWorkEvenly(size_t numEntities) {
+		void AssertCanDistributeWorkAcrossAllThreads(size_t numEntities) {
 			// Act:
 			ValidateMany<TTraits>(numEntities, [numEntities](const auto& state) {
 				// Assert: validator was called numEntities times (with a unique entity)
-				auto minWorkPerThread = numEntities / Num_Default_Threads;
 				EXPECT_EQ(numEntities, state.counter());
 				EXPECT_EQ(numEntities, state.numUniqueItems());
 
-				// - the work was distributed evenly across threads
-				//   (a thread can do more than the min amount of work if the number of entities is not divisible by
-				//    the number of threads)
+				// - the work was distributed across all threads
+				//   (entities are claimed dynamically in batches, so threads that finish their batches faster do more work)
 				for (auto counter : state.threadCounters())
-					EXPECT_LE(minWorkPerThread, counter);
+					EXPECT_LE(1u, counter);
 
+				// - notice that batches processed by the same thread are not necessarily contiguous
 				EXPECT_EQ(Num_Default_Threads, state.threadCounters().size());
-				EXPECT_EQ(Num_Default_Threads, state.sortedAndReducedThreadIds().size());
 			});
 		}
 	}
@@ -455,12 +453,62 @@ namespace catapult { namespace validators {
 		AssertCanHandleManyValidatorsAndEntities<TTraits>(Num_Default_Threads / 4 * 81);
 	}
 
-	PARALLEL_POLICY_TEST(CanDistributeWorkEvenlyWhenEntitiesAreMultipleOfThreads) {
-		AssertCanDistributeWorkEvenly<TTraits>(Num_Default_Threads * 20);
+	PARALLEL_POLICY_TEST(CanDistributeWorkAcrossAllThreadsWhenEntitiesAreMultipleOfThreads) {
+		AssertCanDistributeWorkAcrossAllThreads<TTraits>(Num_Default_Threads * 20);
 	}
 
-	PARALLEL_POLICY_TEST(CanDistributeWorkEvenlyWhenEntitiesAreNotMultipleOfThreads) {
-		AssertCanDistributeWorkEvenly<TTraits>(Num_Default_Threads / 4 * 81);
+	PARALLEL_POLICY_TEST(CanDistributeWorkAcrossAllThreadsWhenEntitiesAreNotMultipleOfThreads) {
+		AssertCanDistributeWorkAcrossAllThreads<TTraits>(Num_Default_Threads / 4 * 81);
+	}
+
+	namespace {
+		class BlockFirstEntityStatelessEntityValidator : public StatelessEntityValidator {
+		public:
+			explicit BlockFirstEntityStatelessEntityValidator(size_t numUnblockingValidations)
+					: m_numUnblockingValidations(numUnblockingValidations)
+					, m_name("BlockFirstEntityStatelessEntityValidator")
+					, m_counter(0)
+			{}
+
+		public:
+			size_t numValidateCalls() const {
+				return m_counter;
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			ValidationResult validate(const model::WeakEntityInfo& entityInfo) const override {
+				// block validation of the first entity until enough other entities have been validated
+				if (0 == entityInfo.cast<model::Transaction>().entity().Deadline.unwrap())
+					WAIT_FOR_EXPR(m_counter >= m_numUnblockingValidations);
+
+				++m_counter;
+				return ValidationResult::Success;
+			}
+
+		private:
+			size_t m_numUnblockingValidations;
+			std::string m_name;
+			mutable std::atomic<size_t> m_counter;
+		};
+	}
+
+	PARALLEL_POLICY_TEST(SlowEntityDoesNotDelayValidationOfOtherEntities) {
+		// Arrange: use two threads and block the first entity until 90 entities have been validated
+		//         (if entities were split evenly between threads, only 50 entities could be validated by the other thread)
+		auto pValidator = std::make_shared<BlockFirstEntityStatelessEntityValidator>(90);
+		auto pPolicy = CreatePolicy(pValidator, 2);
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(100);
+		auto result = TTraits::Validate(*pPolicy, entityInfos.toVector()).get();
+
+		// Assert:
+		EXPECT_TRUE(TTraits::IsSuccess(result));
+		EXPECT_EQ(100u, pValidator->numValidateCalls());
 	}
 
 	// endregion
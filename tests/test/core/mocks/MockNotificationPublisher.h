@@ -20,10 +20,11 @@
 
 #pragma once
 #include "catapult/model/NotificationPublisher.h"
+#include <atomic>
 
 namespace catapult { namespace mocks {
 
-	/// Mock notification publisher that counts the number of publish calls.
+	/// Mock notification publisher that counts the number of (possibly concurrent) publish calls.
 	class MockNotificationPublisher : public model::NotificationPublisher {
 	public:
 		/// Creates a mock notification publisher.
@@ -42,6 +43,6 @@ namespace catapult { namespace mocks {
 		}
 
 	private:
-		mutable size_t m_numPublishCalls;
+		mutable std::atomic<size_t> m_numPublishCalls;
 	};
 }}
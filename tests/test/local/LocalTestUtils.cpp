@@ -52,6 +52,7 @@ namespace catapult { namespace test {
 
 			config.MaxBlocksPerSyncAttempt = 4 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+			config.MaxPendingBlockRangeRequests = 1;
 
 			config.ShortLivedCacheMaxSize = 10;
 
@@ -69,6 +70,8 @@ namespace catapult { namespace test {
 			config.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromMegabytes(5);
 			config.MaxTrackedNodes = 5'000;
 
+			config.MaxBlocksPerRecoveryCommit = 1;
+
 			config.BatchVerificationRandomSource = "/dev/urandom";
 
 			config.Local.Host = "127.0.0.1";
@@ -322,7 +322,24 @@ namespace catapult { namespace test {
 				Height expectedHeight,
 				model::ImportanceHeight expectedImportanceHeight,
 				const predicate<size_t>& isRollbackExecution) {
+			std::vector<size_t> expectedNumStatistics;
+			for (auto i = 0u; i < observer.params().size(); ++i)
+				expectedNumStatistics.push_back(numInitialCacheStatistics + i);
+
+			AssertObserverContexts(observer, expectedNumStatistics, expectedHeight, expectedImportanceHeight, isRollbackExecution);
+		}
+
+		/// Asserts observer contexts passed to \a observer reflect \a expectedNumStatistics
+		/// given \a expectedHeight, \a expectedImportanceHeight and \a isRollbackExecution.
+		static void AssertObserverContexts(
+				const MockAggregateNotificationObserver& observer,
+				const std::vector<size_t>& expectedNumStatistics,
+				Height expectedHeight,
+				model::ImportanceHeight expectedImportanceHeight,
+				const predicate<size_t>& isRollbackExecution) {
 			// Assert:
+			ASSERT_EQ(expectedNumStatistics.size(), observer.params().size());
+
 			size_t i = 0;
 			for (const auto& params : observer.params()) {
 				auto message = "observer at " + std::to_string(i);
@@ -341,7 +358,7 @@ namespace catapult { namespace test {
 
 				// - cache contents + sequence (NumStatistics is incremented by each observer call)
 				EXPECT_TRUE(params.IsPassedMarkedCache) << message;
-				EXPECT_EQ(numInitialCacheStatistics + i, params.NumStatistics) << message;
+				EXPECT_EQ(expectedNumStatistics[i], params.NumStatistics) << message;
 				++i;
 			}
 		}
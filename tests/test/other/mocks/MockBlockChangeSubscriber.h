@@ -38,6 +38,11 @@ namespace catapult { namespace mocks {
 			return m_copiedBlockElements;
 		}
 
+		/// Gets the sizes of the captured block batches.
+		const auto& blockBatchSizes() const {
+			return m_blockBatchSizes;
+		}
+
 		/// Gets the captured drop blocks after heights.
 		const auto& dropBlocksAfterHeights() const {
 			return m_dropBlocksAfterHeights;
@@ -49,6 +54,11 @@ namespace catapult { namespace mocks {
 			m_copiedBlockElements.push_back(copy(blockElement));
 		}
 
+		void notifyBlocks(const std::vector<model::BlockElement>& blockElements) override {
+			m_blockBatchSizes.push_back(blockElements.size());
+			io::BlockChangeSubscriber::notifyBlocks(blockElements);
+		}
+
 		void notifyDropBlocksAfter(Height height) override {
 			m_dropBlocksAfterHeights.push_back(height);
 		}
@@ -69,6 +79,7 @@ namespace catapult { namespace mocks {
 		std::vector<const model::BlockElement*> m_blockElements;
 		std::vector<std::unique_ptr<model::Block>> m_copiedBlocks;
 		std::vector<std::unique_ptr<model::BlockElement>> m_copiedBlockElements;
+		std::vector<size_t> m_blockBatchSizes;
 		std::vector<Height> m_dropBlocksAfterHeights;
 	};
 }}
@@ -0,0 +1,122 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NodeProcess.h"
+#include "catapult/utils/Logging.h"
+#include <boost/process.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+namespace catapult { namespace tools { namespace throughput {
+
+	namespace {
+		constexpr auto Termination_Timeout = std::chrono::seconds(30);
+	}
+
+	ProcessUsage GetProcessUsage(int processId) {
+		ProcessUsage usage;
+#ifdef __linux__
+		auto procDirectory = "/proc/" + std::to_string(processId);
+
+		// utime and stime are the 14th and 15th fields in stat and the process name (2nd field) is enclosed in parentheses
+		std::ifstream statInput(procDirectory + "/stat");
+		std::string stat((std::istreambuf_iterator<char>(statInput)), std::istreambuf_iterator<char>());
+		auto closingParenthesisIndex = stat.rfind(')');
+		if (std::string::npos != closingParenthesisIndex) {
+			std::istringstream fieldsInput(stat.substr(closingParenthesisIndex + 1));
+			std::string field;
+			for (auto i = 3u; i < 14; ++i)
+				fieldsInput >> field;
+
+			uint64_t userTicks = 0;
+			uint64_t systemTicks = 0;
+			fieldsInput >> userTicks >> systemTicks;
+			usage.CpuMillis = (userTicks + systemTicks) * 1000 / static_cast<uint64_t>(sysconf(_SC_CLK_TCK));
+		}
+
+		uint64_t numPages = 0;
+		uint64_t numResidentPages = 0;
+		std::ifstream statmInput(procDirectory + "/statm");
+		statmInput >> numPages >> numResidentPages;
+		usage.ResidentBytes = numResidentPages * static_cast<uint64_t>(sysconf(_SC_PAGE_SIZE));
+#else
+		static_cast<void>(processId);
+#endif
+		return usage;
+	}
+
+	int RunProcess(const std::string& path, const std::vector<std::string>& args, const std::string& workingDirectory) {
+		CATAPULT_LOG(info) << "running " << path << " in " << workingDirectory;
+		return boost::process::system(path, boost::process::args(args), boost::process::start_dir(workingDirectory));
+	}
+
+	NodeProcess::NodeProcess(const std::string& serverPath, const std::string& nodeDirectory)
+			: m_nodeDirectory(nodeDirectory)
+			, m_process(
+					serverPath,
+					boost::process::args({ nodeDirectory }),
+					boost::process::start_dir(nodeDirectory),
+					boost::process::std_out > boost::process::null,
+					boost::process::std_err > boost::process::null) {
+		CATAPULT_LOG(info) << "started node " << m_nodeDirectory << " with pid " << m_process.id();
+	}
+
+	NodeProcess::~NodeProcess() {
+		if (!m_process.running())
+			return;
+
+		// request a graceful shutdown and forcibly terminate the process if it does not exit in time
+		CATAPULT_LOG(info) << "stopping node " << m_nodeDirectory;
+#ifdef _WIN32
+		m_process.terminate();
+#else
+		kill(m_process.id(), SIGTERM);
+#endif
+
+		auto start = std::chrono::steady_clock::now();
+		while (m_process.running() && std::chrono::steady_clock::now() - start < Termination_Timeout)
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+		if (m_process.running()) {
+			CATAPULT_LOG(warning) << "terminating node " << m_nodeDirectory;
+			m_process.terminate();
+		}
+
+		m_process.wait();
+	}
+
+	const std::string& NodeProcess::directory() const {
+		return m_nodeDirectory;
+	}
+
+	bool NodeProcess::isRunning() {
+		return m_process.running();
+	}
+
+	ProcessUsage NodeProcess::usage() const {
+		return GetProcessUsage(m_process.id());
+	}
+}}}
@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <boost/process/child.hpp>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace tools { namespace throughput {
+
+	/// Resource usage of a process.
+	struct ProcessUsage {
+		/// Total (user and system) cpu time in milliseconds.
+		uint64_t CpuMillis = 0;
+
+		/// Resident set size in bytes.
+		uint64_t ResidentBytes = 0;
+	};
+
+	/// Gets the resource usage of the process with id \a processId.
+	/// \note Resource usage is only available on linux and is zero on other platforms.
+	ProcessUsage GetProcessUsage(int processId);
+
+	/// Runs the executable at \a path with \a args in \a workingDirectory and returns its exit code.
+	int RunProcess(const std::string& path, const std::vector<std::string>& args, const std::string& workingDirectory);
+
+	/// Node process that is started on construction and terminated on destruction.
+	class NodeProcess {
+	public:
+		/// Starts the server executable at \a serverPath for the node in \a nodeDirectory.
+		NodeProcess(const std::string& serverPath, const std::string& nodeDirectory);
+
+		/// Terminates the node process.
+		~NodeProcess();
+
+	public:
+		/// Gets the node directory.
+		const std::string& directory() const;
+
+		/// Returns \c true if the node process is running.
+		bool isRunning();
+
+		/// Gets the current resource usage of the node process.
+		ProcessUsage usage() const;
+
+	private:
+		std::string m_nodeDirectory;
+		boost::process::child m_process;
+	};
+}}}
@@ -0,0 +1,120 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ThroughputRecorder.h"
+#include <algorithm>
+#include <numeric>
+#include <ostream>
+
+namespace catapult { namespace tools { namespace throughput {
+
+	namespace {
+		uint64_t CalculateLatency(Timestamp start, Timestamp end) {
+			return end > start ? (end - start).unwrap() : 0;
+		}
+
+		LatencyStatistics CalculateStatistics(std::vector<uint64_t>&& latencies) {
+			LatencyStatistics statistics;
+			if (latencies.empty())
+				return statistics;
+
+			std::sort(latencies.begin(), latencies.end());
+			statistics.Count = latencies.size();
+			statistics.Mean = std::accumulate(latencies.cbegin(), latencies.cend(), static_cast<uint64_t>(0)) / latencies.size();
+			statistics.Median = latencies[latencies.size() / 2];
+			statistics.Percentile95 = latencies[(latencies.size() - 1) * 95 / 100];
+			statistics.Max = latencies.back();
+			return statistics;
+		}
+	}
+
+	std::ostream& operator<<(std::ostream& out, const LatencyStatistics& statistics) {
+		out
+				<< "mean " << statistics.Mean << "ms, median " << statistics.Median << "ms, p95 " << statistics.Percentile95
+				<< "ms, max " << statistics.Max << "ms (" << statistics.Count << " samples)";
+		return out;
+	}
+
+	void ThroughputRecorder::addPushed(const Hash256& hash, size_t nodeIndex, Timestamp timestamp, bool isProbe) {
+		m_transactionStates.emplace(hash, TransactionState{ nodeIndex, timestamp, isProbe, Timestamp(), Timestamp() });
+	}
+
+	model::ShortHashRange ThroughputRecorder::knownShortHashes(size_t nodeIndex) const {
+		std::vector<utils::ShortHash> shortHashes;
+		for (const auto& pair : m_transactionStates) {
+			const auto& state = pair.second;
+			if (state.IsProbe && nodeIndex == state.NodeIndex && Timestamp() == state.ObservedTimestamp)
+				continue;
+
+			shortHashes.push_back(utils::ToShortHash(pair.first));
+		}
+
+		auto shortHashRange = model::ShortHashRange::PrepareFixed(shortHashes.size());
+		std::copy(shortHashes.cbegin(), shortHashes.cend(), shortHashRange.begin());
+		return shortHashRange;
+	}
+
+	bool ThroughputRecorder::markObserved(const Hash256& hash, Timestamp timestamp) {
+		auto iter = m_transactionStates.find(hash);
+		if (m_transactionStates.cend() == iter || !iter->second.IsProbe || Timestamp() != iter->second.ObservedTimestamp)
+			return false;
+
+		iter->second.ObservedTimestamp = timestamp;
+		return true;
+	}
+
+	bool ThroughputRecorder::markConfirmed(const Hash256& hash, Timestamp blockTimestamp) {
+		auto iter = m_transactionStates.find(hash);
+		if (m_transactionStates.cend() == iter || Timestamp() != iter->second.ConfirmedTimestamp)
+			return false;
+
+		iter->second.ConfirmedTimestamp = blockTimestamp;
+		return true;
+	}
+
+	ThroughputSummary ThroughputRecorder::summarize() const {
+		ThroughputSummary summary;
+		summary.NumPushed = m_transactionStates.size();
+
+		Timestamp firstPushTimestamp;
+		Timestamp lastConfirmedTimestamp;
+		std::vector<uint64_t> utLatencies;
+		std::vector<uint64_t> inclusionLatencies;
+		for (const auto& pair : m_transactionStates) {
+			const auto& state = pair.second;
+			if (Timestamp() == firstPushTimestamp || state.PushTimestamp < firstPushTimestamp)
+				firstPushTimestamp = state.PushTimestamp;
+
+			if (Timestamp() != state.ObservedTimestamp)
+				utLatencies.push_back(CalculateLatency(state.PushTimestamp, state.ObservedTimestamp));
+
+			if (Timestamp() != state.ConfirmedTimestamp) {
+				++summary.NumConfirmed;
+				lastConfirmedTimestamp = std::max(lastConfirmedTimestamp, state.ConfirmedTimestamp);
+				inclusionLatencies.push_back(CalculateLatency(state.PushTimestamp, state.ConfirmedTimestamp));
+			}
+		}
+
+		summary.ElapsedMillis = CalculateLatency(firstPushTimestamp, lastConfirmedTimestamp);
+		summary.UtLatency = CalculateStatistics(std::move(utLatencies));
+		summary.InclusionLatency = CalculateStatistics(std::move(inclusionLatencies));
+		return summary;
+	}
+}}}
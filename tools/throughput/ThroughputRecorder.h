@@ -0,0 +1,101 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/RangeTypes.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/types.h"
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace tools { namespace throughput {
+
+	/// Latency statistics in milliseconds.
+	struct LatencyStatistics {
+		/// Number of samples.
+		size_t Count = 0;
+
+		/// Mean latency.
+		uint64_t Mean = 0;
+
+		/// Median latency.
+		uint64_t Median = 0;
+
+		/// 95th percentile latency.
+		uint64_t Percentile95 = 0;
+
+		/// Maximum latency.
+		uint64_t Max = 0;
+	};
+
+	/// Insertion operator for outputting \a statistics to \a out.
+	std::ostream& operator<<(std::ostream& out, const LatencyStatistics& statistics);
+
+	/// Throughput summary.
+	struct ThroughputSummary {
+		/// Number of pushed transactions.
+		size_t NumPushed = 0;
+
+		/// Number of confirmed transactions.
+		size_t NumConfirmed = 0;
+
+		/// Time between the first push and the last confirmation in milliseconds.
+		uint64_t ElapsedMillis = 0;
+
+		/// Latency between pushing a probe transaction and observing it in the unconfirmed transactions cache.
+		LatencyStatistics UtLatency;
+
+		/// Latency between pushing a transaction and the timestamp of the block including it.
+		LatencyStatistics InclusionLatency;
+	};
+
+	/// Records the lifecycle of pushed transactions.
+	class ThroughputRecorder {
+	public:
+		/// Adds a transaction with \a hash pushed to the node with \a nodeIndex at \a timestamp.
+		/// \a isProbe should be \c true if the node should be polled for the transaction.
+		void addPushed(const Hash256& hash, size_t nodeIndex, Timestamp timestamp, bool isProbe);
+
+		/// Gets the short hashes of all pushed transactions except for unobserved probes pushed to the node with \a nodeIndex.
+		/// \note These are the short hashes that the node can be told about so that only unobserved probes are returned.
+		model::ShortHashRange knownShortHashes(size_t nodeIndex) const;
+
+		/// Marks the probe with \a hash as observed in the unconfirmed transactions cache at \a timestamp.
+		bool markObserved(const Hash256& hash, Timestamp timestamp);
+
+		/// Marks the transaction with \a hash as confirmed in a block with \a blockTimestamp.
+		bool markConfirmed(const Hash256& hash, Timestamp blockTimestamp);
+
+		/// Summarizes all recorded transactions.
+		ThroughputSummary summarize() const;
+
+	private:
+		struct TransactionState {
+			size_t NodeIndex;
+			Timestamp PushTimestamp;
+			bool IsProbe;
+			Timestamp ObservedTimestamp;
+			Timestamp ConfirmedTimestamp;
+		};
+
+	private:
+		std::unordered_map<Hash256, TransactionState, utils::ArrayHasher<Hash256>> m_transactionStates;
+	};
+}}}
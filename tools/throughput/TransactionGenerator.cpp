@@ -0,0 +1,97 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionGenerator.h"
+#include "tools/ToolKeys.h"
+#include "catapult/builders/AggregateTransactionBuilder.h"
+#include "catapult/builders/TransferBuilder.h"
+#include "catapult/model/Address.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace tools { namespace throughput {
+
+	TransactionGenerator::TransactionGenerator(
+			model::NetworkIdentifier networkIdentifier,
+			const GenerationHashSeed& generationHashSeed,
+			const TransactionGeneratorOptions& options)
+			: m_networkIdentifier(networkIdentifier)
+			, m_transactionExtensions(generationHashSeed)
+			, m_options(options)
+			, m_numGeneratedTransactions(0)
+			, m_message(0) {
+		if (0 == m_options.NumAccounts)
+			CATAPULT_THROW_INVALID_ARGUMENT("at least one sender account is required");
+
+		for (auto i = 0u; i < m_options.NumAccounts; ++i)
+			m_senders.push_back(GenerateRandomKeyPair());
+	}
+
+	std::shared_ptr<model::Transaction> TransactionGenerator::next(Timestamp deadline) {
+		const auto& sender = m_senders[m_numGeneratedTransactions % m_senders.size()];
+		auto isAggregate = m_numGeneratedTransactions % 100 < m_options.AggregatePercentage;
+		++m_numGeneratedTransactions;
+
+		auto pTransaction = isAggregate ? createAggregate(sender, deadline) : createTransfer(sender, deadline);
+		m_transactionExtensions.sign(sender, *pTransaction);
+		return pTransaction;
+	}
+
+	Hash256 TransactionGenerator::hash(const model::Transaction& transaction) const {
+		return m_transactionExtensions.hash(transaction);
+	}
+
+	std::unique_ptr<model::Transaction> TransactionGenerator::createTransfer(const crypto::KeyPair& sender, Timestamp deadline) {
+		builders::TransferBuilder builder(m_networkIdentifier, sender.publicKey());
+		builder.setRecipientAddress(nextRecipient());
+		builder.setMessage(nextMessage());
+		builder.setDeadline(deadline);
+		builder.setMaxFee(m_options.MaxFee);
+		return builder.build();
+	}
+
+	std::unique_ptr<model::Transaction> TransactionGenerator::createAggregate(const crypto::KeyPair& sender, Timestamp deadline) {
+		builders::AggregateTransactionBuilder builder(m_networkIdentifier, sender.publicKey());
+		for (auto i = 0u; i < m_options.NumAggregateTransfers; ++i) {
+			builders::TransferBuilder transferBuilder(m_networkIdentifier, sender.publicKey());
+			transferBuilder.setRecipientAddress(nextRecipient());
+			transferBuilder.setMessage(nextMessage());
+			builder.addTransaction(transferBuilder.buildEmbedded());
+		}
+
+		builder.setDeadline(deadline);
+		builder.setMaxFee(m_options.MaxFee);
+
+		// all embedded transactions are signed by the sender, so the aggregate can be complete without any cosignatures
+		auto pTransaction = builder.build();
+		pTransaction->Type = model::Entity_Type_Aggregate_Complete;
+		return pTransaction;
+	}
+
+	UnresolvedAddress TransactionGenerator::nextRecipient() {
+		const auto& recipient = m_senders[(m_message + 1) % m_senders.size()];
+		return model::PublicKeyToAddress(recipient.publicKey(), m_networkIdentifier).copyTo<UnresolvedAddress>();
+	}
+
+	RawBuffer TransactionGenerator::nextMessage() {
+		// use a unique message so that all generated transactions have distinct hashes
+		++m_message;
+		return { reinterpret_cast<const uint8_t*>(&m_message), sizeof(uint64_t) };
+	}
+}}}
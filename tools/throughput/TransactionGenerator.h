@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/crypto/KeyPair.h"
+#include "catapult/model/NetworkIdentifier.h"
+#include "catapult/model/Transaction.h"
+#include "catapult/extensions/TransactionExtensions.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace tools { namespace throughput {
+
+	/// Transaction generator options.
+	struct TransactionGeneratorOptions {
+		/// Number of sender accounts.
+		uint32_t NumAccounts;
+
+		/// Maximum fee of each transaction.
+		Amount MaxFee;
+
+		/// Percentage of generated transactions that are aggregate transactions.
+		uint32_t AggregatePercentage;
+
+		/// Number of transfers embedded in each aggregate transaction.
+		uint32_t NumAggregateTransfers;
+	};
+
+	/// Generates signed transfer and aggregate complete transactions from random sender accounts.
+	class TransactionGenerator {
+	public:
+		/// Creates a generator for the network with \a networkIdentifier and \a generationHashSeed around \a options.
+		TransactionGenerator(
+				model::NetworkIdentifier networkIdentifier,
+				const GenerationHashSeed& generationHashSeed,
+				const TransactionGeneratorOptions& options);
+
+	public:
+		/// Generates the next transaction with \a deadline.
+		std::shared_ptr<model::Transaction> next(Timestamp deadline);
+
+		/// Calculates the hash of \a transaction.
+		Hash256 hash(const model::Transaction& transaction) const;
+
+	private:
+		std::unique_ptr<model::Transaction> createTransfer(const crypto::KeyPair& sender, Timestamp deadline);
+
+		std::unique_ptr<model::Transaction> createAggregate(const crypto::KeyPair& sender, Timestamp deadline);
+
+		UnresolvedAddress nextRecipient();
+
+		RawBuffer nextMessage();
+
+	private:
+		model::NetworkIdentifier m_networkIdentifier;
+		extensions::TransactionExtensions m_transactionExtensions;
+		TransactionGeneratorOptions m_options;
+		std::vector<crypto::KeyPair> m_senders;
+		uint64_t m_numGeneratedTransactions;
+		uint64_t m_message;
+	};
+}}}
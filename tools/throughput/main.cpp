@@ -0,0 +1,447 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NodeProcess.h"
+#include "ThroughputRecorder.h"
+#include "TransactionGenerator.h"
+#include "tools/ToolConfigurationUtils.h"
+#include "tools/ToolMain.h"
+#include "tools/ToolNetworkUtils.h"
+#include "tools/ToolThreadUtils.h"
+#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "plugins/txes/aggregate/src/plugins/AggregateTransactionPlugin.h"
+#include "plugins/txes/transfer/src/plugins/TransferTransactionPlugin.h"
+#include "catapult/api/RemoteChainApi.h"
+#include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/config/CatapultKeys.h"
+#include "catapult/crypto/OpensslKeyUtils.h"
+#include "catapult/ionet/BroadcastUtils.h"
+#include "catapult/ionet/Node.h"
+#include "catapult/ionet/PacketIo.h"
+#include "catapult/model/TransactionPlugin.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/ConfigurationBag.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/NetworkTime.h"
+#include "catapult/utils/StackLogger.h"
+#include <boost/filesystem.hpp>
+#include <thread>
+
+namespace catapult { namespace tools { namespace throughput {
+
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		// region local network
+
+		boost::filesystem::path ResolvePath(const std::string& nodeDirectory, const std::string& path) {
+			// relative paths in node configuration are relative to the node directory, which is the working directory of the node
+			return boost::filesystem::absolute(path, nodeDirectory);
+		}
+
+		ionet::Node LoadLocalNode(const std::string& nodeDirectory, const model::UniqueNetworkFingerprint& networkFingerprint) {
+			auto config = LoadConfiguration(nodeDirectory);
+			auto certificateDirectory = ResolvePath(nodeDirectory, config.User.CertificateDirectory).generic_string();
+			auto caPublicKey = crypto::ReadPublicKeyFromPublicKeyPemFile(config::GetCaPublicKeyPemFilename(certificateDirectory));
+			return ionet::Node(
+					{ caPublicKey, "127.0.0.1" },
+					{ "127.0.0.1", config.Node.Port },
+					{ networkFingerprint, nodeDirectory });
+		}
+
+		void SeedDataDirectory(const std::string& nodeDirectory, const boost::filesystem::path& seedDirectory) {
+			auto config = LoadConfiguration(nodeDirectory);
+			auto dataDirectory = ResolvePath(nodeDirectory, config.User.DataDirectory);
+			if (boost::filesystem::exists(dataDirectory) && !boost::filesystem::is_empty(dataDirectory)) {
+				CATAPULT_LOG(info) << "skipping seeding of nonempty data directory " << dataDirectory;
+				return;
+			}
+
+			CATAPULT_LOG(info) << "seeding data directory " << dataDirectory << " from " << seedDirectory;
+			boost::filesystem::create_directories(dataDirectory);
+			for (const auto& entry : boost::filesystem::recursive_directory_iterator(seedDirectory)) {
+				auto destinationPath = dataDirectory / boost::filesystem::relative(entry.path(), seedDirectory);
+				if (boost::filesystem::is_directory(entry.path()))
+					boost::filesystem::create_directories(destinationPath);
+				else
+					boost::filesystem::copy_file(entry.path(), destinationPath);
+			}
+		}
+
+		// endregion
+
+		class ThroughputTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Throughput Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("resources,r",
+						OptionsValue<std::string>(m_resourcesPath)->default_value(".."),
+						"the path to the resources directory of the tool");
+				optionsBuilder("node,n",
+						OptionsValue<std::vector<std::string>>(m_nodeDirectories)->multitoken(),
+						"the directories of local nodes to start (default: connect to running peers in resources)");
+				optionsBuilder("binDirectory,b",
+						OptionsValue<std::string>(m_binDirectory)->default_value("."),
+						"the directory containing the server and nemgen executables");
+				optionsBuilder("nemesisProperties,p",
+						OptionsValue<std::string>(m_nemesisPropertiesFilePath),
+						"the path to the nemesis properties file used to seed empty node data directories");
+
+				optionsBuilder("rate",
+						OptionsValue<uint32_t>(m_rate)->default_value(100),
+						"the number of transactions to push per second");
+				optionsBuilder("batchSize",
+						OptionsValue<uint32_t>(m_batchSize)->default_value(10),
+						"the number of transactions per push packet");
+				optionsBuilder("duration",
+						OptionsValue<uint32_t>(m_durationSeconds)->default_value(60),
+						"the number of seconds to push transactions");
+				optionsBuilder("drainTime",
+						OptionsValue<uint32_t>(m_drainSeconds)->default_value(60),
+						"the number of seconds to wait for block inclusion after pushing stops");
+				optionsBuilder("pollInterval",
+						OptionsValue<uint32_t>(m_pollIntervalMillis)->default_value(500),
+						"the number of milliseconds between polls of node caches and chains");
+				optionsBuilder("startupTimeout",
+						OptionsValue<uint32_t>(m_startupTimeoutSeconds)->default_value(120),
+						"the number of seconds to wait for nodes to accept connections");
+
+				optionsBuilder("accounts",
+						OptionsValue<uint32_t>(m_generatorOptions.NumAccounts)->default_value(100),
+						"the number of random sender accounts");
+				optionsBuilder("maxFee",
+						OptionsValue<uint64_t>(m_maxFee)->default_value(0),
+						"the maximum fee of each transaction");
+				optionsBuilder("aggregatePercentage",
+						OptionsValue<uint32_t>(m_generatorOptions.AggregatePercentage)->default_value(10),
+						"the percentage of transactions that are aggregate transactions");
+				optionsBuilder("aggregateTransfers",
+						OptionsValue<uint32_t>(m_generatorOptions.NumAggregateTransfers)->default_value(3),
+						"the number of transfers embedded in each aggregate transaction");
+			}
+
+			int run(const Options&) override {
+				if (0 == m_rate || 0 == m_batchSize)
+					CATAPULT_THROW_INVALID_ARGUMENT("rate and batch size must be nonzero");
+
+				auto config = LoadConfiguration(m_resourcesPath);
+				auto networkFingerprint = model::UniqueNetworkFingerprint(
+						config.BlockChain.Network.Identifier,
+						config.BlockChain.Network.GenerationHashSeed);
+
+				// 1. start local nodes or fall back to configured peers
+				std::vector<ionet::Node> nodes;
+				std::vector<std::unique_ptr<NodeProcess>> nodeProcesses;
+				if (m_nodeDirectories.empty()) {
+					nodes = LoadPeers(m_resourcesPath, networkFingerprint);
+					auto apiNodes = LoadOptionalApiPeers(m_resourcesPath, networkFingerprint);
+					nodes.insert(nodes.end(), apiNodes.cbegin(), apiNodes.cend());
+				} else {
+					prepareLocalNodes();
+					for (const auto& nodeDirectory : m_nodeDirectories) {
+						nodes.push_back(LoadLocalNode(nodeDirectory, networkFingerprint));
+						nodeProcesses.push_back(std::make_unique<NodeProcess>(serverPath(), nodeDirectory));
+					}
+				}
+
+				if (nodes.empty())
+					CATAPULT_THROW_INVALID_ARGUMENT("no nodes are available");
+
+				// 2. connect to all nodes
+				auto pPool = CreateStartedThreadPool();
+				auto connectionSettings = CreateToolConnectionSettings(config.User.CertificateDirectory);
+				connectionSettings.NetworkIdentifier = config.BlockChain.Network.Identifier;
+
+				m_pTransactionRegistry = createTransactionRegistry();
+				for (const auto& node : nodes)
+					m_nodeConnections.push_back(connect(connectionSettings, node, pPool));
+
+				// 3. push transactions and track them until they are confirmed
+				auto networkTime = utils::NetworkTime(config.BlockChain.Network.EpochAdjustment);
+				m_generatorOptions.MaxFee = Amount(m_maxFee);
+				TransactionGenerator generator(
+						config.BlockChain.Network.Identifier,
+						networkFingerprint.GenerationHashSeed,
+						m_generatorOptions);
+				auto deadlineOffset = Timestamp(config.BlockChain.MaxTransactionLifetime.millis() / 2);
+
+				m_chainHeight = m_nodeConnections[0].pChainApi->chainInfo().get().Height;
+				auto startUsages = sampleUsages(nodeProcesses);
+				auto startTime = Clock::now();
+
+				flood(generator, networkTime, deadlineOffset, nodeProcesses);
+				drain(generator, nodeProcesses);
+
+				auto elapsedMillis = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+						Clock::now() - startTime).count());
+				report(nodeProcesses, startUsages, sampleUsages(nodeProcesses), elapsedMillis);
+
+				// 4. disconnect before stopping the nodes
+				m_nodeConnections.clear();
+				pPool->join();
+				return 0;
+			}
+
+		private:
+			struct NodeConnection {
+				ionet::Node Node;
+				std::shared_ptr<ionet::PacketIo> pIo;
+				std::unique_ptr<api::RemoteChainApi> pChainApi;
+				std::unique_ptr<api::RemoteTransactionApi> pTransactionApi;
+			};
+
+		private:
+			std::string serverPath() const {
+				return (boost::filesystem::path(m_binDirectory) / "catapult.server").generic_string();
+			}
+
+			void prepareLocalNodes() const {
+				if (m_nemesisPropertiesFilePath.empty())
+					return;
+
+				// generate the nemesis block into the seed directory and copy it to all nodes with empty data directories
+				auto nemgenPath = (boost::filesystem::path(m_binDirectory) / "catapult.tools.nemgen").generic_string();
+				auto nemgenArgs = std::vector<std::string>{
+					"--resources", boost::filesystem::absolute(m_nodeDirectories[0]).generic_string(),
+					"--nemesisProperties", boost::filesystem::absolute(m_nemesisPropertiesFilePath).generic_string(),
+					"--no-summary"
+				};
+				if (0 != RunProcess(nemgenPath, nemgenArgs, boost::filesystem::current_path().generic_string()))
+					CATAPULT_THROW_RUNTIME_ERROR("nemesis block generation failed");
+
+				auto bag = utils::ConfigurationBag::FromPath(m_nemesisPropertiesFilePath);
+				auto seedDirectory = boost::filesystem::absolute(bag.get<std::string>(utils::ConfigurationKey("output", "binDirectory")));
+				for (const auto& nodeDirectory : m_nodeDirectories)
+					SeedDataDirectory(nodeDirectory, seedDirectory);
+			}
+
+			std::shared_ptr<model::TransactionRegistry> createTransactionRegistry() const {
+				auto pRegistry = std::make_shared<model::TransactionRegistry>();
+				pRegistry->registerPlugin(plugins::CreateTransferTransactionPlugin());
+				pRegistry->registerPlugin(plugins::CreateAggregateTransactionPlugin(*pRegistry, model::Entity_Type_Aggregate_Complete));
+				pRegistry->registerPlugin(plugins::CreateAggregateTransactionPlugin(*pRegistry, model::Entity_Type_Aggregate_Bonded));
+				return pRegistry;
+			}
+
+			NodeConnection connect(
+					const net::ConnectionSettings& connectionSettings,
+					const ionet::Node& node,
+					const std::shared_ptr<thread::IoThreadPool>& pPool) const {
+				// retry until the node has started and accepts connections
+				auto deadline = Clock::now() + std::chrono::seconds(m_startupTimeoutSeconds);
+				for (;;) {
+					try {
+						auto pIo = ConnectToNode(connectionSettings, node, pPool).get();
+						CATAPULT_LOG(info) << "connected to " << node;
+
+						const auto& identity = node.identity();
+						return NodeConnection{
+							node,
+							pIo,
+							api::CreateRemoteChainApi(*pIo, identity, *m_pTransactionRegistry),
+							api::CreateRemoteTransactionApi(*pIo, identity, *m_pTransactionRegistry)
+						};
+					} catch (const catapult_runtime_error&) {
+						if (Clock::now() > deadline)
+							throw;
+
+						std::this_thread::sleep_for(std::chrono::seconds(1));
+					}
+				}
+			}
+
+			std::vector<ProcessUsage> sampleUsages(const std::vector<std::unique_ptr<NodeProcess>>& nodeProcesses) {
+				std::vector<ProcessUsage> usages;
+				for (auto i = 0u; i < nodeProcesses.size(); ++i) {
+					usages.push_back(nodeProcesses[i]->usage());
+
+					if (m_maxResidentBytes.size() <= i)
+						m_maxResidentBytes.push_back(0);
+
+					m_maxResidentBytes[i] = std::max(m_maxResidentBytes[i], usages.back().ResidentBytes);
+				}
+
+				return usages;
+			}
+
+		private:
+			// region flood / drain
+
+			void flood(
+					TransactionGenerator& generator,
+					const utils::NetworkTime& networkTime,
+					Timestamp deadlineOffset,
+					const std::vector<std::unique_ptr<NodeProcess>>& nodeProcesses) {
+				utils::StackLogger stackLogger("pushing transactions", utils::LogLevel::Info);
+
+				auto batchInterval = std::chrono::microseconds(1'000'000ull * m_batchSize / m_rate);
+				auto endTime = Clock::now() + std::chrono::seconds(m_durationSeconds);
+				auto nextPushTime = Clock::now();
+				auto nextPollTime = Clock::now();
+				auto numBatches = 0u;
+				while (Clock::now() < endTime) {
+					if (Clock::now() >= nextPollTime) {
+						poll(generator, networkTime);
+						sampleUsages(nodeProcesses);
+						nextPollTime += std::chrono::milliseconds(m_pollIntervalMillis);
+					}
+
+					std::this_thread::sleep_until(std::min(nextPushTime, nextPollTime));
+					if (Clock::now() < nextPushTime)
+						continue;
+
+					// push batches round robin to all nodes and probe the first transaction of each batch
+					auto nodeIndex = numBatches++ % m_nodeConnections.size();
+					std::vector<model::TransactionInfo> transactionInfos;
+					auto now = networkTime.now();
+					for (auto i = 0u; i < m_batchSize; ++i) {
+						auto pTransaction = generator.next(now + deadlineOffset);
+						auto transactionHash = generator.hash(*pTransaction);
+						m_recorder.addPushed(transactionHash, nodeIndex, now, 0 == i);
+						transactionInfos.emplace_back(std::move(pTransaction), transactionHash);
+					}
+
+					push(*m_nodeConnections[nodeIndex].pIo, ionet::CreateBroadcastPayload(transactionInfos));
+					nextPushTime += batchInterval;
+				}
+
+				CATAPULT_LOG(info) << "pushed " << numBatches << " batches of " << m_batchSize << " transactions";
+			}
+
+			void drain(const TransactionGenerator& generator, const std::vector<std::unique_ptr<NodeProcess>>& nodeProcesses) {
+				utils::StackLogger stackLogger("waiting for block inclusion", utils::LogLevel::Info);
+
+				auto endTime = Clock::now() + std::chrono::seconds(m_drainSeconds);
+				while (Clock::now() < endTime) {
+					pollChain(generator);
+					sampleUsages(nodeProcesses);
+
+					auto summary = m_recorder.summarize();
+					if (summary.NumPushed == summary.NumConfirmed)
+						break;
+
+					std::this_thread::sleep_for(std::chrono::milliseconds(m_pollIntervalMillis));
+				}
+			}
+
+			void push(ionet::PacketIo& io, const ionet::PacketPayload& payload) {
+				thread::promise<ionet::SocketOperationCode> promise;
+				auto future = promise.get_future();
+				io.write(payload, [&promise](auto code) {
+					promise.set_value(std::move(code));
+				});
+
+				auto code = future.get();
+				if (ionet::SocketOperationCode::Success != code)
+					CATAPULT_LOG(warning) << "pushing transactions failed with " << code;
+			}
+
+			void poll(const TransactionGenerator& generator, const utils::NetworkTime& networkTime) {
+				// request all unconfirmed transactions not known to the recorder so that only pending probes are returned
+				for (auto i = 0u; i < m_nodeConnections.size(); ++i) {
+					auto knownShortHashes = m_recorder.knownShortHashes(i);
+					auto transactionsFuture = m_nodeConnections[i].pTransactionApi->unconfirmedTransactions(
+							BlockFeeMultiplier(),
+							std::move(knownShortHashes));
+					UnwrapFutureAndSuppressErrors("polling unconfirmed transactions", std::move(transactionsFuture), [&](auto&& range) {
+						auto now = networkTime.now();
+						for (const auto& transaction : range)
+							m_recorder.markObserved(generator.hash(transaction), now);
+					});
+				}
+
+				pollChain(generator);
+			}
+
+			void pollChain(const TransactionGenerator& generator) {
+				// use the first node as the observer of new blocks
+				const auto& chainApi = *m_nodeConnections[0].pChainApi;
+				UnwrapFutureAndSuppressErrors("polling chain", chainApi.chainInfo(), [this, &generator, &chainApi](const auto& chainInfo) {
+					while (m_chainHeight < chainInfo.Height) {
+						auto pBlock = chainApi.blockAt(m_chainHeight + Height(1)).get();
+						for (const auto& transaction : pBlock->Transactions())
+							m_recorder.markConfirmed(generator.hash(transaction), pBlock->Timestamp);
+
+						m_chainHeight = m_chainHeight + Height(1);
+					}
+				});
+			}
+
+			// endregion
+
+			// region report
+
+			void report(
+					const std::vector<std::unique_ptr<NodeProcess>>& nodeProcesses,
+					const std::vector<ProcessUsage>& startUsages,
+					const std::vector<ProcessUsage>& endUsages,
+					uint64_t elapsedMillis) const {
+				auto summary = m_recorder.summarize();
+				auto confirmedPerSecond = 0 == summary.ElapsedMillis ? 0 : summary.NumConfirmed * 1000 / summary.ElapsedMillis;
+
+				CATAPULT_LOG(info) << "--- THROUGHPUT SUMMARY ---";
+				CATAPULT_LOG(info) << "   pushed transactions: " << summary.NumPushed << " (target rate " << m_rate << " tx/s)";
+				CATAPULT_LOG(info) << "confirmed transactions: " << summary.NumConfirmed << " in " << summary.ElapsedMillis << "ms";
+				CATAPULT_LOG(info) << "          accepted TPS: " << confirmedPerSecond;
+				CATAPULT_LOG(info) << "      ut cache latency: " << summary.UtLatency;
+				CATAPULT_LOG(info) << "     inclusion latency: " << summary.InclusionLatency;
+
+				for (auto i = 0u; i < nodeProcesses.size(); ++i) {
+					auto cpuMillis = endUsages[i].CpuMillis - startUsages[i].CpuMillis;
+					auto cpuPercentage = 0 == elapsedMillis ? 0 : cpuMillis * 100 / elapsedMillis;
+					CATAPULT_LOG(info)
+							<< nodeProcesses[i]->directory() << ": cpu " << cpuPercentage << "%, rss "
+							<< utils::FileSize::FromBytes(endUsages[i].ResidentBytes) << " (max "
+							<< utils::FileSize::FromBytes(m_maxResidentBytes[i]) << ")";
+				}
+			}
+
+			// endregion
+
+		private:
+			std::string m_resourcesPath;
+			std::vector<std::string> m_nodeDirectories;
+			std::string m_binDirectory;
+			std::string m_nemesisPropertiesFilePath;
+			uint32_t m_rate;
+			uint32_t m_batchSize;
+			uint32_t m_durationSeconds;
+			uint32_t m_drainSeconds;
+			uint32_t m_pollIntervalMillis;
+			uint32_t m_startupTimeoutSeconds;
+			TransactionGeneratorOptions m_generatorOptions;
+			uint64_t m_maxFee;
+
+			std::shared_ptr<model::TransactionRegistry> m_pTransactionRegistry;
+			std::vector<NodeConnection> m_nodeConnections;
+			ThroughputRecorder m_recorder;
+			Height m_chainHeight;
+			std::vector<uint64_t> m_maxResidentBytes;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::throughput::ThroughputTool throughputTool;
+	return catapult::tools::ToolMain(argc, argv, throughputTool);
+}